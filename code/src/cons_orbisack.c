@@ -91,6 +91,7 @@
 #define DEFAULT_COEFFBOUND               1000000.0     /**< maximum size of coefficients in orbisack inequalities */
 #define DEFAULT_PPORBISACK         TRUE /**< whether we allow upgrading to packing/partitioning orbisacks */
 #define DEFAULT_FORCECONSCOPY     FALSE /**< whether orbisack constraints should be forced to be copied to sub SCIPs */
+#define DEFAULT_MERGECHAINS       FALSE /**< whether chains of orbisacks should be merged into orbitopes after presolving */
 
 /* Constants to store fixings */
 #define FIXED0    1                     /* When a variable is fixed to 0. */
@@ -111,6 +112,12 @@ struct SCIP_ConshdlrData
    SCIP_Bool             checkpporbisack;    /**< whether we allow upgrading to packing/partitioning orbisacks */
    int                   maxnrows;           /**< maximal number of rows in an orbisack constraint */
    SCIP_Bool             forceconscopy;      /**< whether orbisack constraints should be forced to be copied to sub SCIPs */
+   SCIP_Bool             mergechains;        /**< whether chains of orbisacks should be merged into orbitopes after presolving */
+   SCIP_Real*            vals1;              /**< scratch buffer for solution values of first column */
+   SCIP_Real*            vals2;              /**< scratch buffer for solution values of second column */
+   SCIP_Real*            coeffs1;            /**< scratch buffer for inequality coefficients of first column */
+   SCIP_Real*            coeffs2;            /**< scratch buffer for inequality coefficients of second column */
+   int                   scratchsize;        /**< size of scratch buffers */
 };
 
 /** constraint data for orbisack constraints */
@@ -127,6 +134,36 @@ struct SCIP_ConsData
  * Local methods
  */
 
+/** ensures that the scratch buffers of the constraint handler can hold a given number of rows
+ *
+ *  This may move the buffers, so it must be called before pointers to them are taken.
+ */
+static
+SCIP_RETCODE ensureScratchSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   int                   nrows               /**< number of rows that need to be stored */
+   )
+{
+   int newsize;
+
+   assert( scip != NULL );
+   assert( conshdlrdata != NULL );
+
+   if ( nrows <= conshdlrdata->scratchsize )
+      return SCIP_OKAY;
+
+   newsize = SCIPcalcMemGrowSize(scip, nrows);
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &conshdlrdata->vals1, conshdlrdata->scratchsize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &conshdlrdata->vals2, conshdlrdata->scratchsize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &conshdlrdata->coeffs1, conshdlrdata->scratchsize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &conshdlrdata->coeffs2, conshdlrdata->scratchsize, newsize) );
+   conshdlrdata->scratchsize = newsize;
+
+   return SCIP_OKAY;
+}
+
+
 /** frees orbisack constraint data */
 static
 SCIP_RETCODE consdataFree(
@@ -365,14 +402,14 @@ SCIP_RETCODE separateOrbisackCovers(
    SCIP_VAR*const*       vars2,              /**< variables of second column */
    SCIP_Real*            vals1,              /**< LP-solution for those variables in first column */
    SCIP_Real*            vals2,              /**< LP-solution for those variables in second column */
+   SCIP_Real*            coeff1,             /**< scratch buffer for coefficients of first column (size at least nrows) */
+   SCIP_Real*            coeff2,             /**< scratch buffer for coefficients of second column (size at least nrows) */
    int*                  ngen,               /**< number of separated covers */
    SCIP_Bool*            infeasible          /**< pointer to store whether we detected infeasibility */
    )
 {
    SCIP_Real rhs = 0.0;
    SCIP_Real lhs = 0.0;
-   SCIP_Real* coeff1;
-   SCIP_Real* coeff2;
    int i;
 
    assert( scip != NULL );
@@ -380,16 +417,14 @@ SCIP_RETCODE separateOrbisackCovers(
    assert( nrows > 0 );
    assert( vars1 != NULL );
    assert( vars2 != NULL );
+   assert( coeff1 != NULL );
+   assert( coeff2 != NULL );
    assert( infeasible != NULL );
    assert( ngen != NULL );
 
    *infeasible = FALSE;
    *ngen = 0;
 
-   /* allocate memory for inequality coefficients */
-   SCIP_CALL( SCIPallocBufferArray(scip, &coeff1, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &coeff2, nrows) );
-
    /* initialize coefficient matrix */
    for (i = 0; i < nrows; ++i)
    {
@@ -447,10 +482,6 @@ SCIP_RETCODE separateOrbisackCovers(
       }
    }
 
-   /* free coefficient matrix */
-   SCIPfreeBufferArray(scip, &coeff2);
-   SCIPfreeBufferArray(scip, &coeff1);
-
    return SCIP_OKAY;
 }
 
@@ -465,6 +496,7 @@ SCIP_RETCODE addOrbisackInequality(
    SCIP_VAR*const*       vars2,              /**< variables of second column */
    SCIP_Real*            coeffs1,            /**< first column of coefficient matrix of inequality to be added */
    SCIP_Real*            coeffs2,            /**< second column of coefficient matrix of inequality to be added */
+   SCIP_Real             scale,              /**< factor by which the coefficients have to be multiplied */
    SCIP_Real             rhs,                /**< right-hand side of inequality to be added */
    SCIP_Bool*            infeasible          /**< pointer to store whether we detected infeasibility */
    )
@@ -487,8 +519,8 @@ SCIP_RETCODE addOrbisackInequality(
 
    for (i = 0; i < nrows; ++i)
    {
-      SCIP_CALL( SCIPaddVarToRow(scip, row, vars1[i], coeffs1[i]) );
-      SCIP_CALL( SCIPaddVarToRow(scip, row, vars2[i], coeffs2[i]) );
+      SCIP_CALL( SCIPaddVarToRow(scip, row, vars1[i], scale * coeffs1[i]) );
+      SCIP_CALL( SCIPaddVarToRow(scip, row, vars2[i], scale * coeffs2[i]) );
    }
    SCIP_CALL( SCIPflushRowExtensions(scip, row) );
 
@@ -512,6 +544,9 @@ SCIP_RETCODE addOrbisackInequality(
  *  We implement the separation algorithm for orbisacks described in@n
  *  A. Loos. Describing Orbitopes by Linear Inequalities and Projection Based Tools.
  *  PhD thesis, Otto-von-Guericke-Universitaet Magdeburg, 2010.
+ *
+ *  The coefficients are stored relative to a common scaling factor. Doubling the inequality thus only doubles the
+ *  factor, such that each basement row is handled in constant time.
  */
 static
 SCIP_RETCODE separateOrbisack(
@@ -522,14 +557,15 @@ SCIP_RETCODE separateOrbisack(
    SCIP_VAR*const*       vars2,              /**< variables of second column */
    SCIP_Real*            vals1,              /**< LP-solution for those variables in first column */
    SCIP_Real*            vals2,              /**< LP-solution for those variables in second column */
+   SCIP_Real*            coeff1,             /**< scratch buffer for coefficients of first column (size at least nrows) */
+   SCIP_Real*            coeff2,             /**< scratch buffer for coefficients of second column (size at least nrows) */
    SCIP_Bool             coverseparation,    /**< whether we separate cover inequalities */
    SCIP_Real             coeffbound,         /**< maximum size of coefficients in orbisack inequalities */
    int*                  ngen,               /**< pointer to store the number of generated cuts */
    SCIP_Bool*            infeasible          /**< pointer to store whether we detected infeasibility */
    )
 {
-   SCIP_Real* coeff1;
-   SCIP_Real* coeff2;
+   SCIP_Real scale;
    SCIP_Real rhs;
    SCIP_Real lhs;
    SCIP_Real valueA;
@@ -543,6 +579,8 @@ SCIP_RETCODE separateOrbisack(
    assert( nrows > 0 );
    assert( vars1 != NULL );
    assert( vars2 != NULL );
+   assert( coeff1 != NULL );
+   assert( coeff2 != NULL );
    assert( coeffbound >= 0.0 );
    assert( ngen != NULL );
    assert( infeasible != NULL );
@@ -554,11 +592,8 @@ SCIP_RETCODE separateOrbisack(
    if ( nrows < 2 )
       return SCIP_OKAY;
 
-   /* allocate memory for inequality coefficients */
-   SCIP_CALL( SCIPallocBufferArray(scip, &coeff1, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &coeff2, nrows) );
-
    /* initialize coefficient matrix row 0 */
+   scale = 1.0;
    coeff1[0] = -1.0;
    coeff2[0] = 1.0;
    for (i = 2; i < nrows; ++i)
@@ -582,7 +617,7 @@ SCIP_RETCODE separateOrbisack(
    /* check whether cut for basement row = 1 is violated */
    if ( SCIPisEfficacious(scip, lhs - rhs) )
    {
-      SCIP_CALL( addOrbisackInequality(scip, cons, nrows, vars1, vars2, coeff1, coeff2, rhs, infeasible) );
+      SCIP_CALL( addOrbisackInequality(scip, cons, nrows, vars1, vars2, coeff1, coeff2, scale, rhs, infeasible) );
       ++(*ngen);
    }
 
@@ -599,46 +634,41 @@ SCIP_RETCODE separateOrbisack(
          ++rhs;
          coeff1[basement] = 0.0;
          lhs += vals1[basement++];
-         coeff1[basement] = -1.0;
-         coeff2[basement] = 1.0;
+         coeff1[basement] = -1.0 / scale;
+         coeff2[basement] = 1.0 / scale;
          lhs += - vals1[basement] + vals2[basement];
       }
       else if ( valueB >= valueA && valueB >= valueC )
       {
          coeff2[basement] = 0.0;
          lhs -= vals2[basement++];
-         coeff1[basement] = -1.0;
-         coeff2[basement] = 1.0;
+         coeff1[basement] = -1.0 / scale;
+         coeff2[basement] = 1.0 / scale;
          lhs += - vals1[basement] + vals2[basement];
       }
       else
       {
+         /* double the rows above the basement row, whose contribution is lhs without the basement row */
          rhs *= 2.0;
-         lhs = 0.0;
-         for (i = 0; i < basement; ++i)
-         {
-            coeff1[i] = 2.0 * coeff1[i];
-            coeff2[i] = 2.0 * coeff2[i];
-            lhs += coeff1[i] * vals1[i] + coeff2[i] * vals2[i];
-         }
-         coeff1[basement] = -1.0;
-         coeff2[basement] = 1.0;
-         lhs -= vals1[basement];
-         lhs += vals2[basement++];
-         coeff1[basement] = -1.0;
-         coeff2[basement] = 1.0;
+         lhs = 2.0 * lhs + vals1[basement] - vals2[basement];
+         scale *= 2.0;
+         coeff1[basement] = -1.0 / scale;
+         coeff2[basement] = 1.0 / scale;
+         ++basement;
+         coeff1[basement] = -1.0 / scale;
+         coeff2[basement] = 1.0 / scale;
          lhs -= vals1[basement];
          lhs += vals2[basement];
       }
 
       /* to avoid numerical troubles, we bound the size of coefficients and rhs */
-      if ( rhs > coeffbound || -coeff1[0] > coeffbound || coeff2[0] > coeffbound )
+      if ( rhs > coeffbound || -scale * coeff1[0] > coeffbound || scale * coeff2[0] > coeffbound )
       {
-         /* avoid separating cover inequalities twice */
+         /* avoid separating cover inequalities twice; the coefficient buffers are not needed anymore */
          if ( ! coverseparation )
          {
             int ncuts;
-            SCIP_CALL( separateOrbisackCovers(scip, cons, nrows, vars1, vars2, vals1, vals2, &ncuts, infeasible) );
+            SCIP_CALL( separateOrbisackCovers(scip, cons, nrows, vars1, vars2, vals1, vals2, coeff1, coeff2, &ncuts, infeasible) );
             *ngen += ncuts;
          }
          break;
@@ -647,15 +677,11 @@ SCIP_RETCODE separateOrbisack(
       /* if current inequality is violated */
       if ( SCIPisEfficacious(scip, lhs - rhs) )
       {
-         SCIP_CALL( addOrbisackInequality(scip, cons, nrows, vars1, vars2, coeff1, coeff2, rhs, infeasible) );
+         SCIP_CALL( addOrbisackInequality(scip, cons, nrows, vars1, vars2, coeff1, coeff2, scale, rhs, infeasible) );
          ++(*ngen);
       }
    }
 
-   /* free allocated memory */
-   SCIPfreeBufferArray(scip, &coeff2);
-   SCIPfreeBufferArray(scip, &coeff1);
-
    return SCIP_OKAY;
 }
 
@@ -969,14 +995,20 @@ SCIP_RETCODE separateInequalities(
    conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
    assert( conshdlrdata != NULL );
 
+   /* The callers size the scratch buffers before taking the pointers to vals1 and vals2, since resizing here would
+    * invalidate them. */
+   assert( nrows <= conshdlrdata->scratchsize );
+
    if ( conshdlrdata->orbiseparation )
    {
-      SCIP_CALL( separateOrbisack(scip, cons, nrows, vars1, vars2, vals1, vals2, FALSE, conshdlrdata->coeffbound, &ngen1, &infeasible) );
+      SCIP_CALL( separateOrbisack(scip, cons, nrows, vars1, vars2, vals1, vals2, conshdlrdata->coeffs1, conshdlrdata->coeffs2,
+            FALSE, conshdlrdata->coeffbound, &ngen1, &infeasible) );
    }
 
    if ( ! infeasible && conshdlrdata->coverseparation )
    {
-      SCIP_CALL( separateOrbisackCovers(scip, cons, nrows, vars1, vars2, vals1, vals2, &ngen2, &infeasible) );
+      SCIP_CALL( separateOrbisackCovers(scip, cons, nrows, vars1, vars2, vals1, vals2, conshdlrdata->coeffs1, conshdlrdata->coeffs2,
+            &ngen2, &infeasible) );
    }
 
    if ( infeasible )
@@ -992,6 +1024,244 @@ SCIP_RETCODE separateInequalities(
 }
 
 
+/** checks whether the second column of one orbisack coincides with the first column of another orbisack */
+static
+SCIP_Bool orbisacksFormChain(
+   SCIP_CONS*            cons1,              /**< constraint whose second column is compared */
+   SCIP_CONS*            cons2               /**< constraint whose first column is compared */
+   )
+{
+   SCIP_CONSDATA* consdata1;
+   SCIP_CONSDATA* consdata2;
+   int i;
+
+   assert( cons1 != NULL );
+   assert( cons2 != NULL );
+
+   if ( cons1 == cons2 )
+      return FALSE;
+
+   consdata1 = SCIPconsGetData(cons1);
+   consdata2 = SCIPconsGetData(cons2);
+   assert( consdata1 != NULL );
+   assert( consdata2 != NULL );
+
+   if ( consdata1->nrows != consdata2->nrows || consdata1->ismodelcons != consdata2->ismodelcons )
+      return FALSE;
+
+   /* the merged orbitope inherits the flags of the first constraint of the chain */
+   if ( SCIPconsIsEnforced(cons1) != SCIPconsIsEnforced(cons2) || SCIPconsIsChecked(cons1) != SCIPconsIsChecked(cons2)
+      || SCIPconsIsPropagated(cons1) != SCIPconsIsPropagated(cons2) || SCIPconsIsSeparated(cons1) != SCIPconsIsSeparated(cons2) )
+      return FALSE;
+
+   for (i = 0; i < consdata1->nrows; ++i)
+   {
+      if ( consdata1->vars2[i] != consdata2->vars1[i] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+/** replaces chains of orbisacks by full orbitopes
+ *
+ *  If the second column of an orbisack is the first column of another orbisack, both constraints together
+ *  require three columns to be sorted lexicographically non-increasingly. A maximal chain of such orbisacks thus
+ *  is equivalent to a single full orbitope on the columns of the chain. Columns that are the first (second) column
+ *  of more than one orbisack are not used to extend chains, which keeps the chains disjoint. Only model orbisacks
+ *  are merged.
+ */
+static
+SCIP_RETCODE mergeOrbisackChains(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< orbisack constraints */
+   int                   nconss,             /**< number of orbisack constraints */
+   int*                  nmerged,            /**< pointer to store the number of merged orbisacks */
+   int*                  norbitopes          /**< pointer to store the number of created orbitopes */
+   )
+{
+   SCIP_HASHMAP* firstcolmap;
+   SCIP_HASHMAP* secondcolmap;
+   SCIP_CONS** chainconss;
+   SCIP_Bool* haspred;
+   int* succ;
+   int nchainconss = 0;
+   int c;
+
+   assert( scip != NULL );
+   assert( conss != NULL );
+   assert( nmerged != NULL );
+   assert( norbitopes != NULL );
+
+   *nmerged = 0;
+   *norbitopes = 0;
+
+   if ( nconss < 2 )
+      return SCIP_OKAY;
+
+   /* copy the constraints, because the constraint array of the handler changes when constraints are deleted */
+   SCIP_CALL( SCIPallocBufferArray(scip, &chainconss, nconss) );
+   for (c = 0; c < nconss; ++c)
+   {
+      SCIP_CONS* cons = conss[c];
+
+      assert( cons != NULL );
+      if ( SCIPconsIsDeleted(cons) || SCIPconsIsLocal(cons) || SCIPconsIsModifiable(cons) )
+         continue;
+
+      /* orbisacks added by the symmetry propagator are not merged, since the propagator deletes its own
+       * constraints by itself, e.g., when recomputing symmetries after a restart
+       */
+      if ( ! SCIPconsGetData(cons)->ismodelcons )
+         continue;
+
+      chainconss[nchainconss++] = cons;
+   }
+
+   if ( nchainconss < 2 )
+   {
+      SCIPfreeBufferArray(scip, &chainconss);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &succ, nchainconss) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &haspred, nchainconss) );
+   SCIP_CALL( SCIPhashmapCreate(&firstcolmap, SCIPblkmem(scip), nchainconss) );
+   SCIP_CALL( SCIPhashmapCreate(&secondcolmap, SCIPblkmem(scip), nchainconss) );
+
+   /* index the constraints by the leading variables of their columns; -1 marks ambiguous columns */
+   for (c = 0; c < nchainconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+
+      consdata = SCIPconsGetData(chainconss[c]);
+      assert( consdata != NULL );
+      assert( consdata->nrows > 0 );
+
+      if ( SCIPhashmapExists(firstcolmap, (void*) consdata->vars1[0]) )
+      {
+         SCIP_CALL( SCIPhashmapSetImageInt(firstcolmap, (void*) consdata->vars1[0], -1) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(firstcolmap, (void*) consdata->vars1[0], c) );
+      }
+
+      if ( SCIPhashmapExists(secondcolmap, (void*) consdata->vars2[0]) )
+      {
+         SCIP_CALL( SCIPhashmapSetImageInt(secondcolmap, (void*) consdata->vars2[0], -1) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(secondcolmap, (void*) consdata->vars2[0], c) );
+      }
+   }
+
+   /* link each orbisack to the unique orbisack whose first column is its second column */
+   for (c = 0; c < nchainconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+      int d;
+
+      succ[c] = -1;
+
+      consdata = SCIPconsGetData(chainconss[c]);
+      assert( consdata != NULL );
+
+      if ( SCIPhashmapGetImageInt(secondcolmap, (void*) consdata->vars2[0]) != c )
+         continue;
+
+      d = SCIPhashmapGetImageInt(firstcolmap, (void*) consdata->vars2[0]);
+      if ( d < 0 || d == INT_MAX )
+         continue;
+
+      if ( orbisacksFormChain(chainconss[c], chainconss[d]) )
+      {
+         assert( ! haspred[d] );
+         succ[c] = d;
+         haspred[d] = TRUE;
+      }
+   }
+
+   /* create one orbitope per maximal chain; cycles have no start and are left untouched */
+   for (c = 0; c < nchainconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+      SCIP_CONS* orbitope;
+      SCIP_CONS* cons;
+      SCIP_VAR*** vars;
+      char name[SCIP_MAXSTRLEN];
+      int ncols;
+      int nrows;
+      int d;
+      int i;
+      int j;
+
+      if ( haspred[c] || succ[c] < 0 || succ[succ[c]] < 0 )
+         continue;
+
+      cons = chainconss[c];
+      consdata = SCIPconsGetData(cons);
+      assert( consdata != NULL );
+      nrows = consdata->nrows;
+
+      ncols = 2;
+      for (d = succ[c]; d >= 0; d = succ[d])
+         ++ncols;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &vars, nrows) );
+      for (i = 0; i < nrows; ++i)
+      {
+         SCIP_CALL( SCIPallocBufferArray(scip, &vars[i], ncols) ); /*lint !e866*/
+      }
+
+      j = 0;
+      for (d = c; d >= 0; d = succ[d])
+      {
+         SCIP_CONSDATA* curdata;
+
+         curdata = SCIPconsGetData(chainconss[d]);
+         for (i = 0; i < nrows; ++i)
+         {
+            vars[i][j] = curdata->vars1[i];
+            vars[i][j + 1] = curdata->vars2[i];
+         }
+         ++j;
+      }
+      assert( j == ncols - 1 );
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_chain", SCIPconsGetName(cons));
+
+      SCIP_CALL( SCIPcreateConsOrbitope(scip, &orbitope, name, vars, SCIP_ORBITOPETYPE_FULL, nrows, ncols,
+            FALSE, TRUE, TRUE, consdata->ismodelcons, SCIPconsIsInitial(cons), SCIPconsIsSeparated(cons),
+            SCIPconsIsEnforced(cons), SCIPconsIsChecked(cons), SCIPconsIsPropagated(cons), FALSE, FALSE,
+            SCIPconsIsDynamic(cons), SCIPconsIsRemovable(cons), SCIPconsIsStickingAtNode(cons)) );
+      SCIP_CALL( SCIPaddCons(scip, orbitope) );
+      SCIP_CALL( SCIPreleaseCons(scip, &orbitope) );
+
+      for (i = nrows - 1; i >= 0; --i)
+         SCIPfreeBufferArray(scip, &vars[i]);
+      SCIPfreeBufferArray(scip, &vars);
+
+      for (d = c; d >= 0; d = succ[d])
+      {
+         SCIP_CALL( SCIPdelCons(scip, chainconss[d]) );
+         ++(*nmerged);
+      }
+      ++(*norbitopes);
+   }
+
+   SCIPhashmapFree(&secondcolmap);
+   SCIPhashmapFree(&firstcolmap);
+   SCIPfreeBufferArray(scip, &haspred);
+   SCIPfreeBufferArray(scip, &succ);
+   SCIPfreeBufferArray(scip, &chainconss);
+
+   return SCIP_OKAY;
+}
+
+
 /*--------------------------------------------------------------------------------------------
  *--------------------------------- SCIP functions -------------------------------------------
  *--------------------------------------------------------------------------------------------*/
@@ -1040,6 +1310,11 @@ SCIP_DECL_CONSFREE(consFreeOrbisack)
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert( conshdlrdata != NULL );
 
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->coeffs2, conshdlrdata->scratchsize);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->coeffs1, conshdlrdata->scratchsize);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->vals2, conshdlrdata->scratchsize);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->vals1, conshdlrdata->scratchsize);
+
    SCIPfreeBlockMemory(scip, &conshdlrdata);
 
    return SCIP_OKAY;
@@ -1179,8 +1454,9 @@ SCIP_DECL_CONSSEPALP(consSepalpOrbisack)
       nvals = conshdlrdata->maxnrows;
       assert( nvals > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals1, nvals) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals2, nvals) );
+      SCIP_CALL( ensureScratchSize(scip, conshdlrdata, nvals) );
+      vals1 = conshdlrdata->vals1;
+      vals2 = conshdlrdata->vals2;
 
       /* loop through constraints */
       for (c = 0; c < nconss; ++c)
@@ -1200,9 +1476,6 @@ SCIP_DECL_CONSSEPALP(consSepalpOrbisack)
          if ( *result == SCIP_CUTOFF )
             break;
       }
-
-      SCIPfreeBufferArray(scip, &vals2);
-      SCIPfreeBufferArray(scip, &vals1);
    }
 
    return SCIP_OKAY;
@@ -1238,8 +1511,9 @@ SCIP_DECL_CONSSEPASOL(consSepasolOrbisack)
       nvals = conshdlrdata->maxnrows;
       assert( nvals > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals1, nvals) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals2, nvals) );
+      SCIP_CALL( ensureScratchSize(scip, conshdlrdata, nvals) );
+      vals1 = conshdlrdata->vals1;
+      vals2 = conshdlrdata->vals2;
 
       /* loop through constraints */
       for (c = 0; c < nconss; ++c)
@@ -1259,9 +1533,6 @@ SCIP_DECL_CONSSEPASOL(consSepasolOrbisack)
          if ( *result == SCIP_CUTOFF )
             break;
       }
-
-      SCIPfreeBufferArray(scip, &vals2);
-      SCIPfreeBufferArray(scip, &vals1);
    }
 
    return SCIP_OKAY;
@@ -1305,8 +1576,9 @@ SCIP_DECL_CONSENFOLP(consEnfolpOrbisack)
       nvals = conshdlrdata->maxnrows;
       assert( nvals > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals1, nvals) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals2, nvals) );
+      SCIP_CALL( ensureScratchSize(scip, conshdlrdata, nvals) );
+      vals1 = conshdlrdata->vals1;
+      vals2 = conshdlrdata->vals2;
 
       /* loop through constraints */
       for (c = 0; c < nconss; ++c)
@@ -1330,7 +1602,8 @@ SCIP_DECL_CONSENFOLP(consEnfolpOrbisack)
          /* Separate only cover inequalities to ensure that enforcing works correctly. */
          /* Otherwise, it may happen that infeasible solutions cannot be detected, since */
          /* we bound the size of the coefficients for the orbisack inequalities. */
-         SCIP_CALL( separateOrbisackCovers(scip, conss[c], consdata->nrows, consdata->vars1, consdata->vars2, vals1, vals2, &ngen, &infeasible) );
+         SCIP_CALL( separateOrbisackCovers(scip, conss[c], consdata->nrows, consdata->vars1, consdata->vars2, vals1, vals2,
+               conshdlrdata->coeffs1, conshdlrdata->coeffs2, &ngen, &infeasible) );
 
          if ( infeasible )
          {
@@ -1343,9 +1616,6 @@ SCIP_DECL_CONSENFOLP(consEnfolpOrbisack)
          if ( ngen > 0 )
             *result = SCIP_SEPARATED;
       }
-
-      SCIPfreeBufferArray(scip, &vals2);
-      SCIPfreeBufferArray(scip, &vals1);
    }
 
    return SCIP_OKAY;
@@ -1434,8 +1704,9 @@ SCIP_DECL_CONSENFORELAX(consEnforelaxOrbisack)
       nvals = conshdlrdata->maxnrows;
       assert( nvals > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals1, nvals) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &vals2, nvals) );
+      SCIP_CALL( ensureScratchSize(scip, conshdlrdata, nvals) );
+      vals1 = conshdlrdata->vals1;
+      vals2 = conshdlrdata->vals2;
 
       /* loop through constraints */
       for (c = 0; c < nconss; ++c)
@@ -1459,7 +1730,8 @@ SCIP_DECL_CONSENFORELAX(consEnforelaxOrbisack)
          /* Separate only cover inequalities to ensure that enforcing works correctly. */
          /* Otherwise, it may happen that infeasible solutions cannot be detected, since */
          /* we bound the size of the coefficients for the orbisack inequalities. */
-         SCIP_CALL( separateOrbisackCovers(scip, conss[c], consdata->nrows, consdata->vars1, consdata->vars2, vals1, vals2, &ngen, &infeasible) );
+         SCIP_CALL( separateOrbisackCovers(scip, conss[c], consdata->nrows, consdata->vars1, consdata->vars2, vals1, vals2,
+               conshdlrdata->coeffs1, conshdlrdata->coeffs2, &ngen, &infeasible) );
 
          if ( infeasible )
          {
@@ -1472,9 +1744,6 @@ SCIP_DECL_CONSENFORELAX(consEnforelaxOrbisack)
          if ( ngen > 0 )
             *result = SCIP_SEPARATED;
       }
-
-      SCIPfreeBufferArray(scip, &vals2);
-      SCIPfreeBufferArray(scip, &vals1);
    }
 
    return SCIP_OKAY;
@@ -1615,6 +1884,37 @@ SCIP_DECL_CONSPRESOL(consPresolOrbisack)
 }
 
 
+/** presolving deinitialization method of constraint handler (called after presolving has been finished) */
+static
+SCIP_DECL_CONSEXITPRE(consExitpreOrbisack)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   int nmerged;
+   int norbitopes;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   /* symmetry handling constraints are usually added at the end of presolving, so we merge them here */
+   if ( ! conshdlrdata->mergechains || nconss < 2 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( mergeOrbisackChains(scip, conss, nconss, &nmerged, &norbitopes) );
+
+   if ( nmerged > 0 )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "merged %d orbisack constraints into %d orbitope constraints\n",
+         nmerged, norbitopes);
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** Propagation resolution for conflict analysis */
 static
 SCIP_DECL_CONSRESPROP(consRespropOrbisack)
@@ -2131,6 +2431,12 @@ SCIP_RETCODE SCIPincludeConshdlrOrbisack(
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &conshdlrdata) );
 
+   conshdlrdata->vals1 = NULL;
+   conshdlrdata->vals2 = NULL;
+   conshdlrdata->coeffs1 = NULL;
+   conshdlrdata->coeffs2 = NULL;
+   conshdlrdata->scratchsize = 0;
+
    /* include constraint handler */
    SCIP_CALL( SCIPincludeConshdlrBasic(scip, &conshdlr, CONSHDLR_NAME, CONSHDLR_DESC,
          CONSHDLR_ENFOPRIORITY, CONSHDLR_CHECKPRIORITY,
@@ -2142,6 +2448,7 @@ SCIP_RETCODE SCIPincludeConshdlrOrbisack(
    /* set non-fundamental callbacks via specific setter functions */
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopyOrbisack, consCopyOrbisack) );
    SCIP_CALL( SCIPsetConshdlrEnforelax(scip, conshdlr, consEnforelaxOrbisack) );
+   SCIP_CALL( SCIPsetConshdlrExitpre(scip, conshdlr, consExitpreOrbisack) );
    SCIP_CALL( SCIPsetConshdlrFree(scip, conshdlr, consFreeOrbisack) );
    SCIP_CALL( SCIPsetConshdlrDelete(scip, conshdlr, consDeleteOrbisack) );
    SCIP_CALL( SCIPsetConshdlrGetVars(scip, conshdlr, consGetVarsOrbisack) );
@@ -2178,6 +2485,10 @@ SCIP_RETCODE SCIPincludeConshdlrOrbisack(
          "Whether orbisack constraints should be forced to be copied to sub SCIPs.",
          &conshdlrdata->forceconscopy, TRUE, DEFAULT_FORCECONSCOPY, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/mergechains",
+         "Whether chains of model orbisacks should be merged into full orbitopes after presolving.",
+         &conshdlrdata->mergechains, TRUE, DEFAULT_MERGECHAINS, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
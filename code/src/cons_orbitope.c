@@ -171,10 +171,15 @@ struct SCIP_ConsData
                                               *   is used. */
    SCIP_Bool*            rowused;            /**< whether a row has been considered in roworder */
    int                   nrowsused;          /**< number of rows that have already been considered in roworder */
+   int*                  branchdecisions;    /**< buffer for rows of branching decisions on the path to the current node */
+   SCIP_Longint          lastnodenumber;     /**< number of the node for which roworder has been updated last (-1 if none) */
+   int                   lastnoderun;        /**< run in which roworder has been updated last */
    SCIP_Bool             ismodelcons;        /**< whether the orbitope is a model constraint */
    SCIP_Bool             mayinteract;        /**< whether symmetries corresponding to orbitope might interact
                                               *   with symmetries handled by other routines */
    SCIP_Bool             usedynamicprop;     /**< whether we use a dynamic version of the propagation routine */
+   int                   activepos;          /**< position (row by row) of the last active variable found in the
+                                              *   redundancy check, where the next check starts */
 };
 
 
@@ -213,6 +218,7 @@ SCIP_RETCODE consdataFree(
 
    if ( (*consdata)->usedynamicprop )
    {
+      SCIPfreeBlockMemoryArrayNull(scip, &((*consdata)->branchdecisions), p * q);
       SCIPfreeBlockMemoryArrayNull(scip, &((*consdata)->rowused), p);
    }
    SCIPfreeBlockMemoryArrayNull(scip, &((*consdata)->roworder), p);
@@ -286,6 +292,9 @@ SCIP_RETCODE consdataCreate(
       }
    }
    (*consdata)->nrowsused = 0;
+   (*consdata)->branchdecisions = NULL;
+   (*consdata)->lastnodenumber = -1;
+   (*consdata)->lastnoderun = -1;
 
    (*consdata)->tmpvals = NULL;
    (*consdata)->tmpvars = NULL;
@@ -297,6 +306,7 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->ismodelcons = ismodelcons;
    (*consdata)->mayinteract = mayinteract;
    (*consdata)->usedynamicprop = usedynamicprop;
+   (*consdata)->activepos = 0;
 
    /* get transformed variables, if we are in the transformed problem */
    if ( SCIPisTransformed(scip) )
@@ -1271,36 +1281,48 @@ SCIP_RETCODE propagatePackingPartitioningCons(
  *
  * The roworder array stores this reordering, where acutally only the first maxrowlabel entries encode the
  * reordering.
+ *
+ * The order is updated incrementally: the branching decisions at and above the node for which the order has been
+ * updated last have already been inserted, so the path to the root only needs to be followed until this node.
  */
 static
 SCIP_RETCODE computeDynamicRowOrder(
    SCIP*                 scip,               /**< SCIP pointer */
-   SCIP_HASHMAP*         rowindexmap,        /**< map of variables to indices in orbitope vars matrix */
-   SCIP_Bool*            rowused,            /**< bitset marking whether a row has been considered in the new order */
-   int*                  roworder,           /**< reordering of the rows w.r.t. branching decisions */
-   int                   nrows,              /**< number of rows in orbitope */
-   int                   ncols,              /**< number of columns in orbitope */
-   int*                  maxrowlabel         /**< maximum row label in ordering */
+   SCIP_CONSDATA*        consdata            /**< constraint data of full orbitope */
    )
 {
    int i;
    SCIP_NODE* node;
    int* branchdecisions;
    int nbranchdecision;
+   int nrows;
 
    assert( scip != NULL );
-   assert( rowindexmap != NULL );
-   assert( roworder != NULL );
-   assert( nrows > 0 );
-   assert( maxrowlabel != NULL );
+   assert( consdata != NULL );
+   assert( consdata->rowindexmap != NULL );
+   assert( consdata->rowused != NULL );
+   assert( consdata->roworder != NULL );
+   assert( consdata->nspcons > 0 );
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &branchdecisions, nrows * ncols) );
-   nbranchdecision = 0;
+   nrows = consdata->nspcons;
 
    /* get current node */
    node = SCIPgetCurrentNode(scip);
 
-   /* follow path to the root (in the root no domains were changed due to branching) */
+   /* nothing to do if all rows are ordered or the order has already been updated at this node */
+   if ( consdata->nrowsused == nrows || (consdata->lastnoderun == SCIPgetNRuns(scip)
+         && consdata->lastnodenumber == SCIPnodeGetNumber(node)) )
+      return SCIP_OKAY;
+
+   /* each variable of the orbitope can be branched on at most once along a path */
+   if ( consdata->branchdecisions == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->branchdecisions, nrows * consdata->nblocks) );
+   }
+   branchdecisions = consdata->branchdecisions;
+   nbranchdecision = 0;
+
+   /* follow path to the root (in the root no domains were changed due to branching) or to the last updated node */
    while ( SCIPnodeGetDepth(node) != 0 )
    {
       SCIP_BOUNDCHG* boundchg;
@@ -1308,6 +1330,9 @@ SCIP_RETCODE computeDynamicRowOrder(
       SCIP_VAR* branchvar;
       int nboundchgs;
 
+      if ( consdata->lastnoderun == SCIPgetNRuns(scip) && consdata->lastnodenumber == SCIPnodeGetNumber(node) )
+         break;
+
       /* get domain changes of current node */
       domchg = SCIPnodeGetDomchg(node);
       assert( domchg != NULL );
@@ -1333,11 +1358,17 @@ SCIP_RETCODE computeDynamicRowOrder(
             int rowidx;
 
             /* make sure that branching variable is present in the orbitope */
-            if ( ! SCIPhashmapExists(rowindexmap, (void*) branchvar) )
+            if ( ! SCIPhashmapExists(consdata->rowindexmap, (void*) branchvar) )
                continue;
 
-            rowidx = (int) (size_t) SCIPhashmapGetImage(rowindexmap, (void*) branchvar);
-            branchdecisions[nbranchdecision++] = rowidx;
+            rowidx = (int) (size_t) SCIPhashmapGetImage(consdata->rowindexmap, (void*) branchvar);
+
+            /* rows that are already ordered do not change the order */
+            if ( ! consdata->rowused[rowidx] )
+            {
+               assert( nbranchdecision < nrows * consdata->nblocks );
+               branchdecisions[nbranchdecision++] = rowidx;
+            }
          }
       }
 
@@ -1350,25 +1381,82 @@ SCIP_RETCODE computeDynamicRowOrder(
     */
    for (i = nbranchdecision - 1; i >= 0; --i)
    {
-      if ( ! rowused[branchdecisions[i]] )
+      if ( ! consdata->rowused[branchdecisions[i]] )
       {
-         roworder[*maxrowlabel] = branchdecisions[i];
-         rowused[branchdecisions[i]] = TRUE;
-         *maxrowlabel += 1;
+         consdata->roworder[consdata->nrowsused] = branchdecisions[i];
+         consdata->rowused[branchdecisions[i]] = TRUE;
+         consdata->nrowsused += 1;
       }
    }
 
-   SCIPfreeBufferArray(scip, &branchdecisions);
+   consdata->lastnodenumber = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+   consdata->lastnoderun = SCIPgetNRuns(scip);
 
    return SCIP_OKAY;
 }
 
 
+/** initializes the lexmin and lexmax matrices by the fixed entries in a single pass over the variables
+ *
+ *  Both matrices are stored column-wise in contiguous arrays, i.e., entry (i,j) is at position j * nrowsused + i.
+ *  Free entries are encoded by 2, except for free entries in the last column of the lexmin matrix, which are set to 0,
+ *  and free entries in the first column of the lexmax matrix, which are set to 1.
+ */
+static
+void initLexFixes(
+   SCIP_VAR***           vars,               /**< variable matrix */
+   int*                  roworder,           /**< order of rows */
+   int*                  lexminfixes,        /**< array to store fixings of lexmin matrix */
+   int*                  lexmaxfixes,        /**< array to store fixings of lexmax matrix */
+   int                   n,                  /**< number of columns in vars */
+   int                   nrowsused,          /**< number of rows considered in propagation */
+   SCIP_BDCHGIDX*        bdchgidx,           /**< bound change index (time stamp of bound change), or NULL for local bounds */
+   SCIP_Bool             atindex             /**< whether the bounds at bdchgidx shall be used */
+   )
+{
+   int i;
+   int j;
+
+   assert( vars != NULL );
+   assert( roworder != NULL );
+   assert( lexminfixes != NULL );
+   assert( lexmaxfixes != NULL );
+
+   for (i = 0; i < nrowsused; ++i)
+   {
+      SCIP_VAR** rowvars;
+
+      rowvars = vars[roworder[i]];
+
+      for (j = 0; j < n; ++j)
+      {
+         int pos = j * nrowsused + i;
+
+         if ( (atindex ? SCIPvarGetLbAtIndex(rowvars[j], bdchgidx, FALSE) : SCIPvarGetLbLocal(rowvars[j])) > 0.5 )
+         {
+            lexminfixes[pos] = 1;
+            lexmaxfixes[pos] = 1;
+         }
+         else if ( (atindex ? SCIPvarGetUbAtIndex(rowvars[j], bdchgidx, FALSE) : SCIPvarGetUbLocal(rowvars[j])) < 0.5 )
+         {
+            lexminfixes[pos] = 0;
+            lexmaxfixes[pos] = 0;
+         }
+         else
+         {
+            lexminfixes[pos] = j == n - 1 ? 0 : 2;
+            lexmaxfixes[pos] = j == 0 ? 1 : 2;
+         }
+      }
+   }
+}
+
+
 /* Compute lexicographically minimal face of the hypercube w.r.t. some coordinate fixing */
 static
 SCIP_RETCODE findLexMinFace(
    SCIP_VAR***           vars,               /**< variable matrix */
-   int**                 lexminfixes,        /**< fixings characterzing lex-min face */
+   int*                  lexminfixes,        /**< fixings characterzing lex-min face (column-wise) */
    int*                  minfixedrowlexmin,  /**< index of minimum fixed row for each column or
                                               *   NULL (if in prop) */
    SCIP_Bool*            infeasible,         /**< pointer to store whether infeasibility has been
@@ -1397,6 +1485,8 @@ SCIP_RETCODE findLexMinFace(
     */
    for (j = n - 2; j >= 0; --j)
    {
+      int* col = &lexminfixes[j * nrowsused];
+      int* nextcol = &lexminfixes[(j + 1) * nrowsused];
       int maxdiscriminating = m;
       int minfixed = -1;
 
@@ -1404,17 +1494,17 @@ SCIP_RETCODE findLexMinFace(
       for (i = 0; i < nrowsused; ++i)
       {
          /* is row i j-discriminating? */
-         if ( minfixed == -1 && lexminfixes[i][j] != 0 && lexminfixes[i][j + 1] != 1 )
+         if ( minfixed == -1 && col[i] != 0 && nextcol[i] != 1 )
          {
-            assert( lexminfixes[i][j + 1] == 0 );
+            assert( nextcol[i] == 0 );
 
             maxdiscriminating = i;
          }
 
          /* is row i j-fixed? */
-         if ( minfixed == -1 && lexminfixes[i][j] != lexminfixes[i][j + 1] && lexminfixes[i][j] != 2 )
+         if ( minfixed == -1 && col[i] != nextcol[i] && col[i] != 2 )
          {
-            assert( lexminfixes[i][j + 1] != 2 );
+            assert( nextcol[i] != 2 );
 
             minfixed = i;
 
@@ -1431,14 +1521,14 @@ SCIP_RETCODE findLexMinFace(
       /* ensure that column j is lexicographically not smaller than column j + 1 */
       for (i = 0; i < nrowsused; ++i)
       {
-         if ( lexminfixes[i][j] == 2 )
+         if ( col[i] == 2 )
          {
             if ( i < maxdiscriminating || minfixed == -1 )
-               lexminfixes[i][j] = lexminfixes[i][j + 1];
+               col[i] = nextcol[i];
             else if ( i == maxdiscriminating )
-               lexminfixes[i][j] = 1;
+               col[i] = 1;
             else
-               lexminfixes[i][j] = 0;
+               col[i] = 0;
          }
       }
 
@@ -1467,7 +1557,7 @@ SCIP_RETCODE findLexMinFace(
 static
 SCIP_RETCODE findLexMaxFace(
    SCIP_VAR***           vars,               /**< variable matrix */
-   int**                 lexmaxfixes,        /**< fixings characterzing lex-max face */
+   int*                  lexmaxfixes,        /**< fixings characterzing lex-max face (column-wise) */
    int*                  minfixedrowlexmax,  /**< index of minimum fixed row for each column or
                                               *   NULL (if in prop) */
    SCIP_Bool*            infeasible,         /**< pointer to store whether infeasibility has been
@@ -1493,6 +1583,8 @@ SCIP_RETCODE findLexMaxFace(
 
    for (j = 1; j < n; ++j)
    {
+      int* col = &lexmaxfixes[j * nrowsused];
+      int* prevcol = &lexmaxfixes[(j - 1) * nrowsused];
       int maxdiscriminating = m;
       int minfixed = -1;
 
@@ -1500,17 +1592,17 @@ SCIP_RETCODE findLexMaxFace(
       for (i = 0; i < nrowsused; ++i)
       {
          /* is row i j-discriminating? */
-         if ( minfixed == -1 && lexmaxfixes[i][j - 1] != 0 && lexmaxfixes[i][j] != 1 )
+         if ( minfixed == -1 && prevcol[i] != 0 && col[i] != 1 )
          {
-            assert( lexmaxfixes[i][j - 1] == 1 );
+            assert( prevcol[i] == 1 );
 
             maxdiscriminating = i;
          }
 
          /* is row i j-fixed? */
-         if ( minfixed == -1 && lexmaxfixes[i][j - 1] != lexmaxfixes[i][j] && lexmaxfixes[i][j] != 2 )
+         if ( minfixed == -1 && prevcol[i] != col[i] && col[i] != 2 )
          {
-            assert( lexmaxfixes[i][j - 1] != 2 );
+            assert( prevcol[i] != 2 );
 
             minfixed = i;
 
@@ -1527,14 +1619,14 @@ SCIP_RETCODE findLexMaxFace(
       /* ensure that column j is lexicographically not greater than column j - 1 */
       for (i = 0; i < nrowsused; ++i)
       {
-         if ( lexmaxfixes[i][j] == 2 )
+         if ( col[i] == 2 )
          {
             if ( i < maxdiscriminating || minfixed == -1 )
-               lexmaxfixes[i][j] = lexmaxfixes[i][j - 1];
+               col[i] = prevcol[i];
             else if ( i == maxdiscriminating )
-               lexmaxfixes[i][j] = 0;
+               col[i] = 0;
             else
-               lexmaxfixes[i][j] = 1;
+               col[i] = 1;
          }
       }
 
@@ -1571,8 +1663,8 @@ SCIP_RETCODE propagateFullOrbitopeCons(
 {
    SCIP_CONSDATA* consdata;
    SCIP_VAR*** vars;
-   int** lexminfixes;
-   int** lexmaxfixes;
+   int* lexminfixes;
+   int* lexmaxfixes;
    int* roworder;
    int nrowsused;
    int i;
@@ -1610,8 +1702,7 @@ SCIP_RETCODE propagateFullOrbitopeCons(
    /* determine order of orbitope rows dynamically by branching decisions */
    if ( dynamic )
    {
-      SCIP_CALL( computeDynamicRowOrder(scip, consdata->rowindexmap, consdata->rowused,
-            consdata->roworder, m, n, &(consdata->nrowsused)) );
+      SCIP_CALL( computeDynamicRowOrder(scip, consdata) );
 
       /* if no branching variable is contained in the full orbitope */
       if ( consdata->nrowsused == 0 )
@@ -1623,89 +1714,48 @@ SCIP_RETCODE propagateFullOrbitopeCons(
       nrowsused = m;
    roworder = consdata->roworder;
 
-   /* Initialize lexicographically minimal matrix by fixed entries at the current node.
-    * Free entries in the last column are set to 0.
+   /* Initialize lexicographically minimal and maximal matrices by fixed entries at the current node.
+    * Free entries in the last column of the lexmin matrix are set to 0 and free entries in the first column
+    * of the lexmax matrix are set to 1.
     */
-   SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes, nrowsused) );
-   for (i = 0; i < nrowsused; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes[i], n) ); /*lint !e866*/
-   }
-
-   for (i = 0; i < nrowsused; ++i)
-   {
-      int origrow;
-
-      origrow = roworder[i];
-
-      for (j = 0; j < n; ++j)
-      {
-         if ( SCIPvarGetLbLocal(vars[origrow][j]) > 0.5 )
-            lexminfixes[i][j] = 1;
-         else if ( SCIPvarGetUbLocal(vars[origrow][j]) < 0.5 || j == n - 1 )
-            lexminfixes[i][j] = 0;
-         else
-            lexminfixes[i][j] = 2;
-      }
-   }
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes, nrowsused * n) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused * n) );
+   initLexFixes(vars, roworder, lexminfixes, lexmaxfixes, n, nrowsused, NULL, FALSE);
 
    /* find lexicographically minimal face of hypercube containing lexmin fixes */
    SCIP_CALL( findLexMinFace(vars, lexminfixes, NULL, infeasible, m, n, nrowsused, FALSE) );
 
    if ( *infeasible == TRUE )
-      goto FREELEXMIN;
-
-   /* Initialize lexicographically maximal matrix by fixed entries at the current node.
-    * Free entries in the first column are set to 1.
-    */
-   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused) );
-   for (i = 0; i < nrowsused; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes[i], n) ); /*lint !e866*/
-   }
-
-   for (i = 0; i < nrowsused; ++i)
-   {
-      int origrow;
-
-      origrow = roworder[i];
-
-      for (j = 0; j < n; ++j)
-      {
-         if ( SCIPvarGetUbLocal(vars[origrow][j]) < 0.5 )
-            lexmaxfixes[i][j] = 0;
-         else if ( SCIPvarGetLbLocal(vars[origrow][j]) > 0.5 || j == 0 )
-            lexmaxfixes[i][j] = 1;
-         else
-            lexmaxfixes[i][j] = 2;
-      }
-   }
+      goto FREE;
 
    /* find lexicographically maximal face of hypercube containing lexmax fixes */
    SCIP_CALL( findLexMaxFace(vars, lexmaxfixes, NULL, infeasible, m, n, nrowsused, FALSE) );
 
    if ( *infeasible )
-      goto FREELEXMAX;
+      goto FREE;
 
    /* Find for each column j the minimal row in which lexminfixes and lexmaxfixes differ. Fix all entries above this
     * row to the corresponding value in lexminfixes (or lexmaxfixes).
     */
    for (j = 0; j < n; ++j)
    {
+      int* mincol = &lexminfixes[j * nrowsused];
+      int* maxcol = &lexmaxfixes[j * nrowsused];
+
       for (i = 0; i < nrowsused; ++i)
       {
          int origrow;
 
          origrow = roworder[i];
 
-         if ( lexminfixes[i][j] != lexmaxfixes[i][j] )
+         if ( mincol[i] != maxcol[i] )
             break;
 
          if ( SCIPvarGetLbLocal(vars[origrow][j]) < 0.5 && SCIPvarGetUbLocal(vars[origrow][j]) > 0.5 )
          {
             SCIP_Bool success;
 
-            SCIP_CALL( SCIPinferBinvarCons(scip, vars[origrow][j], (SCIP_Bool) lexminfixes[i][j],
+            SCIP_CALL( SCIPinferBinvarCons(scip, vars[origrow][j], (SCIP_Bool) mincol[i],
                   cons, 0, infeasible, &success) );
 
             if ( success )
@@ -1714,14 +1764,8 @@ SCIP_RETCODE propagateFullOrbitopeCons(
       }
    }
 
- FREELEXMAX:
-   for (i = 0; i < nrowsused; ++i)
-      SCIPfreeBufferArray(scip, &lexmaxfixes[i]);
+ FREE:
    SCIPfreeBufferArray(scip, &lexmaxfixes);
-
- FREELEXMIN:
-   for (i = 0; i < nrowsused; ++i)
-      SCIPfreeBufferArray(scip, &lexminfixes[i]);
    SCIPfreeBufferArray(scip, &lexminfixes);
 
    return SCIP_OKAY;
@@ -1787,8 +1831,8 @@ SCIP_RETCODE resolvePropagationFullOrbitope(
 {  /*lint --e{715}*/
    SCIP_CONSDATA* consdata;
    SCIP_VAR*** vars;
-   int** lexminfixes;
-   int** lexmaxfixes;
+   int* lexminfixes;
+   int* lexmaxfixes;
    int* roworder;
    int* minfixedrowlexmin;
    int* minfixedrowlexmax;
@@ -1832,77 +1876,31 @@ SCIP_RETCODE resolvePropagationFullOrbitope(
 
    assert( inferinfo <= consdata->nspcons );
 
-   /* Initialize lexicographically minimal matrix by fixed entries at the current node.
-    * Free entries in the last column are set to 0.
+   /* Initialize lexicographically minimal and maximal matrices by fixed entries at the current node.
+    * Free entries in the last column of the lexmin matrix are set to 0 and free entries in the first column
+    * of the lexmax matrix are set to 1.
     */
-   SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes, nrowsused) );
-   for (i = 0; i < nrowsused; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes[i], n) ); /*lint !e866*/
-   }
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes, nrowsused * n) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused * n) );
+   initLexFixes(vars, roworder, lexminfixes, lexmaxfixes, n, nrowsused, bdchgidx, TRUE);
 
    /* store minimum fixed row for each column */
    SCIP_CALL( SCIPallocBufferArray(scip, &minfixedrowlexmin, n) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &minfixedrowlexmax, n) );
    minfixedrowlexmin[n - 1] = -1;
-
-   for (i = 0; i < nrowsused; ++i)
-   {
-      int origrow;
-
-      origrow = roworder[i];
-
-      for (j = 0; j < n; ++j)
-      {
-         if ( SCIPvarGetLbAtIndex(vars[origrow][j], bdchgidx, FALSE) > 0.5 )
-            lexminfixes[i][j] = 1;
-         else if ( SCIPvarGetUbAtIndex(vars[origrow][j], bdchgidx, FALSE) < 0.5 || j == n - 1 )
-            lexminfixes[i][j] = 0;
-         else
-            lexminfixes[i][j] = 2;
-      }
-   }
+   minfixedrowlexmax[0] = -1;
 
    /* find lexicographically minimal face of hypercube containing lexmin fixes */
    SCIP_CALL( findLexMinFace(vars, lexminfixes, minfixedrowlexmin, &terminate, m, n, nrowsused, TRUE) );
 
    if ( terminate )
-      goto FREELEXMIN;
-
-   /* Initialize lexicographically maximal matrix by fixed entries at the current node.
-    * Free entries in the first column are set to 1.
-    */
-   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused) );
-   for (i = 0; i < nrowsused; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes[i], n) ); /*lint !e866*/
-   }
-
-   /* store minimum fixed row for each column */
-   SCIP_CALL( SCIPallocBufferArray(scip, &minfixedrowlexmax, n) );
-   minfixedrowlexmax[0] = -1;
-
-   for (i = 0; i < nrowsused; ++i)
-   {
-      int origrow;
-
-      origrow = roworder[i];
-
-      for (j = 0; j < n; ++j)
-      {
-         if ( SCIPvarGetUbAtIndex(vars[origrow][j], bdchgidx, FALSE) < 0.5 )
-            lexmaxfixes[i][j] = 0;
-         else if ( SCIPvarGetLbAtIndex(vars[origrow][j], bdchgidx, FALSE) > 0.5 || j == 0 )
-            lexmaxfixes[i][j] = 1;
-         else
-            lexmaxfixes[i][j] = 2;
-      }
-   }
+      goto FREE;
 
    /* find lexicographically maximal face of hypercube containing lexmax fixes */
    SCIP_CALL( findLexMaxFace(vars, lexmaxfixes, minfixedrowlexmax, &terminate, m, n, nrowsused, TRUE) );
 
    if ( terminate )
-      goto FREELEXMAX;
+      goto FREE;
 
    /* Find for each column j the minimal row in which lexminfixes and lexmaxfixes differ. Fix all entries above this
     * row to the corresponding value in lexminfixes (or lexmaxfixes).
@@ -1926,16 +1924,10 @@ SCIP_RETCODE resolvePropagationFullOrbitope(
       }
    }
 
- FREELEXMAX:
+ FREE:
    SCIPfreeBufferArray(scip, &minfixedrowlexmax);
-   for (i = 0; i < nrowsused; ++i)
-      SCIPfreeBufferArray(scip, &lexmaxfixes[i]);
-   SCIPfreeBufferArray(scip, &lexmaxfixes);
-
- FREELEXMIN:
    SCIPfreeBufferArray(scip, &minfixedrowlexmin);
-   for (i = 0; i < nrowsused; ++i)
-      SCIPfreeBufferArray(scip, &lexminfixes[i]);
+   SCIPfreeBufferArray(scip, &lexmaxfixes);
    SCIPfreeBufferArray(scip, &lexminfixes);
 
    return SCIP_OKAY;
@@ -2768,7 +2760,11 @@ SCIP_RETCODE separateConstraints(
 }
 
 
-/** check whether all variables in an orbitope constraint are fixed */
+/** check whether all variables in an orbitope constraint are fixed
+ *
+ *  The search starts at the active variable found in the previous call, which usually is still active, such that
+ *  repeated presolving rounds do not scan the fixed part of the orbitope again.
+ */
 static
 SCIP_RETCODE checkRedundantCons(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -2778,10 +2774,10 @@ SCIP_RETCODE checkRedundantCons(
 {
    SCIP_CONSDATA* consdata;
    SCIP_VAR*** vars;
-   int i;
-   int j;
-   int nrows;
+   int nentries;
    int ncols;
+   int pos;
+   int k;
 
    assert( scip != NULL );
    assert( cons != NULL );
@@ -2796,17 +2792,21 @@ SCIP_RETCODE checkRedundantCons(
    assert( consdata->nblocks > 0 );
 
    vars = consdata->vars;
-   nrows = consdata->nspcons;
    ncols = consdata->nblocks;
+   nentries = consdata->nspcons * ncols;
 
    /* check whether there exists an active variable in the orbitope */
-   for (i = 0; i < nrows; ++i)
+   pos = consdata->activepos < nentries ? consdata->activepos : 0;
+   for (k = 0; k < nentries; ++k)
    {
-      for (j = 0; j < ncols; ++j)
+      if ( SCIPvarIsActive(vars[pos / ncols][pos % ncols]) )
       {
-         if ( SCIPvarIsActive(vars[i][j]) )
-            return SCIP_OKAY;
+         consdata->activepos = pos;
+         return SCIP_OKAY;
       }
+
+      if ( ++pos == nentries )
+         pos = 0;
    }
 
    *redundant = TRUE;
@@ -3420,11 +3420,12 @@ SCIP_DECL_CONSPARSE(consParseOrbitope)
    char* endptr;
    SCIP_ORBITOPETYPE orbitopetype;
    SCIP_VAR*** vars;
+   SCIP_VAR** flatvars;
    SCIP_VAR* var;
    int nspcons;
-   int maxnspcons;
    int nblocks;
-   int maxnblocks;
+   int nflatvars;
+   int maxnflatvars;
    int k;
    int j;
 
@@ -3453,90 +3454,94 @@ SCIP_DECL_CONSPARSE(consParseOrbitope)
    }
    s += 13;
 
-   /* loop through string */
+   /* read all variables row by row into one array, such that rows do not need to be allocated separately */
    nspcons = 0;
-   nblocks = 0;
-   maxnspcons = 10;
-   maxnblocks = 10;
-
-   SCIP_CALL( SCIPallocBufferArray(scip, &vars, maxnspcons) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &(vars[0]), maxnblocks) );
+   nblocks = -1;
+   nflatvars = 0;
+   maxnflatvars = 128;
+   SCIP_CALL( SCIPallocBufferArray(scip, &flatvars, maxnflatvars) );
 
    j = 0;
    do
    {
       /* skip whitespace */
-      while ( isspace((int)*s) )
+      while ( isspace((unsigned char)*s) )
          ++s;
 
       /* parse variable name */
       SCIP_CALL( SCIPparseVarName(scip, s, &var, &endptr) );
       if ( var == NULL )
       {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unknown variable name at '%s'\n", str);
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unknown variable name at '%s'\n", s);
          *success = FALSE;
-         return SCIP_OKAY;
+         break;
       }
-      vars[nspcons][j++] = var;
       s = endptr;
 
-      if ( j > nblocks )
+      if ( nflatvars >= maxnflatvars )
       {
-         if ( nspcons > 0 )
-         {
-            SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "variables per row do not match.\n");
-            *success = FALSE;
-            return SCIP_OKAY;
-         }
-         nblocks = j;
-
-         if ( nblocks > maxnblocks )
-         {
-            int newsize;
+         maxnflatvars = SCIPcalcMemGrowSize(scip, nflatvars + 1);
+         SCIP_CALL( SCIPreallocBufferArray(scip, &flatvars, maxnflatvars) );
+      }
+      flatvars[nflatvars++] = var;
+      ++j;
 
-            newsize = SCIPcalcMemGrowSize(scip, nblocks);
-            SCIP_CALL( SCIPreallocBufferArray(scip, &(vars[nspcons]), newsize) );    /*lint !e866*/
-            maxnblocks = newsize;
-         }
+      if ( nblocks >= 0 && j > nblocks )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "variables per row do not match.\n");
+         *success = FALSE;
+         break;
       }
-      assert( nblocks <= maxnblocks );
 
       /* skip white space and ',' */
       while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
          ++s;
 
       /* begin new row if required */
-      if ( *s == '.' )
+      if ( *s == '.' || *s == ')' )
       {
-         ++nspcons;
-         ++s;
-
-         if ( nspcons >= maxnspcons )
+         if ( nblocks < 0 )
+            nblocks = j;
+         else if ( j != nblocks )
          {
-            int newsize;
-
-            newsize = SCIPcalcMemGrowSize(scip, nspcons+1);
-            SCIP_CALL( SCIPreallocBufferArray(scip, &vars, newsize) );
-            maxnspcons = newsize;
+            SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "variables per row do not match.\n");
+            *success = FALSE;
+            break;
          }
-         assert(nspcons < maxnspcons);
-
-         SCIP_CALL( SCIPallocBufferArray(scip, &(vars[nspcons]), nblocks) );  /*lint !e866*/
+         ++nspcons;
          j = 0;
+
+         if ( *s == '.' )
+            ++s;
+      }
+      else if ( *s == '\0' )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unexpected end of orbitope constraint\n");
+         *success = FALSE;
+         break;
       }
    }
    while ( *s != ')' );
-   ++nspcons;
 
-   /* to ensure consistency, we disable dynamic propagation and tell SCIP that the orbitope could potentially
-    * interact with other symmetry handling constraints
-    */
-   SCIP_CALL( SCIPcreateConsOrbitope(scip, cons, name, vars, orbitopetype, nspcons, nblocks, FALSE, TRUE, TRUE, FALSE,
-         initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode) );
+   if ( *success )
+   {
+      assert( nblocks > 0 );
+      assert( nspcons * nblocks == nflatvars );
 
-   for (k = nspcons - 1; k >= 0; --k)
-      SCIPfreeBufferArray(scip, &vars[k]);
-   SCIPfreeBufferArray(scip, &vars);
+      /* let the rows point into the array of all variables */
+      SCIP_CALL( SCIPallocBufferArray(scip, &vars, nspcons) );
+      for (k = 0; k < nspcons; ++k)
+         vars[k] = &flatvars[k * nblocks];
+
+      /* to ensure consistency, we disable dynamic propagation and tell SCIP that the orbitope could potentially
+       * interact with other symmetry handling constraints
+       */
+      SCIP_CALL( SCIPcreateConsOrbitope(scip, cons, name, vars, orbitopetype, nspcons, nblocks, FALSE, TRUE, TRUE, FALSE,
+            initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable, stickingatnode) );
+
+      SCIPfreeBufferArray(scip, &vars);
+   }
+   SCIPfreeBufferArray(scip, &flatvars);
 
    return SCIP_OKAY;
 }
@@ -62,6 +62,7 @@
 #include "scip/scip_conflict.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_cut.h"
+#include "scip/scip_event.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -71,6 +72,7 @@
 #include "scip/scip_prob.h"
 #include "scip/scip_sol.h"
 #include "scip/scip_var.h"
+#include "permutation.h"
 #include <ctype.h>
 #include <string.h>
 
@@ -95,6 +97,11 @@
 #define DEFAULT_PPSYMRESACK        TRUE /**< whether we allow upgrading to packing/partitioning symresacks */
 #define DEFAULT_CHECKMONOTONICITY  TRUE /**< check whether permutation is monotone when upgrading to packing/partitioning symresacks */
 #define DEFAULT_FORCECONSCOPY     FALSE /**< whether symresack constraints should be forced to be copied to sub SCIPs */
+#define DEFAULT_DYNAMICEVENTS      TRUE /**< whether bound change events are only caught for the variables the last propagation depended on */
+
+/* event handler properties */
+#define EVENTHDLR_SYMRESACK_NAME    "symresack"
+#define EVENTHDLR_SYMRESACK_DESC    "mark symresack constraint for propagation"
 
 /* Constants to store fixings */
 #define FIXED0    1                     /* When a variable is fixed to 0. */
@@ -118,6 +125,8 @@ struct SCIP_ConshdlrData
    SCIP_Bool             checkmonotonicity;  /**< check whether permutation is monotone when upgrading to packing/partitioning symresacks */
    int                   maxnvars;           /**< maximal number of variables in a symresack constraint */
    SCIP_Bool             forceconscopy;      /**< whether symresack constraints should be forced to be copied to sub SCIPs */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for deciding whether a constraint must be propagated */
+   SCIP_Bool             dynamicevents;      /**< whether bound change events are only caught for the variables the last propagation depended on */
 };
 
 
@@ -139,6 +148,20 @@ struct SCIP_ConsData
    int**                 cycledecomposition; /**< cycle decomposition */
    int                   ndescentpoints;     /**< number of descent points in perm (only used if perm is not monotone) */
    int*                  descentpoints;      /**< descent points in perm (only used if perm is not monotone) */
+   SCIP_EVENTDATA*       vareventdata;       /**< event data for each variable, or NULL if not transformed */
+   int*                  catchorder;         /**< variables in the order of the first row (i, invperm[i]) containing them, or NULL */
+   int*                  catchends;          /**< for each row r, the number of variables contained in rows 0, ..., r, or NULL */
+   int                   ncaught;            /**< the bound change events of catchorder[0], ..., catchorder[ncaught-1] are caught */
+   int                   proprows;           /**< number of leading rows on which the outcome of the last propagation depends */
+   SCIP_Bool             execprop;           /**< whether the constraint must be propagated again */
+};
+
+/** event data for the bound change events of the variables of a symresack constraint */
+struct SCIP_EventData
+{
+   SCIP_CONSDATA*        consdata;           /**< constraint data of the constraint */
+   int                   varid;              /**< index of the variable in consdata->vars */
+   int                   filterpos;          /**< position in the event filter of the variable, or -1 if not caught */
 };
 
 
@@ -146,6 +169,123 @@ struct SCIP_ConsData
  * Local methods
  */
 
+/** initializes the event related data of a symresack constraint, such that no events are caught */
+static
+void consdataInitEvents(
+   SCIP_CONSDATA*        consdata            /**< symresack constraint data */
+   )
+{
+   assert( consdata != NULL );
+
+   consdata->vareventdata = NULL;
+   consdata->catchorder = NULL;
+   consdata->catchends = NULL;
+   consdata->ncaught = 0;
+   consdata->proprows = 0;
+   consdata->execprop = TRUE;
+}
+
+
+/** catches the bound change events of all variables of a transformed symresack constraint
+ *
+ *  The propagation of a symresack only depends on the leading rows (i, invperm[i]) up to the row at which the
+ *  lexicographic comparison is decided. The variables are therefore ordered by the first row that contains them, such
+ *  that the variables of every row prefix are a prefix of catchorder.
+ */
+static
+SCIP_RETCODE consdataCatchEvents(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< symresack event handler */
+   SCIP_CONSDATA*        consdata            /**< symresack constraint data */
+   )
+{
+   int nvars;
+   int norder = 0;
+   int r;
+
+   assert( scip != NULL );
+   assert( eventhdlr != NULL );
+   assert( consdata != NULL );
+   assert( consdata->vareventdata == NULL );
+
+   nvars = consdata->nvars;
+   assert( nvars > 0 );
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->vareventdata, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->catchorder, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->catchends, nvars) );
+
+   /* variable j is contained in rows j and perm[j], so it is first contained in row min(j, perm[j]) */
+   for (r = 0; r < nvars; ++r)
+   {
+      if ( consdata->perm[r] > r )
+         consdata->catchorder[norder++] = r;
+      if ( consdata->invperm[r] > r )
+         consdata->catchorder[norder++] = consdata->invperm[r];
+      consdata->catchends[r] = norder;
+   }
+   assert( norder == nvars );
+
+   for (r = 0; r < nvars; ++r)
+   {
+      SCIP_EVENTDATA* eventdata;
+
+      eventdata = &consdata->vareventdata[consdata->catchorder[r]];
+      eventdata->consdata = consdata;
+      eventdata->varid = consdata->catchorder[r];
+      SCIP_CALL( SCIPcatchVarEvent(scip, consdata->vars[eventdata->varid], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr,
+            eventdata, &eventdata->filterpos) );
+   }
+   consdata->ncaught = nvars;
+   consdata->proprows = nvars;
+   consdata->execprop = TRUE;
+
+   return SCIP_OKAY;
+}
+
+
+/** catches the bound change events of the variables in the rows on which the last propagation depended
+ *
+ *  If dynamic events are disabled, events that are no longer needed remain caught.
+ */
+static
+SCIP_RETCODE updateEventCatching(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EVENTHDLR*       eventhdlr,          /**< symresack event handler */
+   SCIP_CONSDATA*        consdata,           /**< symresack constraint data */
+   SCIP_Bool             dynamicevents       /**< whether events that are no longer needed are dropped */
+   )
+{
+   SCIP_EVENTDATA* eventdata;
+   int needed;
+
+   assert( scip != NULL );
+   assert( eventhdlr != NULL );
+   assert( consdata != NULL );
+   assert( consdata->vareventdata != NULL );
+   assert( 0 <= consdata->proprows && consdata->proprows <= consdata->nvars );
+
+   needed = consdata->proprows > 0 ? consdata->catchends[consdata->proprows - 1] : 0;
+
+   while ( consdata->ncaught < needed )
+   {
+      eventdata = &consdata->vareventdata[consdata->catchorder[consdata->ncaught++]];
+      SCIP_CALL( SCIPcatchVarEvent(scip, consdata->vars[eventdata->varid], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr,
+            eventdata, &eventdata->filterpos) );
+   }
+
+   while ( dynamicevents && consdata->ncaught > needed )
+   {
+      eventdata = &consdata->vareventdata[consdata->catchorder[--consdata->ncaught]];
+      SCIP_CALL( SCIPdropVarEvent(scip, consdata->vars[eventdata->varid], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr,
+            eventdata, eventdata->filterpos) );
+      eventdata->filterpos = -1;
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** frees a symresack constraint data */
 static
 SCIP_RETCODE consdataFree(
@@ -174,6 +314,26 @@ SCIP_RETCODE consdataFree(
       return SCIP_OKAY;
    }
 
+   if ( (*consdata)->vareventdata != NULL )
+   {
+      SCIP_EVENTHDLR* eventhdlr;
+
+      eventhdlr = SCIPfindEventhdlr(scip, EVENTHDLR_SYMRESACK_NAME);
+      assert( eventhdlr != NULL );
+
+      for (i = 0; i < (*consdata)->ncaught; ++i)
+      {
+         SCIP_EVENTDATA* eventdata;
+
+         eventdata = &(*consdata)->vareventdata[(*consdata)->catchorder[i]];
+         SCIP_CALL( SCIPdropVarEvent(scip, (*consdata)->vars[eventdata->varid], SCIP_EVENTTYPE_BOUNDCHANGED, eventhdlr,
+               eventdata, eventdata->filterpos) );
+      }
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->catchends), nvars);
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->catchorder), nvars);
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->vareventdata), nvars);
+   }
+
    if ( (*consdata)->ndescentpoints > 0 )
    {
       assert( (*consdata)->descentpoints != NULL );
@@ -494,6 +654,7 @@ SCIP_RETCODE consdataCreate(
    (*consdata)->ndescentpoints = 0;
    (*consdata)->descentpoints = NULL;
    (*consdata)->ismodelcons = ismodelcons;
+   consdataInitEvents(*consdata);
 
    /* count the number of binary variables which are affected by the permutation */
    SCIP_CALL( SCIPallocBufferArray(scip, &indexcorrection, inputnvars) );
@@ -586,6 +747,8 @@ SCIP_RETCODE consdataCreate(
          SCIP_CALL( SCIPgetTransformedVar(scip, (*consdata)->vars[i], &(*consdata)->vars[i]) );
          SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, (*consdata)->vars[i]) );
       }
+
+      SCIP_CALL( consdataCatchEvents(scip, conshdlrdata->eventhdlr, *consdata) );
    }
 
    return SCIP_OKAY;
@@ -816,7 +979,8 @@ SCIP_RETCODE checkFeasible(
    int*                  tempfixentries,     /**< the entries i that are virtually fixed until numfixentriesinit */
    int                   numfixentriesinit,  /**< the number of virtually fixed entries */
    SCIP_Bool*            infeasible,         /**< pointer to store whether infeasibility is detected in these fixings */
-   int*                  infeasibleentry     /**< pointer to store at which entry a (0, 1) pattern is found */
+   int*                  infeasibleentry,    /**< pointer to store at which entry a (0, 1) pattern is found */
+   int*                  lastrow             /**< pointer to store the last row that was looked at */
 )
 {
    SCIP_VAR* var1;
@@ -827,6 +991,9 @@ SCIP_RETCODE checkFeasible(
    int i;
    int numfixentries;
 
+   assert( lastrow != NULL );
+   *lastrow = nvars - 1;
+
    /* avoid trivial problems */
    if ( nvars < 2 )
       return SCIP_OKAY;
@@ -914,6 +1081,8 @@ SCIP_RETCODE checkFeasible(
       /* Remaining cases are (0, 0) and (1, 1). In both cases: continue. */
    }
 
+   *lastrow = MIN(i, nvars - 1);
+
    /* Undo virtual fixings made in this function */
    for (i = numfixentriesinit; i < numfixentries; ++i)
    {
@@ -931,12 +1100,15 @@ SCIP_RETCODE propVariables(
    SCIP*                 scip,               /**< SCIP pointer */
    SCIP_CONS*            cons,               /**< constraint to be propagated */
    SCIP_Bool*            infeasible,         /**< pointer to store whether it was detected that the node is infeasible */
-   int*                  ngen                /**< pointer to store number of generated bound strengthenings */
+   int*                  ngen,               /**< pointer to store number of generated bound strengthenings */
+   int*                  proprows            /**< pointer to store the number of leading rows on which the outcome depends, or NULL */
    )
 {
    SCIP_CONSDATA* consdata;
    SCIP_VAR** vars;
    int* invperm;
+   int lastrow;
+   int peeklastrow;
    int nvars;
    int i;
    int r;
@@ -965,6 +1137,9 @@ SCIP_RETCODE propVariables(
    assert( consdata != NULL );
    nvars = consdata->nvars;
 
+   if ( proprows != NULL )
+      *proprows = nvars;
+
    /* avoid trivial problems */
    if ( nvars < 2 )
       return SCIP_OKAY;
@@ -974,6 +1149,9 @@ SCIP_RETCODE propVariables(
    vars = consdata->vars;
    invperm = consdata->invperm;
 
+   /* if no row decides the comparison, all rows are looked at */
+   lastrow = nvars - 1;
+
    /* loop through all variables */
    for (i = 0; i < nvars; ++i)
    {
@@ -1017,6 +1195,9 @@ SCIP_RETCODE propVariables(
          SCIPdebugMsg(scip, "Check variable pair (%d,%d).\n", i, invperm[i]);
          SCIPdebugMsg(scip, " -> node is feasible (could set pair to (1,0) and every earlier pair is constant).\n");
 
+         /* the outcome depends on the rows up to this one and on the rows looked at by peeking */
+         lastrow = i;
+
          if ( var1fix == UNFIXED || var2fix == UNFIXED )
          {
             /* Create arrays tempfixings and tempfixentries to store virtual fixings. */
@@ -1032,7 +1213,8 @@ SCIP_RETCODE propVariables(
                tempfixings[i] = FIXED0;
                tempfixentries[0] = i;
                SCIP_CALL( checkFeasible(scip, vars, invperm, nvars, i, tempfixings, tempfixentries, 1,
-                     &peekinfeasible, &peekinfeasibleentry) );
+                     &peekinfeasible, &peekinfeasibleentry, &peeklastrow) );
+               lastrow = MAX(lastrow, peeklastrow);
 
                if ( peekinfeasible )
                {
@@ -1059,7 +1241,8 @@ SCIP_RETCODE propVariables(
                tempfixings[invperm[i]] = FIXED1;
                tempfixentries[0] = invperm[i];
                SCIP_CALL( checkFeasible(scip, vars, invperm, nvars, i, tempfixings, tempfixentries, 1,
-                     &peekinfeasible, &peekinfeasibleentry) );
+                     &peekinfeasible, &peekinfeasibleentry, &peeklastrow) );
+               lastrow = MAX(lastrow, peeklastrow);
 
                if ( peekinfeasible )
                {
@@ -1109,6 +1292,7 @@ SCIP_RETCODE propVariables(
          }
 
          *infeasible = TRUE;
+         lastrow = i;
          break;
       }
       /* Encounter (0, _): Fix second part to 0 */
@@ -1146,6 +1330,9 @@ SCIP_RETCODE propVariables(
       /* Remaining cases are (0, 0) and (1, 1). In these cases we can continue! */
    }
 
+   if ( proprows != NULL )
+      *proprows = lastrow + 1;
+
    return SCIP_OKAY;
 }
 
@@ -1433,6 +1620,9 @@ SCIP_RETCODE maximizeObjectiveSymresackCriticalEntry(
 
 
 /** separate symresack cover inequalities
+ *
+ *  The sum of the positive objective coefficients bounds the maximal violation, so the oracles are only called if this
+ *  bound is efficacious, and a maximally violated cover is only computed if the critical entry yields a violated cover.
  *
  *  We currently do NOT enter cuts into the pool.
  */
@@ -1447,6 +1637,7 @@ SCIP_RETCODE separateSymresackCovers(
    )
 {
    SCIP_Real constobjective;
+   SCIP_Real posobjective = 0.0;
    SCIP_Real* sepaobjective;
    SCIP_Real maxsoluobj = 0.0;
    int* maxsolu;
@@ -1489,6 +1680,16 @@ SCIP_RETCODE separateSymresackCovers(
          sepaobjective[i] = 1.0 - vals[i];
          constobjective += vals[i] - 1.0;
       }
+
+      if ( SCIPisGT(scip, sepaobjective[i], 0.0) )
+         posobjective += sepaobjective[i];
+   }
+
+   /* no cover can be violated */
+   if ( ! SCIPisEfficacious(scip, posobjective + constobjective) )
+   {
+      SCIPfreeBufferArray(scip, &sepaobjective);
+      return SCIP_OKAY;
    }
 
    /* allocate memory for temporary and global solution */
@@ -1497,8 +1698,6 @@ SCIP_RETCODE separateSymresackCovers(
    /* Find critical row of a maximally violated cover */
    SCIP_CALL( maximizeObjectiveSymresackStrict(scip, nvars, sepaobjective, perm, invperm, &maxcrit, &maxsoluobj) );
    assert( maxcrit >= 0 );
-   SCIPdebugMsg(scip, "Critical row %d found; Computing maximally violated cover.\n", maxcrit);
-   SCIP_CALL( maximizeObjectiveSymresackCriticalEntry(scip, nvars, sepaobjective, perm, invperm, maxcrit, maxsolu) );
 
    /* Add constant to maxsoluobj to get the real objective */
    maxsoluobj += constobjective;
@@ -1506,6 +1705,9 @@ SCIP_RETCODE separateSymresackCovers(
    /* Check whether the separation objective is positive, i.e., a violated cover was found. */
    if ( SCIPisEfficacious(scip, maxsoluobj) )
    {
+      SCIPdebugMsg(scip, "Critical row %d found; Computing maximally violated cover.\n", maxcrit);
+      SCIP_CALL( maximizeObjectiveSymresackCriticalEntry(scip, nvars, sepaobjective, perm, invperm, maxcrit, maxsolu) );
+
       /* Now add the cut. Reuse array maxsolu as coefficient vector for the constraint. */
       SCIP_Real rhs = -1.0;
       for (i = 0; i < nvars; ++i)
@@ -1546,6 +1748,8 @@ SCIP_RETCODE checkSymresackSolution(
 {
    SCIP_CONSDATA* consdata;
    SCIP_VAR** vars;
+   SCIP_Real* vals;
+   uint64_t* packedsol;
    int* invperm;
    int nvars;
    int i;
@@ -1567,49 +1771,36 @@ SCIP_RETCODE checkSymresackSolution(
    vars = consdata->vars;
    invperm = consdata->invperm;
 
-   /* detect first non-constant pair of variables */
+   /* get the solution values once, and pack them such that the comparison can be done word-wise */
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &packedsol, PACKEDNWORDS(nvars)) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, nvars, vars, vals) );
+#ifndef NDEBUG
    for (i = 0; i < nvars; ++i)
    {
-      SCIP_Real solval;
-      int val1;
-      int val2;
-
       /* there are no fixed points */
       assert( invperm[i] != i );
+      assert( SCIPisFeasIntegral(scip, vals[i]) );
+   }
+#endif
+   packBinaryVector(vals, nvars, packedsol);
 
-      /* get value of variable i and its inverse */
-      solval = SCIPgetSolVal(scip, sol, vars[i]);
-      assert( SCIPisFeasIntegral(scip, solval) );
-      if ( solval > 0.5 )
-         val1 = 1;
-      else
-         val1 = 0;
-
-      solval = SCIPgetSolVal(scip, sol, vars[invperm[i]]);
-      assert( SCIPisFeasIntegral(scip, solval) );
-      if ( solval > 0.5 )
-         val2 = 1;
-      else
-         val2 = 0;
-
-      /* if we detected a constant pair */
-      if ( val1 == val2 )
-         continue;
-      /* pair is (1,0) --> lexicographically maximal */
-      else if ( val1 > val2 )
-         break;
+   /* detect first non-constant pair of variables */
+   i = findFirstPackedDifference(packedsol, invperm, nvars);
 
-      /* pair is (0,1) --> solution is infeasible */
-      assert( val2 > val1 );
+   /* pair is (0,1) --> solution is infeasible; otherwise all pairs are constant or the first is (1,0) */
+   if ( i >= 0 && (packedsol[PACKEDWORD(i)] & PACKEDMASK(i)) == 0 )
+   {
       SCIPdebugMsg(scip, "Solution is infeasible.\n");
       *result = SCIP_INFEASIBLE;
 
       if ( printreason )
          SCIPinfoMessage(scip, NULL, "First non-constant pair (%d, %d) of variables has pattern (0,1).\n", i, invperm[i]);
-
-      break;
    }
 
+   SCIPfreeBufferArray(scip, &packedsol);
+   SCIPfreeBufferArray(scip, &vals);
+
    return SCIP_OKAY;
 }
 
@@ -1796,6 +1987,32 @@ SCIP_DECL_CONSHDLRCOPY(conshdlrCopySymresack)
 }
 
 
+/** execution method of the event handler, marking a constraint for propagation if a variable in one of the rows on
+ *  which the last propagation depended changes its bounds
+ */
+static
+SCIP_DECL_EVENTEXEC(eventExecSymresack)
+{  /*lint --e{715}*/
+   SCIP_CONSDATA* consdata;
+   int varid;
+
+   assert( eventhdlr != NULL );
+   assert( eventdata != NULL );
+   assert( strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_SYMRESACK_NAME) == 0 );
+   assert( event != NULL );
+
+   consdata = eventdata->consdata;
+   assert( consdata != NULL );
+   varid = eventdata->varid;
+
+   /* variable varid is first contained in row min(varid, perm[varid]) */
+   if ( MIN(varid, consdata->perm[varid]) < consdata->proprows )
+      consdata->execprop = TRUE;
+
+   return SCIP_OKAY;
+}
+
+
 /** frees specific constraint data */
 static
 SCIP_DECL_CONSDELETE(consDeleteSymresack)
@@ -1834,6 +2051,7 @@ SCIP_DECL_CONSFREE(consFreeSymresack)
 static
 SCIP_DECL_CONSTRANS(consTransSymresack)
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* sourcedata;
    SCIP_CONSDATA* consdata = NULL;
    int nvars;
@@ -1890,6 +2108,7 @@ SCIP_DECL_CONSTRANS(consTransSymresack)
    consdata->cycledecomposition = NULL;
    consdata->ndescentpoints = 0;
    consdata->descentpoints = NULL;
+   consdataInitEvents(consdata);
 
    if ( nvars > 0 )
    {
@@ -1927,6 +2146,10 @@ SCIP_DECL_CONSTRANS(consTransSymresack)
          SCIP_CALL( SCIPgetTransformedVar(scip, consdata->vars[i], &consdata->vars[i]) );
          SCIP_CALL( SCIPmarkDoNotMultaggrVar(scip, consdata->vars[i]) );
       }
+
+      conshdlrdata = SCIPconshdlrGetData(conshdlr);
+      assert( conshdlrdata != NULL );
+      SCIP_CALL( consdataCatchEvents(scip, conshdlrdata->eventhdlr, consdata) );
    }
 
    /* create transformed constraint */
@@ -2398,6 +2621,8 @@ SCIP_DECL_CONSCHECK(consCheckSymresack)
 static
 SCIP_DECL_CONSPROP(consPropSymresack)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
    int c;
    SCIP_Bool success = FALSE;
 
@@ -2410,15 +2635,26 @@ SCIP_DECL_CONSPROP(consPropSymresack)
 
    SCIPdebugMsg(scip, "Propagation method of symresack constraint handler.\n");
 
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
    /* loop through constraints */
    for (c = 0; c < nconss; ++c)
    {
       SCIP_Bool infeasible = FALSE;
       int ngen = 0;
+      int proprows;
 
       assert( conss[c] != NULL );
 
-      SCIP_CALL( propVariables(scip, conss[c], &infeasible, &ngen) );
+      consdata = SCIPconsGetData(conss[c]);
+      assert( consdata != NULL );
+
+      /* only propagate if a variable of the rows the last propagation depended on has changed */
+      if ( consdata->vareventdata != NULL && !consdata->execprop )
+         continue;
+
+      SCIP_CALL( propVariables(scip, conss[c], &infeasible, &ngen, &proprows) );
 
       if ( infeasible )
       {
@@ -2426,6 +2662,14 @@ SCIP_DECL_CONSPROP(consPropSymresack)
          return SCIP_OKAY;
       }
 
+      /* the propagation has reached a fixpoint, so it only needs to be repeated if these rows change */
+      if ( consdata->vareventdata != NULL )
+      {
+         consdata->proprows = proprows;
+         consdata->execprop = FALSE;
+         SCIP_CALL( updateEventCatching(scip, conshdlrdata->eventhdlr, consdata, conshdlrdata->dynamicevents) );
+      }
+
       success = success || ( ngen > 0 );
 
       *result = SCIP_DIDNOTFIND;
@@ -2479,7 +2723,7 @@ SCIP_DECL_CONSPRESOL(consPresolSymresack)
       }
       else
       {
-         SCIP_CALL( propVariables(scip, conss[c], &infeasible, &ngen) );
+         SCIP_CALL( propVariables(scip, conss[c], &infeasible, &ngen, NULL) );
       }
 
       if ( infeasible )
@@ -2798,15 +3042,9 @@ static
 SCIP_DECL_CONSPARSE(consParseSymresack)
 {  /*lint --e{715}*/
    const char* s;
-   char* endptr;
    SCIP_VAR** vars;
-   SCIP_VAR* var;
    int* perm;
-   int val;
-   int nvars = 0;
-   int cnt = 0;
-   int nfoundpermidx = 0;
-   int maxnvars = 128;
+   int nvars;
 
    assert( success != NULL );
 
@@ -2825,119 +3063,12 @@ SCIP_DECL_CONSPARSE(consParseSymresack)
    }
    s += 10;
 
-   /* loop through string */
-   SCIP_CALL( SCIPallocBufferArray(scip, &vars, maxnvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &perm, maxnvars) );
-
-   do
-   {
-      if ( cnt > 1 )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected two arrays, but got more\n");
-         *success = FALSE;
-
-         SCIPfreeBufferArray(scip, &perm);
-         SCIPfreeBufferArray(scip, &vars);
-      }
-
-      /* skip whitespace and ',' */
-      while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-         ++s;
-
-      /* if we could not find starting indicator of array */
-      if ( *s != '[' )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected '[' to start new array\n");
-         *success = FALSE;
-
-         SCIPfreeBufferArray(scip, &perm);
-         SCIPfreeBufferArray(scip, &vars);
-      }
-      ++s;
-
-      /* read array, cnt = 0: variables; cnt = 1: permutation*/
-      if ( cnt == 0 )
-      {
-         do
-         {
-            /* skip whitespace and ',' */
-            while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-               ++s;
-
-            /* parse variable name */
-            SCIP_CALL( SCIPparseVarName(scip, s, &var, &endptr) );
-            if ( var == NULL )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unknown variable name at '%s'\n", str);
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-            s = endptr;
-            assert( s != NULL );
-
-            vars[nvars++] = var;
-
-            if ( nvars >= maxnvars )
-            {
-               int newsize;
-
-               newsize = SCIPcalcMemGrowSize(scip, nvars + 1);
-               SCIP_CALL( SCIPreallocBufferArray(scip, &vars, newsize) );
-               SCIP_CALL( SCIPreallocBufferArray(scip, &perm, newsize) );
-               maxnvars = newsize;
-            }
-         }
-         while ( *s != ']' );
-      }
-      else
-      {
-         do
-         {
-            /* skip whitespace and ',' */
-            while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-               ++s;
-
-            /* parse integer value */
-            if ( ! SCIPstrToIntValue(s, &val, &endptr) )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "could not extract int from string '%s'\n", str);
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &perm);
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-            s = endptr;
-            assert( s != NULL );
-
-            perm[nfoundpermidx++] = val;
-
-            if ( nfoundpermidx > nvars )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "permutation is longer than vars array\n");
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &perm);
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-         }
-         while ( *s != ']' );
-      }
-      ++s;
-      ++cnt;
-   }
-   while ( *s != ')' );
+   /* read variables and permutation in one pass, the permutation is checked to be a bijection */
+   SCIP_CALL( SCIPparsePermutationArrays(scip, s, &vars, &perm, &nvars, success) );
+   if ( ! *success )
+      return SCIP_OKAY;
 
-   if ( nfoundpermidx == nvars )
-   {
-      SCIP_CALL( SCIPcreateConsBasicSymresack(scip, cons, name, perm, vars, nvars, FALSE) );
-   }
-   else
-   {
-      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL,
-         "Length of permutation is not equal to number of given variables.\n");
-      *success = FALSE;
-   }
+   SCIP_CALL( SCIPcreateConsBasicSymresack(scip, cons, name, perm, vars, nvars, FALSE) );
 
    SCIPfreeBufferArray(scip, &perm);
    SCIPfreeBufferArray(scip, &vars);
@@ -2954,10 +3085,6 @@ static
 SCIP_DECL_CONSPRINT(consPrintSymresack)
 {  /*lint --e{715}*/
    SCIP_CONSDATA* consdata;
-   SCIP_VAR** vars;
-   int* perm;
-   int nvars;
-   int i;
 
    assert( scip != NULL );
    assert( conshdlr != NULL );
@@ -2976,22 +3103,9 @@ SCIP_DECL_CONSPRINT(consPrintSymresack)
    assert( consdata->vars != NULL );
    assert( consdata->perm != NULL );
 
-   vars = consdata->vars;
-   nvars = consdata->nvars;
-   perm = consdata->perm;
-
-   SCIPinfoMessage(scip, file, "symresack([");
-   SCIP_CALL( SCIPwriteVarName(scip, file, vars[0], TRUE) );
-
-   for (i = 1; i < nvars; ++i)
-   {
-      SCIPinfoMessage(scip, file, ",");
-      SCIP_CALL( SCIPwriteVarName(scip, file, vars[i], TRUE) );
-   }
-   SCIPinfoMessage(scip, file, "],[%d", perm[0]);
-   for (i = 1; i < nvars; ++i)
-      SCIPinfoMessage(scip, file, ",%d", perm[i]);
-   SCIPinfoMessage(scip, file, "])");
+   SCIPinfoMessage(scip, file, "symresack(");
+   SCIP_CALL( SCIPwritePermutationArrays(scip, file, consdata->vars, consdata->perm, consdata->nvars) );
+   SCIPinfoMessage(scip, file, ")");
 
    return SCIP_OKAY;
 }
@@ -3080,6 +3194,12 @@ SCIP_RETCODE SCIPincludeConshdlrSymresack(
    SCIP_CALL( SCIPsetConshdlrInitlp(scip, conshdlr, consInitlpSymresack) );
    SCIP_CALL( SCIPsetConshdlrInitsol(scip, conshdlr, consInitsolSymresack) );
 
+   /* include event handler */
+   conshdlrdata->eventhdlr = NULL;
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &conshdlrdata->eventhdlr, EVENTHDLR_SYMRESACK_NAME,
+         EVENTHDLR_SYMRESACK_DESC, eventExecSymresack, NULL) );
+   assert( conshdlrdata->eventhdlr != NULL );
+
    /* whether we allow upgrading to packing/partioning symresack constraints*/
    SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/ppsymresack",
          "Upgrade symresack constraints to packing/partioning symresacks?",
@@ -3094,6 +3214,10 @@ SCIP_RETCODE SCIPincludeConshdlrSymresack(
          "Whether symresack constraints should be forced to be copied to sub SCIPs.",
          &conshdlrdata->forceconscopy, TRUE, DEFAULT_FORCECONSCOPY, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/dynamicevents",
+         "Whether bound change events are only caught for the variables on which the last propagation depended.",
+         &conshdlrdata->dynamicevents, TRUE, DEFAULT_DYNAMICEVENTS, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
@@ -75,6 +75,25 @@
 #define DEFAULT_SYMRETOPEMAXORDERNVARS 5000000 /**< Maximal group order * number of vars in symretope support. */
 #define DEFAULT_SEPAALLVIOLPERMS   TRUE /**< Whether all violating permutations should be separated, or only the first */
 #define DEFAULT_PROBINGPEEK       FALSE /**< Whether peeking should be done during probing. */
+#define DEFAULT_POWTABLEMEMLIMIT     64 /**< Maximal memory (in MB) for tabulating the permutation powers of a symretope. */
+#define DEFAULT_INCREMENTALPROP    TRUE /**< Whether propagation only re-evaluates the powers affected by bound changes. */
+#define DEFAULT_PROPCACHEMEMLIMIT     0 /**< Maximal memory (in MB) of the cache of propagation outcomes (0: no caching). */
+#define DEFAULT_GROUPPROP         FALSE /**< Whether constraints sharing variables are propagated group-wise until a fixpoint. */
+#define DEFAULT_MEMORYBUDGET         -1 /**< Memory budget (in MB) of all symretope constraints (-1: a share of limits/memory, 0: none). */
+#define DEFAULT_PEEKBUDGET           -1 /**< Maximal number of tentative fixings tested by peeking per propagation call (-1: no limit). */
+#define DEFAULT_DYNAMICEVENTS      TRUE /**< Whether local bound change events are only caught for the affected entries. */
+
+/* memory budget */
+#define MEMBUDGETLIMITSHARE         0.1 /**< Share of limits/memory used as the memory budget if none is given. */
+#define NPOWBENEFITBUCKETS           32 /**< Number of buckets [2^b, 2^(b+1)) of powers to record the fixings in. */
+#define MINPOWBENEFITFIXINGS        100 /**< Minimal number of recorded fixings before powers are limited by their benefit. */
+#define MINPOWBENEFITSHARE         0.01 /**< Minimal share of the recorded fixings for a bucket of powers to be handled. */
+
+/* statistics table properties */
+#define TABLE_NAME_SYMRETOPE        "symretope"
+#define TABLE_DESC_SYMRETOPE        "symretope constraint handler statistics"
+#define TABLE_POSITION_SYMRETOPE    7002                    /**< the position of the statistics table */
+#define TABLE_EARLIEST_SYMRETOPE    SCIP_STAGE_SOLVING      /**< output of the statistics table is only printed from this stage onwards */
 
 /* event handler properties */
 #define EVENTHDLR_SYMRETOPE_NAME    "symretope"
@@ -93,6 +112,27 @@
  * Data structures
  */
 
+typedef struct SCIP_SymretopeArena SCIP_SYMRETOPEARENA;
+typedef struct SCIP_SymretopeCache SCIP_SYMRETOPECACHE;
+typedef struct SCIP_SymretopeVirtualFixings SCIP_SYMRETOPEVIRTUALFIXINGS;
+
+/** propagation kernel of a symretope constraint, selected once per constraint in consdataCreate()
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - cons            : constraint to be propagated
+ *  - virtualfixings  : virtual fixings structure, or NULL if fixings are to be applied globally
+ *  - useproblembounds: whether the bounds of the problem must be used, in addition to the virtual fixings
+ *  - checkedentries  : for each variable index, whether their value has been looked up, or NULL
+ *  - findcompleteset : whether the complete set of fixings is sought after (by peeking), or feasibility only
+ *  - incremental     : whether only permutations affected by changed entries may be evaluated
+ *  - infeasible      : pointer to store whether it was detected that the node is infeasible
+ *  - ngen            : pointer to increase by the number of generated bound strengthenings
+ */
+#define SCIP_DECL_SYMRETOPEPROPKERNEL(x) SCIP_RETCODE x (SCIP* scip, SCIP_CONS* cons, \
+   SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixings, SCIP_Bool useproblembounds, SCIP_Bool* checkedentries, \
+   SCIP_Bool findcompleteset, SCIP_Bool incremental, SCIP_Bool* infeasible, int* ngen)
+
 /** constraint handler data */
 struct SCIP_ConshdlrData
 {
@@ -103,7 +143,37 @@ struct SCIP_ConshdlrData
    int                   maxordernvars;      /**< maximal group order for symretope multiplied with group support size */
    SCIP_Bool             sepaallviolperms;   /**< Whether a separating inequality should be added only for one violated symresack (FALSE) or for all violating symresacks (TRUE) */
    SCIP_Bool             probingpeek;        /**< Whether peeking should be done during probing. */
+   int                   powtablememlimit;   /**< Maximal memory (in MB) for tabulating the permutation powers of a symretope. */
+   SCIP_Bool             incrementalprop;    /**< Whether propagation only re-evaluates the powers affected by bound changes. */
    SCIP_EVENTHDLR*       eventhdlr;          /**< An event handler for deciding whether a constraint must be propagated. */
+   SCIP_SYMRETOPEARENA*  arena;              /**< Scratch memory for propagation, or NULL if not allocated yet. */
+   int                   propcachememlimit;  /**< Maximal memory (in MB) of the cache of propagation outcomes (0: no caching). */
+   SCIP_SYMRETOPECACHE*  propcache;          /**< Cache of propagation outcomes, or NULL if not allocated yet. */
+   int                   nconsids;           /**< Number of constraint identifiers handed out for the propagation cache. */
+   SCIP_Bool             groupprop;          /**< Whether constraints sharing variables are propagated group-wise until a fixpoint. */
+   SCIP_CLOCK*           hotstartclock;      /**< Time spent in propagation of monotone and ordered permutations. */
+   SCIP_CLOCK*           standardclock;      /**< Time spent in propagation of general permutations. */
+   SCIP_Longint          nhotstartcalls;     /**< Number of propagation calls for monotone and ordered permutations. */
+   SCIP_Longint          nstandardcalls;     /**< Number of propagation calls for general permutations. */
+   SCIP_Longint          npowers;            /**< Number of evaluations of a permutation power in propagation. */
+   SCIP_Longint          npeekcalls;         /**< Number of virtual fixings tested by peeking. */
+   SCIP_Longint          npeekfixings;       /**< Number of fixings found by peeking. */
+   SCIP_Longint          npeekbudgetstops;   /**< Number of propagation calls in which peeking stopped at the peek budget. */
+   int                   peekbudget;         /**< Maximal number of tentative fixings tested by peeking per propagation call (-1: no limit). */
+   SCIP_Longint          nexecpropskips;     /**< Number of propagation calls skipped as no affected variable changed. */
+   SCIP_Bool             dynamicevents;      /**< Whether local bound change events are only caught for the affected entries. */
+   SCIP_Longint          neventswitches;     /**< Number of entries for which catching bound change events was switched. */
+   SCIP_Longint          nresprops;          /**< Number of resolved propagations. */
+   SCIP_Longint          nresproplength;     /**< Total number of bounds in the explanations of resolved propagations. */
+   SCIP_Longint          nsepacalls;         /**< Number of calls of the symresack cover separator. */
+   SCIP_Longint          nsepacuts;          /**< Number of cuts found by the symresack cover separator. */
+   int                   memorybudget;       /**< Memory budget (in MB) of all symretope constraints (-1: a share of limits/memory, 0: none). */
+   SCIP_Real             memused;            /**< Memory (in bytes) of the transformed constraints charged to the budget. */
+   SCIP_Real             arenareserved;      /**< Memory (in bytes) of the arena charged to the budget. */
+   SCIP_Longint          powbenefit[NPOWBENEFITBUCKETS]; /**< Number of fixings found per bucket [2^b, 2^(b+1)) of powers. */
+   SCIP_Longint          npowbenefit;        /**< Total number of fixings recorded in powbenefit. */
+   int                   nbudgetlimited;     /**< Number of constraints whose number of powers is limited by the budget. */
+   int                   nbudgetdegraded;    /**< Number of constraints degraded to a symresack by the budget. */
 };
 
 enum SCIP_SymretopeGraphNodeType
@@ -139,6 +209,25 @@ struct SCIP_ConsData
    SCIP_Bool             execprop;           /**< Whether we should propagate for this constraint. */
    SCIP_Bool*            affectedentries;    /**< For each variable, whether it is interesting to check. */
    SCIP_EVENTDATA*       vareventdata;       /**< Variable data for each event. */
+   int*                  uncaughtentries;    /**< List of the entries whose local bound change events are not caught. */
+   int                   nuncaught;          /**< Number of entries whose local bound change events are not caught. */
+   uint64_t*             fixed0bits;         /**< Bitset of entries with local upper bound 0, or NULL if not transformed. */
+   uint64_t*             fixed1bits;         /**< Bitset of entries with local lower bound 1, or NULL if not transformed. */
+   int                   nbitwords;          /**< Number of words in fixed0bits and fixed1bits. */
+   int*                  lookupends;         /**< For each power, the index up to which its last evaluation looked up entries, or NULL. */
+   SCIP_Bool             lookupendsvalid;    /**< Whether lookupends describes the last propagation call. */
+   int*                  changedentries;     /**< Stack of affected entries whose bounds changed since the last propagation call. */
+   SCIP_Bool*            entrychanged;       /**< For each variable, whether it is on the changedentries stack. */
+   int                   nchangedentries;    /**< Number of entries on the changedentries stack. */
+   int                   consid;             /**< Identifier of the constraint in the propagation cache. */
+   int                   cachegeneration;    /**< Incremented on every global bound change, invalidating cached outcomes. */
+   int*                  recordedfixings;    /**< If not NULL, array to record the applied fixings in (as varid + nvars * b). */
+   int*                  recordedinferinfos; /**< If not NULL, array to record the inference information of the fixings in. */
+   int                   nrecordedfixings;   /**< Number of recorded fixings. */
+   int                   groupid;            /**< Group of the constraint (-1 if not grouped); constraints of different groups share no variables. */
+   SCIP_Real             memsize;            /**< Memory (in bytes) charged to the memory budget for this constraint. */
+   int*                  peekpayoff;         /**< For each variable, the number of fixings found by peeking on it, or NULL if none yet. */
+   SCIP_DECL_SYMRETOPEPROPKERNEL((*propkernel)); /**< The propagation kernel for the structure of the permutation. */
 };
 
 /** Eventhandler data */
@@ -146,6 +235,8 @@ struct SCIP_EventData
 {
    int varid;                                /**< Variable ID of the variable for which this event is added. */
    SCIP_CONSDATA* consdata;                  /**< Pointer to the associated constraint data */
+   int filterpos;                            /**< Position of the local bound change event in the event filter, or -1 if not caught */
+   int uncaughtpos;                          /**< Position of the entry in consdata->uncaughtentries, or -1 if caught */
 };
 
 struct SCIP_SymretopeVirtualFixings
@@ -158,8 +249,6 @@ struct SCIP_SymretopeVirtualFixings
    #endif
 };
 
-typedef struct SCIP_SymretopeVirtualFixings SCIP_SYMRETOPEVIRTUALFIXINGS;
-
 struct SCIP_SymretopeGraph
 {
    SCIP_SymretopeGraphNode*     permgraphroots; /**< Stores all the tree-roots */
@@ -186,6 +275,53 @@ struct SCIP_FixingQueue
 };
 typedef struct SCIP_FixingQueue SCIP_FIXINGQUEUE;
 
+/** Scratch memory for propagation, kept in the constraint handler data and reused across propagation calls */
+struct SCIP_SymretopeArena
+{
+   SCIP_SYMRETOPEGRAPH           implgraph;          /**< The implication graph */
+   SCIP_FIXINGQUEUE              fixingqueue;        /**< The fixing queue */
+   SCIP_SYMRETOPEVIRTUALFIXINGS  virtualfixingspeek; /**< The virtual fixings used for peeking */
+   int*                          impactfulentries;   /**< Stack of entries that appear in an implication tree */
+   int*                          impactfulepochs;    /**< Entry i is impactful iff impactfulepochs[i] equals epoch */
+   int                           epoch;              /**< The current epoch, incremented whenever the arena is acquired */
+   int                           npeeksleft;         /**< The number of tentative fixings that peeking may still test in this call */
+   int                           nvars;              /**< The number of variables the arena supports */
+   int                           maxnperms;          /**< The number of permutations the implication graph supports */
+   int                           nnodes;             /**< The number of internal nodes of the implication graph */
+   SCIP_Bool                     inuse;              /**< Whether the arena is in use by a propagation call */
+   SCIP_Bool                     istemporary;        /**< Whether the arena is freed when it is released */
+};
+
+typedef struct SCIP_SymretopeCacheEntry SCIP_SYMRETOPECACHEENTRY;
+
+/** Outcome of propagating a constraint in a local state, stored in the propagation cache */
+struct SCIP_SymretopeCacheEntry
+{
+   uint64_t*                     words;              /**< The fixed0bits followed by the fixed1bits of the local state */
+   int                           nwords;             /**< The number of words in words */
+   int                           consid;             /**< Identifier of the constraint */
+   int                           generation;         /**< Generation of the global bounds of the constraint */
+   SCIP_Bool                     findcompleteset;    /**< Whether peeking was enabled */
+   uint64_t                      hashval;            /**< Hash value of the key */
+   SCIP_Bool                     infeasible;         /**< Whether propagation detected infeasibility */
+   int*                          fixings;            /**< The fixings in the order they were applied (as varid + nvars * b) */
+   int*                          inferinfos;         /**< The inference information of the fixings */
+   int                           nfixings;           /**< The number of fixings */
+   SCIP_SYMRETOPECACHEENTRY*     prev;               /**< The more recently used entry, or NULL */
+   SCIP_SYMRETOPECACHEENTRY*     next;               /**< The less recently used entry, or NULL */
+};
+
+/** Bounded LRU cache of propagation outcomes, shared by all constraints of the constraint handler */
+struct SCIP_SymretopeCache
+{
+   SCIP_HASHTABLE*               hashtable;          /**< Hash table of the entries */
+   SCIP_SYMRETOPECACHEENTRY*     head;               /**< The most recently used entry */
+   SCIP_SYMRETOPECACHEENTRY*     tail;               /**< The least recently used entry */
+   SCIP_Longint                  memsize;            /**< Memory (in bytes) used by the entries */
+   SCIP_Longint                  nlookups;           /**< Number of lookups */
+   SCIP_Longint                  nhits;              /**< Number of successful lookups */
+};
+
 /*
  * Local methods
  */
@@ -298,108 +434,865 @@ void freeVirtualFixings(
 
 
 /*
- * For implication graphs
+ * For the propagation arena
+ */
+
+/** Allocate an arena for @p nvars variables, @p maxnperms permutations and @p nnodes internal graph nodes.
+ *
+ *  All arrays that must be clean (i.e., zero) between propagation calls are allocated cleared. The propagation code
+ *  restores them to zero before it returns, so the arena can be reused without clearing.
  */
 static
-SCIP_RETCODE allocSymretopeGraph(
+SCIP_RETCODE createArena(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_SYMRETOPEGRAPH** symgraph,           /**< pointer to symretope graph data */
+   SCIP_SYMRETOPEARENA** arena,              /**< pointer to the arena */
    int                   nvars,              /**< number of variables */
-   int                   maxnperms           /**< maximal number of nperms the graph structure should support. */
+   int                   maxnperms,          /**< maximal number of nperms the graph structure should support. */
+   int                   nnodes              /**< number of internal nodes the graph structure should support. */
 )
 {
+   SCIP_SYMRETOPEGRAPH* implgraph;
+   SCIP_FIXINGQUEUE* fixingqueue;
+   SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixings;
+
    assert( scip != NULL );
-   assert( symgraph != NULL );
+   assert( arena != NULL );
    assert( nvars >= 0 );
    assert( maxnperms >= 0 );
 
-   SCIP_CALL( SCIPallocBuffer(scip, symgraph) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permpows), maxnperms) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permgraphroots), maxnperms) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permgraphleaves), 2 * maxnperms) );
-   SCIP_CALL( SCIPallocCleanBufferArray(scip, &((*symgraph)->permgraphs), 2 * nvars * maxnperms ) );
+   SCIP_CALL( SCIPallocBlockMemory(scip, arena) );
+   (*arena)->nvars = nvars;
+   (*arena)->maxnperms = maxnperms;
+   (*arena)->nnodes = nnodes;
+   (*arena)->epoch = 0;
+   (*arena)->inuse = FALSE;
+   (*arena)->istemporary = FALSE;
+
+   implgraph = &(*arena)->implgraph;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permpows, maxnperms) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permgraphroots, maxnperms) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permgraphleaves, 2 * maxnperms) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &implgraph->permgraphs, nnodes) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permsqueue, maxnperms) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permsinqueue, maxnperms) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &implgraph->permindices, maxnperms) );
+   implgraph->permsqueuesize = 0;
+   #ifndef NDEBUG
+   implgraph->nvars = nvars;
+   implgraph->maxnperms = maxnperms;
+   implgraph->permsqueuesize = -1;
+   #endif
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permsqueue), maxnperms) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permsinqueue), maxnperms) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*symgraph)->permindices), maxnperms) );
+   fixingqueue = &(*arena)->fixingqueue;
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &fixingqueue->fixinginqueue, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fixingqueue->fixingqueue, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fixingqueue->fixingpermpows, nvars) );
+   fixingqueue->fixingqueuesize = 0;
 
+   virtualfixings = &(*arena)->virtualfixingspeek;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &virtualfixings->entrystack, nvars) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &virtualfixings->entrylookup, nvars) );
+   virtualfixings->nvirtualfixings = 0;
    #ifndef NDEBUG
-   (*symgraph)->nvars =  nvars;
-   (*symgraph)->maxnperms = maxnperms;
-   (*symgraph)->permsqueuesize = -1;
+   virtualfixings->nvars = nvars;
    #endif
 
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*arena)->impactfulentries, nvars) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &(*arena)->impactfulepochs, nvars) );
+
    return SCIP_OKAY;
 }
 
+/** Free an arena */
 static
-void freeSymretopeGraph(
+void freeArena(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_SYMRETOPEGRAPH** symgraph            /**< pointer to symretope graph data */
+   SCIP_SYMRETOPEARENA** arena               /**< pointer to the arena */
 )
 {
+   SCIP_SYMRETOPEGRAPH* implgraph;
+   int nvars;
+   int maxnperms;
+   int nnodes;
    #ifndef NDEBUG
-   int i;
    SCIP_SymretopeGraphNode* node;
+   int i;
    #endif
 
    assert( scip != NULL );
-   assert( symgraph != NULL );
+   assert( arena != NULL );
+   assert( *arena != NULL );
+   assert( !(*arena)->inuse );
+
+   nvars = (*arena)->nvars;
+   maxnperms = (*arena)->maxnperms;
+   nnodes = (*arena)->nnodes;
+   implgraph = &(*arena)->implgraph;
 
    #ifndef NDEBUG
-   /* Sanity check: Make sure this memory is completely nulled by now. */
-   for (i = 0; i < 2 * (*symgraph)->nvars * (*symgraph)->maxnperms; ++i)
+   /* Sanity check: Make sure the clean memory is completely nulled by now. */
+   for (i = 0; i < nnodes; ++i)
    {
-      node = &((*symgraph)->permgraphs[i]);
+      node = &(implgraph->permgraphs[i]);
       assert( node->fixing == 0 );
       assert( node->nodetype == 0 );
       assert( node->predecessor == NULL );
       assert( node->successor1 == NULL );
       assert( node->successor2 == NULL );
    }
-   #endif
+   for (i = 0; i < nvars; ++i)
+   {
+      assert( (*arena)->fixingqueue.fixinginqueue[i] == 0 );
+      assert( (*arena)->virtualfixingspeek.entrylookup[i] == UNFIXED );
+   }
+   #endif
+
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->impactfulepochs, nvars);
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->impactfulentries, nvars);
+
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->virtualfixingspeek.entrylookup, nvars);
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->virtualfixingspeek.entrystack, nvars);
+
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->fixingqueue.fixingpermpows, nvars);
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->fixingqueue.fixingqueue, nvars);
+   SCIPfreeBlockMemoryArray(scip, &(*arena)->fixingqueue.fixinginqueue, nvars);
+
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permindices, maxnperms);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permsinqueue, maxnperms);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permsqueue, maxnperms);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permgraphs, nnodes);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permgraphleaves, 2 * maxnperms);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permgraphroots, maxnperms);
+   SCIPfreeBlockMemoryArray(scip, &implgraph->permpows, maxnperms);
+
+   SCIPfreeBlockMemory(scip, arena);
+}
+
+/** Get an arena that supports @p nvars variables, @p maxnperms permutations and @p nnodes internal graph nodes for a
+ *  propagation call.
+ *
+ *  The arena of the constraint handler is reused if it is large enough, and replaced by a larger one otherwise. Only if
+ *  the arena of the constraint handler is already in use, a temporary arena is created. In both cases, the arena has
+ *  to be returned by releaseArena().
+ *
+ *  A new epoch is started, such that all entries are marked as not impactful in O(1).
+ */
+static
+SCIP_RETCODE acquireArena(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   int                   nvars,              /**< number of variables */
+   int                   maxnperms,          /**< number of permutations the graph structure should support. */
+   int                   nnodes,             /**< number of internal nodes the graph structure should support. */
+   SCIP_SYMRETOPEARENA** arena               /**< pointer to store the arena */
+)
+{
+   SCIP_SYMRETOPEARENA* hdlrarena;
+   int i;
+
+   assert( scip != NULL );
+   assert( conshdlrdata != NULL );
+   assert( arena != NULL );
+
+   hdlrarena = conshdlrdata->arena;
+
+   if ( hdlrarena != NULL && hdlrarena->inuse )
+   {
+      /* The arena of the constraint handler is in use, for example by an ongoing propagation. */
+      SCIP_CALL( createArena(scip, arena, nvars, maxnperms, nnodes) );
+      (*arena)->istemporary = TRUE;
+   }
+   else
+   {
+      if ( hdlrarena == NULL || hdlrarena->nvars < nvars || hdlrarena->maxnperms < maxnperms
+         || hdlrarena->nnodes < nnodes )
+      {
+         if ( hdlrarena != NULL )
+         {
+            nvars = MAX(nvars, hdlrarena->nvars);
+            maxnperms = MAX(maxnperms, hdlrarena->maxnperms);
+            nnodes = MAX(nnodes, hdlrarena->nnodes);
+            freeArena(scip, &conshdlrdata->arena);
+         }
+         SCIP_CALL( createArena(scip, &conshdlrdata->arena, nvars, maxnperms, nnodes) );
+      }
+      *arena = conshdlrdata->arena;
+   }
+   assert( *arena != NULL );
+
+   /* Start a new epoch. On overflow, reset the epoch markers explicitly. */
+   if ( (*arena)->epoch == INT_MAX )
+   {
+      for (i = 0; i < (*arena)->nvars; ++i)
+         (*arena)->impactfulepochs[i] = 0;
+      (*arena)->epoch = 0;
+   }
+   ++((*arena)->epoch);
+
+   (*arena)->npeeksleft = conshdlrdata->peekbudget < 0 ? INT_MAX : conshdlrdata->peekbudget;
+   (*arena)->inuse = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** Return an arena obtained by acquireArena() */
+static
+void releaseArena(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SYMRETOPEARENA** arena               /**< pointer to the arena */
+)
+{
+   assert( scip != NULL );
+   assert( arena != NULL );
+   assert( *arena != NULL );
+   assert( (*arena)->inuse );
+
+   /* The other clean arrays are restored by the propagation code itself. */
+   clearVirtualFixings(&(*arena)->virtualfixingspeek);
+
+   (*arena)->inuse = FALSE;
+   if ( (*arena)->istemporary )
+      freeArena(scip, arena);
+   *arena = NULL;
+}
+
+/** Number of permutations for which the implication graph must have room when propagating a constraint */
+static
+int getArenaNPerms(
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+)
+{
+   assert( consdata != NULL );
+
+   if ( consdata->nvars == 0 )
+      return 0;
+
+   assert( consdata->permutation != NULL );
+   if ( consdata->permutation->ismonotone && consdata->permutation->isordered )
+      return consdata->permutation->maxcyclesize - 1;
+   return consdata->nperms;
+}
+
+
+/*
+ * For the memory budget
+ */
+
+/** Memory (in bytes) of the implication graph of the arena for @p nperms permutations on @p nvars variables */
+static
+SCIP_Real getArenaMemory(
+   int                   nvars,              /**< number of variables */
+   int                   nperms              /**< number of permutations */
+)
+{
+   return (SCIP_Real) nperms * (2.0 * nvars * sizeof(SCIP_SymretopeGraphNode) + sizeof(SCIP_SymretopeGraphNode)
+      + 2.0 * sizeof(SCIP_SymretopeGraphNode*) + 3.0 * sizeof(int) + sizeof(SCIP_Bool));
+}
+
+/** Memory (in bytes) of the data of a transformed constraint on @p nvars variables that handles @p nperms powers */
+static
+SCIP_Real getConsMemory(
+   int                   nvars,              /**< number of variables */
+   int                   nperms,             /**< number of handled powers */
+   SCIP_Bool             withpowtable        /**< whether the powers are tabulated */
+)
+{
+   SCIP_Real mem;
+
+   /* variables, permutation with its cycle structure, event data and the incremental propagation data */
+   mem = (SCIP_Real) nvars * (sizeof(SCIP_VAR*) + 4.0 * sizeof(int) + sizeof(SCIP_PERMENTRY) + sizeof(SCIP_EVENTDATA)
+      + 2.0 * sizeof(SCIP_Bool)) + 2.0 * PACKEDNWORDS(nvars) * sizeof(uint64_t);
+
+   /* lookupends */
+   mem += (SCIP_Real) nperms * sizeof(int);
+
+   if ( withpowtable )
+      mem += (2.0 * nperms + 1.0) * nvars * sizeof(int);
+
+   return mem;
+}
+
+/** Get the memory budget (in bytes) for symretope constraints, or -1.0 if there is no budget */
+static
+SCIP_RETCODE getMemoryBudget(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_Real*            budget              /**< pointer to store the budget */
+)
+{
+   SCIP_Real memlimit;
+
+   assert( scip != NULL );
+   assert( conshdlrdata != NULL );
+   assert( budget != NULL );
+
+   if ( conshdlrdata->memorybudget > 0 )
+   {
+      *budget = 1024.0 * 1024.0 * conshdlrdata->memorybudget;
+      return SCIP_OKAY;
+   }
+
+   *budget = -1.0;
+   if ( conshdlrdata->memorybudget == 0 )
+      return SCIP_OKAY;
+
+   /* derive the budget from the memory limit, if there is one */
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/memory", &memlimit) );
+   if ( memlimit < (SCIP_Real) SCIP_MEM_NOLIMIT )
+      *budget = 1024.0 * 1024.0 * MEMBUDGETLIMITSHARE * memlimit;
+
+   return SCIP_OKAY;
+}
+
+/** Record that a power of a permutation lead to a fixing, as a measure for the benefit of handling this power */
+static
+void recordPowerBenefit(
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   int                   pow                 /**< power that lead to a fixing */
+)
+{
+   int b = 0;
+
+   assert( conshdlrdata != NULL );
+
+   if ( pow <= 0 )
+      return;
+
+   while ( (pow >>= 1) > 0 )
+      ++b;
+   assert( b < NPOWBENEFITBUCKETS );
+
+   ++conshdlrdata->powbenefit[b];
+   ++conshdlrdata->npowbenefit;
+}
+
+/** Largest power that is worth handling according to the fixings found so far, or INT_MAX if there is too little data
+ *
+ *  The powers are grouped in buckets [2^b, 2^(b+1)). We keep all powers up to the last bucket that contributed at
+ *  least a share of MINPOWBENEFITSHARE of all recorded fixings.
+ */
+static
+int getMaxBeneficialPower(
+   SCIP_CONSHDLRDATA*    conshdlrdata        /**< constraint handler data */
+)
+{
+   int b;
+
+   assert( conshdlrdata != NULL );
+
+   if ( conshdlrdata->npowbenefit < MINPOWBENEFITFIXINGS )
+      return INT_MAX;
+
+   for (b = NPOWBENEFITBUCKETS - 1; b > 0; --b)
+   {
+      if ( conshdlrdata->powbenefit[b] >= MINPOWBENEFITSHARE * conshdlrdata->npowbenefit )
+         break;
+   }
+
+   if ( b >= NPOWBENEFITBUCKETS - 2 )
+      return INT_MAX;
+   return (1 << (b + 1)) - 1;
+}
+
+/** Choose the number of powers of a transformed constraint and whether to tabulate them within the memory budget
+ *
+ *  A single constraint may use at most half of the remaining budget, such that later constraints are not starved.
+ *  The arena is shared by all constraints, so only its growth is charged. If not even a single power fits, the
+ *  constraint degrades to a symresack, i.e., only the permutation itself is handled.
+ */
+static
+void chooseBudgetedNPerms(
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_PERMUTATION*     permutation,        /**< the constraint permutation */
+   SCIP_Real             budget,             /**< memory budget (in bytes) */
+   int*                  nperms,             /**< on input the maximal, on output the chosen number of powers */
+   SCIP_Bool*            withpowtable,       /**< pointer to store whether the powers should be tabulated */
+   SCIP_Real*            consmem,            /**< pointer to store the memory charged to the constraint */
+   SCIP_Real*            arenamem            /**< pointer to store the memory of the arena required by the constraint */
+)
+{
+   SCIP_Real share;
+   SCIP_Bool hotstart;
+   int nvars;
+   int lb;
+   int ub;
+
+   assert( conshdlrdata != NULL );
+   assert( permutation != NULL );
+   assert( nperms != NULL );
+   assert( *nperms >= 1 );
+   assert( withpowtable != NULL );
+   assert( consmem != NULL );
+   assert( arenamem != NULL );
+
+   nvars = permutation->nvars;
+   share = (budget - conshdlrdata->memused - conshdlrdata->arenareserved) / 2.0;
+
+   /* the propagation of monotone and ordered permutations needs an arena for all powers of a cycle */
+   hotstart = permutation->ismonotone && permutation->isordered;
+
+   *nperms = MIN(*nperms, getMaxBeneficialPower(conshdlrdata));
+
+   /* binary search for the largest number of powers that fits into the share of the budget */
+   lb = 1;
+   ub = *nperms;
+   while ( lb < ub )
+   {
+      SCIP_Real mem;
+      int mid;
+
+      mid = lb + (ub - lb + 1) / 2;
+      mem = getConsMemory(nvars, mid, FALSE)
+         + MAX(getArenaMemory(nvars, hotstart ? permutation->maxcyclesize - 1 : mid) - conshdlrdata->arenareserved, 0.0);
+      if ( mem <= share )
+         lb = mid;
+      else
+         ub = mid - 1;
+   }
+   if ( lb < *nperms )
+      ++conshdlrdata->nbudgetlimited;
+   *nperms = lb;
+
+   *arenamem = getArenaMemory(nvars, hotstart ? permutation->maxcyclesize - 1 : *nperms);
+   *consmem = getConsMemory(nvars, *nperms, FALSE);
+   if ( *consmem + MAX(*arenamem - conshdlrdata->arenareserved, 0.0) > share )
+   {
+      /* not even a single power fits, so we only handle the permutation itself */
+      ++conshdlrdata->nbudgetdegraded;
+      *withpowtable = FALSE;
+      return;
+   }
+
+   /* tabulate the powers only if this fits, too */
+   *withpowtable = getConsMemory(nvars, *nperms, TRUE) + MAX(*arenamem - conshdlrdata->arenareserved, 0.0) <= share
+      && (2.0 * (*nperms) + 1.0) * nvars * sizeof(int) <= 1024.0 * 1024.0 * conshdlrdata->powtablememlimit;
+   if ( *withpowtable )
+      *consmem = getConsMemory(nvars, *nperms, TRUE);
+}
+
+/*
+ * For the bit-packed snapshot of the local fixings
+ */
+
+/** Update the snapshot entry of a variable to its current local bounds. */
+static
+void updateFixingSnapshot(
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   varid               /**< index of the variable in consdata->vars */
+)
+{
+   SCIP_VAR* var;
+   uint64_t mask;
+   int word;
+
+   assert( consdata != NULL );
+   assert( consdata->fixed0bits != NULL );
+   assert( consdata->fixed1bits != NULL );
+   assert( varid >= 0 && varid < consdata->nvars );
+
+   var = consdata->vars[varid];
+   assert( var != NULL );
+
+   word = PACKEDWORD(varid);
+   mask = PACKEDMASK(varid);
+
+   if ( SCIPvarGetUbLocal(var) < 0.5 )
+      consdata->fixed0bits[word] |= mask;
+   else
+      consdata->fixed0bits[word] &= ~mask;
+
+   if ( SCIPvarGetLbLocal(var) > 0.5 )
+      consdata->fixed1bits[word] |= mask;
+   else
+      consdata->fixed1bits[word] &= ~mask;
+}
+
+/** Update the snapshot entries of the variables whose local bound change events are not caught.
+ *
+ *  These entries are not affected, so their snapshot entries may be outdated, and must be updated before the snapshot
+ *  is used in propagation.
+ */
+static
+void syncFixingSnapshot(
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+)
+{
+   int i;
+
+   assert( consdata != NULL );
+   assert( consdata->fixed0bits != NULL );
+   assert( consdata->vareventdata != NULL );
+   assert( consdata->uncaughtentries != NULL || consdata->nuncaught == 0 );
+
+   for (i = 0; i < consdata->nuncaught; ++i)
+   {
+      assert( consdata->vareventdata[consdata->uncaughtentries[i]].filterpos < 0 );
+      updateFixingSnapshot(consdata, consdata->uncaughtentries[i]);
+   }
+}
+
+/** Get the fixing of an entry according to the snapshot of the local bounds. */
+static
+int getSnapshotFixing(
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   varid               /**< index of the variable in consdata->vars */
+)
+{
+   int word;
+   uint64_t mask;
+
+   assert( consdata != NULL );
+   assert( consdata->fixed0bits != NULL );
+   assert( consdata->fixed1bits != NULL );
+   assert( varid >= 0 && varid < consdata->nvars );
+
+   word = PACKEDWORD(varid);
+   mask = PACKEDMASK(varid);
+
+   /* Both bits can only be set simultaneously if the local domain is empty, which SCIP does not allow. */
+   assert( (consdata->fixed0bits[word] & consdata->fixed1bits[word] & mask) == 0 );
+
+   if ( consdata->fixed1bits[word] & mask )
+      return FIXED1;
+   if ( consdata->fixed0bits[word] & mask )
+      return FIXED0;
+   return UNFIXED;
+}
+
+/** Find the first entry in the contiguous index range [@p begin, @p end) that is not fixed in the snapshot.
+ *
+ *  The snapshot is scanned word-wise, i.e., 64 entries at a time. If @p checkedentries is not NULL, all entries up to
+ *  and including the returned entry are marked as checked, as they would have been by an entry-wise scan.
+ *
+ *  @return the first unfixed entry, or -1 if all entries in the range are fixed.
+ */
+static
+int findFirstUnfixedSnapshotEntry(
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   begin,              /**< first entry of the range */
+   int                   end,                /**< entry after the last entry of the range */
+   SCIP_Bool*            checkedentries      /**< For each variable entry, whether the entry has been looked up, or NULL */
+)
+{
+   uint64_t unfixed;
+   int firstunfixed = -1;
+   int word;
+   int lastword;
+   int i;
+
+   assert( consdata != NULL );
+   assert( consdata->fixed0bits != NULL );
+   assert( consdata->fixed1bits != NULL );
+   assert( 0 <= begin );
+   assert( end <= consdata->nvars );
+
+   if ( begin >= end )
+      return -1;
+
+   lastword = PACKEDWORD(end - 1);
+   for (word = PACKEDWORD(begin); word <= lastword; ++word)
+   {
+      unfixed = ~(consdata->fixed0bits[word] | consdata->fixed1bits[word]);
+
+      /* Mask out the entries before begin and from end onwards. */
+      if ( word == PACKEDWORD(begin) )
+         unfixed &= ~(PACKEDMASK(begin) - 1);
+      if ( word == lastword && (end % PACKEDWORDBITS) != 0 )
+         unfixed &= PACKEDMASK(end) - 1;
+
+      if ( unfixed != 0 )
+      {
+         firstunfixed = word * PACKEDWORDBITS + getLowestBit(unfixed);
+         assert( begin <= firstunfixed && firstunfixed < end );
+         break;
+      }
+   }
+
+   if ( checkedentries != NULL )
+   {
+      for (i = begin; i < (firstunfixed >= 0 ? firstunfixed + 1 : end); ++i)
+         checkedentries[i] = TRUE;
+   }
+
+   return firstunfixed;
+}
+
+/*
+ * For the cache of propagation outcomes
+ */
+
+/** gets the key of the given element */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyCacheEntry)
+{  /*lint --e{715}*/
+   return elem;
+}
+
+/** returns TRUE iff both keys are equal, i.e., the entries describe the same local state of the same constraint */
+static
+SCIP_DECL_HASHKEYEQ(hashKeyEQCacheEntry)
+{  /*lint --e{715}*/
+   SCIP_SYMRETOPECACHEENTRY* k1;
+   SCIP_SYMRETOPECACHEENTRY* k2;
+   int w;
+
+   k1 = (SCIP_SYMRETOPECACHEENTRY*) key1;
+   k2 = (SCIP_SYMRETOPECACHEENTRY*) key2;
+
+   if ( k1->hashval != k2->hashval || k1->consid != k2->consid || k1->generation != k2->generation
+      || k1->findcompleteset != k2->findcompleteset || k1->nwords != k2->nwords )
+      return FALSE;
+
+   for (w = 0; w < k1->nwords; ++w)
+   {
+      if ( k1->words[w] != k2->words[w] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** returns the hash value of the key */
+static
+SCIP_DECL_HASHKEYVAL(hashKeyValCacheEntry)
+{  /*lint --e{715}*/
+   return ((SCIP_SYMRETOPECACHEENTRY*) key)->hashval;
+}
+
+/** Compute the hash value of the local state of a constraint, given by its snapshot of the local fixings. */
+static
+uint64_t computeCacheHash(
+   uint64_t*             words,              /**< the fixed0bits followed by the fixed1bits */
+   int                   nwords,             /**< number of words */
+   int                   consid,             /**< identifier of the constraint */
+   int                   generation,         /**< generation of the global bounds of the constraint */
+   SCIP_Bool             findcompleteset     /**< whether peeking is enabled */
+)
+{
+   uint64_t hashval;
+   int w;
+
+   hashval = SCIPhashFour(consid, generation, findcompleteset, nwords);
+   for (w = 0; w < nwords; ++w)
+   {
+      /* multiplicative mixing, such that also permuted states get different hash values */
+      hashval = (hashval ^ words[w]) * 0x9E3779B97F4A7C15ULL;
+      hashval ^= hashval >> 29;
+   }
+
+   return hashval;
+}
+
+/** Memory (in bytes) used by a cache entry */
+static
+SCIP_Longint getCacheEntryMemSize(
+   int                   nwords,             /**< number of words of the state */
+   int                   nfixings            /**< number of fixings of the outcome */
+)
+{
+   return (SCIP_Longint) sizeof(SCIP_SYMRETOPECACHEENTRY) + (SCIP_Longint) nwords * (SCIP_Longint) sizeof(uint64_t)
+      + 2 * (SCIP_Longint) nfixings * (SCIP_Longint) sizeof(int);
+}
+
+/** Create an empty cache of propagation outcomes */
+static
+SCIP_RETCODE createPropCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SYMRETOPECACHE** cache               /**< pointer to store the cache */
+)
+{
+   assert( scip != NULL );
+   assert( cache != NULL );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, cache) );
+   SCIP_CALL( SCIPhashtableCreate(&(*cache)->hashtable, SCIPblkmem(scip), 1024, hashGetKeyCacheEntry,
+         hashKeyEQCacheEntry, hashKeyValCacheEntry, NULL) );
+   (*cache)->head = NULL;
+   (*cache)->tail = NULL;
+   (*cache)->memsize = 0;
+   (*cache)->nlookups = 0;
+   (*cache)->nhits = 0;
+
+   return SCIP_OKAY;
+}
+
+/** Remove an entry from the cache and free it */
+static
+SCIP_RETCODE removePropCacheEntry(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SYMRETOPECACHE*  cache,              /**< the cache */
+   SCIP_SYMRETOPECACHEENTRY* entry           /**< the entry to remove */
+)
+{
+   assert( scip != NULL );
+   assert( cache != NULL );
+   assert( entry != NULL );
+
+   SCIP_CALL( SCIPhashtableRemove(cache->hashtable, (void*) entry) );
+
+   if ( entry->prev != NULL )
+      entry->prev->next = entry->next;
+   else
+      cache->head = entry->next;
+   if ( entry->next != NULL )
+      entry->next->prev = entry->prev;
+   else
+      cache->tail = entry->prev;
+
+   cache->memsize -= getCacheEntryMemSize(entry->nwords, entry->nfixings);
+   assert( cache->memsize >= 0 );
+
+   SCIPfreeBlockMemoryArrayNull(scip, &entry->inferinfos, entry->nfixings);
+   SCIPfreeBlockMemoryArrayNull(scip, &entry->fixings, entry->nfixings);
+   SCIPfreeBlockMemoryArray(scip, &entry->words, entry->nwords);
+   SCIPfreeBlockMemory(scip, &entry);
+
+   return SCIP_OKAY;
+}
+
+/** Free the cache of propagation outcomes and all its entries */
+static
+SCIP_RETCODE freePropCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SYMRETOPECACHE** cache               /**< pointer to the cache */
+)
+{
+   assert( scip != NULL );
+   assert( cache != NULL );
+   assert( *cache != NULL );
+
+   while ( (*cache)->tail != NULL )
+   {
+      SCIP_CALL( removePropCacheEntry(scip, *cache, (*cache)->tail) );
+   }
+   assert( (*cache)->memsize == 0 );
+
+   SCIPhashtableFree(&(*cache)->hashtable);
+   SCIPfreeBlockMemory(scip, cache);
+
+   return SCIP_OKAY;
+}
+
+/** Look up the outcome of propagating a constraint in a local state
+ *
+ *  On success, the entry becomes the most recently used one.
+ */
+static
+SCIP_SYMRETOPECACHEENTRY* lookupPropCache(
+   SCIP_SYMRETOPECACHE*  cache,              /**< the cache */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   uint64_t*             words,              /**< the fixed0bits followed by the fixed1bits of the local state */
+   SCIP_Bool             findcompleteset     /**< whether peeking is enabled */
+)
+{
+   SCIP_SYMRETOPECACHEENTRY probe;
+   SCIP_SYMRETOPECACHEENTRY* entry;
+
+   assert( cache != NULL );
+   assert( consdata != NULL );
+   assert( words != NULL );
+
+   probe.words = words;
+   probe.nwords = 2 * consdata->nbitwords;
+   probe.consid = consdata->consid;
+   probe.generation = consdata->cachegeneration;
+   probe.findcompleteset = findcompleteset;
+   probe.hashval = computeCacheHash(probe.words, probe.nwords, probe.consid, probe.generation, findcompleteset);
+
+   ++cache->nlookups;
+   entry = (SCIP_SYMRETOPECACHEENTRY*) SCIPhashtableRetrieve(cache->hashtable, (void*) &probe);
+   if ( entry == NULL )
+      return NULL;
+   ++cache->nhits;
+
+   /* move to the front of the LRU list */
+   if ( entry->prev != NULL )
+   {
+      entry->prev->next = entry->next;
+      if ( entry->next != NULL )
+         entry->next->prev = entry->prev;
+      else
+         cache->tail = entry->prev;
+      entry->prev = NULL;
+      entry->next = cache->head;
+      cache->head->prev = entry;
+      cache->head = entry;
+   }
 
-   SCIPfreeBufferArray(scip, &((*symgraph)->permindices));
-   SCIPfreeBufferArray(scip, &((*symgraph)->permsinqueue));
-   SCIPfreeBufferArray(scip, &((*symgraph)->permsqueue));
-   SCIPfreeCleanBufferArray(scip, &((*symgraph)->permgraphs));
-   SCIPfreeBufferArray(scip, &((*symgraph)->permgraphleaves));
-   SCIPfreeBufferArray(scip, &((*symgraph)->permgraphroots));
-   SCIPfreeBufferArray(scip, &((*symgraph)->permpows));
-   SCIPfreeBuffer(scip, symgraph);
+   return entry;
 }
 
-
-/*
- * For fixing queues
+/** Store the outcome of propagating a constraint in a local state, evicting the least recently used entries if the
+ *  memory limit would be exceeded.
  */
 static
-SCIP_RETCODE allocFixingQueue(
+SCIP_RETCODE insertPropCache(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_FIXINGQUEUE**    fq,                 /**< pointer to the fixing queue data */
-   int                   nvars               /**< number of variables */
+   SCIP_SYMRETOPECACHE*  cache,              /**< the cache */
+   SCIP_Longint          memlimit,           /**< maximal memory (in bytes) of the cache */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   uint64_t*             words,              /**< the fixed0bits followed by the fixed1bits before propagation */
+   SCIP_Bool             findcompleteset,    /**< whether peeking is enabled */
+   SCIP_Bool             infeasible,         /**< whether propagation detected infeasibility */
+   int*                  fixings,            /**< the applied fixings, encoded as varid + nvars * b */
+   int*                  inferinfos,         /**< the inference information of the applied fixings */
+   int                   nfixings            /**< number of applied fixings */
 )
 {
-   SCIP_CALL( SCIPallocBuffer(scip, fq) );
-   SCIP_CALL( SCIPallocCleanBufferArray(scip, &((*fq)->fixinginqueue), nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*fq)->fixingqueue), nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &((*fq)->fixingpermpows), nvars) );
-   (*fq)->fixingqueuesize = 0;
+   SCIP_SYMRETOPECACHEENTRY* entry;
+   SCIP_Longint memsize;
+   int nwords;
+
+   assert( scip != NULL );
+   assert( cache != NULL );
+   assert( consdata != NULL );
+   assert( words != NULL );
+   assert( nfixings == 0 || (fixings != NULL && inferinfos != NULL) );
+
+   nwords = 2 * consdata->nbitwords;
+   memsize = getCacheEntryMemSize(nwords, nfixings);
+   if ( memsize > memlimit )
+      return SCIP_OKAY;
+
+   while ( cache->memsize + memsize > memlimit )
+   {
+      assert( cache->tail != NULL );
+      SCIP_CALL( removePropCacheEntry(scip, cache, cache->tail) );
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &entry) );
+   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &entry->words, words, nwords) );
+   entry->nwords = nwords;
+   entry->consid = consdata->consid;
+   entry->generation = consdata->cachegeneration;
+   entry->findcompleteset = findcompleteset;
+   entry->hashval = computeCacheHash(words, nwords, entry->consid, entry->generation, findcompleteset);
+   entry->infeasible = infeasible;
+   entry->nfixings = nfixings;
+   if ( nfixings > 0 )
+   {
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &entry->fixings, fixings, nfixings) );
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &entry->inferinfos, inferinfos, nfixings) );
+   }
+   else
+   {
+      entry->fixings = NULL;
+      entry->inferinfos = NULL;
+   }
+
+   SCIP_CALL( SCIPhashtableInsert(cache->hashtable, (void*) entry) );
+   entry->prev = NULL;
+   entry->next = cache->head;
+   if ( cache->head != NULL )
+      cache->head->prev = entry;
+   else
+      cache->tail = entry;
+   cache->head = entry;
+   cache->memsize += memsize;
 
    return SCIP_OKAY;
 }
 
-static
-void freeFixingQueue(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_FIXINGQUEUE**    fq                  /**< pointer to the fixing queue data */
-)
-{
-   SCIPfreeBufferArray(scip, &((*fq)->fixingpermpows));
-   SCIPfreeBufferArray(scip, &((*fq)->fixingqueue));
-   SCIPfreeCleanBufferArray(scip, &((*fq)->fixinginqueue));
-   SCIPfreeBuffer(scip, fq);
-}
 
 /** frees a symretope constraint data */
 static
@@ -438,21 +1331,36 @@ SCIP_RETCODE consdataFree(
       assert( conshdlrdata != NULL );
       for (i = 0; i < nvars; ++i)
       {
-         SCIP_CALL( SCIPdropVarEvent(scip, (*consdata)->vars[i],
-            SCIP_EVENTTYPE_VARCHANGED,
-            conshdlrdata->eventhdlr, &(*consdata)->vareventdata[i], -1) );
+         SCIP_CALL( SCIPdropVarEvent(scip, (*consdata)->vars[i], SCIP_EVENTTYPE_GBDCHANGED,
+               conshdlrdata->eventhdlr, &(*consdata)->vareventdata[i], -1) );
+         if ( (*consdata)->vareventdata[i].filterpos >= 0 )
+         {
+            SCIP_CALL( SCIPdropVarEvent(scip, (*consdata)->vars[i], SCIP_EVENTTYPE_BOUNDCHANGED,
+                  conshdlrdata->eventhdlr, &(*consdata)->vareventdata[i], (*consdata)->vareventdata[i].filterpos) );
+         }
       }
+      SCIPfreeBlockMemoryArrayNull(scip, &((*consdata)->lookupends), (*consdata)->nperms );
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->entrychanged), nvars );
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->changedentries), nvars );
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->fixed1bits), (*consdata)->nbitwords );
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->fixed0bits), (*consdata)->nbitwords );
       SCIPfreeBlockMemoryArray(scip, &((*consdata)->affectedentries), nvars );
+      SCIPfreeBlockMemoryArray(scip, &((*consdata)->uncaughtentries), nvars );
       SCIPfreeBlockMemoryArray(scip, &((*consdata)->vareventdata), nvars );
+
+      conshdlrdata->memused -= (*consdata)->memsize;
+      if ( conshdlrdata->memused < 0.0 )
+         conshdlrdata->memused = 0.0;
    }
 
+   SCIPfreeBlockMemoryArrayNull(scip, &((*consdata)->peekpayoff), nvars);
+
    /* free permutation stuff */
    permutation = (*consdata)->permutation;
 
    assert( permutation != NULL );
    assert( permutation->perm != NULL );
-   SCIPfreePermutationContents(scip, permutation, TRUE);
-   SCIPfreeBlockMemory(scip, &permutation);
+   SCIP_CALL( SCIPreleasePermutation(&permutation) );
 
    for (i = 0; i < nvars; ++i)
    {
@@ -483,19 +1391,42 @@ SCIP_DECL_EVENTEXEC(eventExec)
    assert( strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_SYMRETOPE_NAME) == 0 );
    assert( event != NULL );
 
+   /* Keep the snapshot of the local fixings up to date. */
+   if ( (SCIPeventGetType(event) & SCIP_EVENTTYPE_BOUNDCHANGED) != 0 )
+      updateFixingSnapshot(eventdata->consdata, eventdata->varid);
+
+   /* Cached propagation outcomes of this constraint are no longer used after a global bound change. */
+   if ( (SCIPeventGetType(event) & SCIP_EVENTTYPE_GBDCHANGED) != 0 )
+      ++(eventdata->consdata->cachegeneration);
+
    /* If the variable is impactful for the constraint (i.e. in the last propagator run it affected the outcome),
     * Then mark the propagator to run again. */
-   if ( !eventdata->consdata->execprop && eventdata->consdata->affectedentries[eventdata->varid] )
+   if ( eventdata->consdata->affectedentries[eventdata->varid] )
    {
       eventdata->consdata->execprop = TRUE;
+
+      /* Remember the entry, such that incremental propagation only re-evaluates the powers that looked it up. */
+      if ( !eventdata->consdata->entrychanged[eventdata->varid] )
+      {
+         eventdata->consdata->entrychanged[eventdata->varid] = TRUE;
+         eventdata->consdata->changedentries[eventdata->consdata->nchangedentries++] = eventdata->varid;
+      }
    }
    return SCIP_OKAY;
 }
 
+/* propagation kernels, selected in consdataCreate() */
+static SCIP_DECL_SYMRETOPEPROPKERNEL(propKernelMonotoneOrdered);
+static SCIP_DECL_SYMRETOPEPROPKERNEL(propKernelStandard);
+
+
 /** creates symretope constraint data
  *
  *  If the input data contains non-binary variables or fixed
  *  points, we delete these variables in a preprocessing step.
+ *
+ *  If a permutation object of a source constraint is given and the input data has neither non-binary variables nor
+ *  fixed points, the object is shared instead of recomputing its cycle decomposition and table of powers.
  */
 static
 SCIP_RETCODE consdataCreate(
@@ -505,17 +1436,20 @@ SCIP_RETCODE consdataCreate(
    SCIP_VAR*const*       inputvars,          /**< input variables of the constraint handler */
    int                   inputnvars,         /**< input number of variables of the constraint handler*/
    int*                  inputperm,          /**< input permutation of the constraint handler */
+   SCIP_PERMUTATION*     sharedpermutation,  /**< permutation object of inputperm to share, or NULL */
    SCIP_Bool             ismodelcons         /**< whether the symretope is a model constraint */
    )
 {
    SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_VAR** vars;
-   int* indexcorrection;
+   int* support;
    int* perm;
    int naffectedvariables;
    int i;
    int j = 0;
    SCIP_PERMUTATION* permutation;
+   SCIP_Bool withpowtable = FALSE;
+   SCIP_Real budget;
 
    assert( consdata != NULL );
    assert( conshdlr != NULL );
@@ -528,74 +1462,91 @@ SCIP_RETCODE consdataCreate(
 #endif
 
    (*consdata)->ismodelcons = ismodelcons;
+   (*consdata)->recordedfixings = NULL;
+   (*consdata)->recordedinferinfos = NULL;
+   (*consdata)->nrecordedfixings = 0;
+   (*consdata)->groupid = -1;
+   (*consdata)->memsize = 0.0;
+   (*consdata)->peekpayoff = NULL;
+   (*consdata)->propkernel = propKernelStandard;
 
    /* COMMENT: You need to catch the case inputnvars == 0, cf. merge request 2660 in SCIP */
    /* count the number of binary variables which are affected by the permutation */
-   SCIP_CALL( SCIPallocBufferArray(scip, &indexcorrection, inputnvars) );
-   indexcorrection[0] = -1;
+   naffectedvariables = 0;
    for (i = 0; i < inputnvars; ++i)
    {
       if ( inputperm[i] != i && SCIPvarIsBinary(inputvars[i]) )
-      {
-         if ( i == 0 )
-            indexcorrection[i] = 0;
-         else
-            indexcorrection[i] = indexcorrection[i - 1] + 1;
-      }
-      else
-      {
-         if ( i > 0 )
-            indexcorrection[i] = indexcorrection[i - 1];
-      }
+         ++naffectedvariables;
    }
-   naffectedvariables = indexcorrection[inputnvars - 1] + 1;
 
    (*consdata)->nvars = naffectedvariables;
 
    /* Stop if we detect that the permutation fixes each binary point. */
    if ( naffectedvariables == 0 )
    {
-      SCIPfreeBufferArrayNull(scip, &indexcorrection);
-
       (*consdata)->vars = NULL;
       (*consdata)->nperms = 0;
       (*consdata)->nperms = 0;
       (*consdata)->permutation = NULL;
+      (*consdata)->fixed0bits = NULL;
+      (*consdata)->fixed1bits = NULL;
+      (*consdata)->nbitwords = 0;
       return SCIP_OKAY;
    }
 
-   /* remove fixed points from permutation representation */
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &vars, naffectedvariables) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &perm, naffectedvariables) );
-   for (i = 0; i < inputnvars; ++i)
+   if ( sharedpermutation != NULL && naffectedvariables == inputnvars )
+   {
+      /* The input is already compressed, so only the variables are specific to this constraint. */
+      assert( sharedpermutation->nvars == inputnvars );
+#ifndef NDEBUG
+      for (i = 0; i < inputnvars; ++i)
+         assert( sharedpermutation->perm[i] == inputperm[i] );
+#endif
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &vars, inputvars, naffectedvariables) );
+
+      permutation = sharedpermutation;
+      SCIPcapturePermutation(permutation);
+      (*consdata)->permutation = permutation;
+   }
+   else
    {
-      if ( i == 0 )
+      /* Remove fixed points from permutation representation. The support is collected in increasing order, such that
+       * the image of a support entry is found by binary search, and no array of length inputnvars is needed.
+       */
+      SCIP_CALL( SCIPallocBufferArray(scip, &support, naffectedvariables) );
+      for (i = 0; i < inputnvars; ++i)
       {
-         if ( indexcorrection[i] > -1 )
-         {
-            vars[j] = inputvars[i];
-            perm[j++] = indexcorrection[inputperm[i]];
-         }
+         if ( inputperm[i] != i && SCIPvarIsBinary(inputvars[i]) )
+            support[j++] = i;
       }
-      else
+      assert( j == naffectedvariables );
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &vars, naffectedvariables) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &perm, naffectedvariables) );
+      for (j = 0; j < naffectedvariables; ++j)
       {
-         if ( indexcorrection[i] > indexcorrection[i - 1] )
-         {
-            vars[j] = inputvars[i];
-            perm[j++] = indexcorrection[inputperm[i]];
-         }
+         SCIP_Bool found;
+
+         vars[j] = inputvars[support[j]];
+         found = SCIPsortedvecFindInt(support, inputperm[support[j]], naffectedvariables, &perm[j]);
+         assert( found );
+         (void) found;
       }
-   }
-   SCIPfreeBufferArrayNull(scip, &indexcorrection);
+      SCIPfreeBufferArray(scip, &support);
 
-   SCIP_CALL( SCIPallocBlockMemory(scip, &permutation) );
-   (*consdata)->permutation = permutation;
+      SCIP_CALL( SCIPallocBlockMemory(scip, &permutation) );
+      (*consdata)->permutation = permutation;
 
-   SCIP_CALL( SCIPgetPermutation(scip, perm, naffectedvariables, permutation) );
+      SCIP_CALL( SCIPgetPermutation(scip, perm, naffectedvariables, permutation) );
+   }
 
    SCIPdebugMessage("Permutation: nvars=%d; ncycles=%d; order=%lld; ismonotone=%d; isordered=%d\n",
       permutation->nvars, permutation->ncycles, permutation->order, permutation->ismonotone, permutation->isordered);
 
+   /* The cycle structure does not change anymore, so the propagation kernel is fixed now. */
+   if ( permutation->ismonotone && permutation->isordered )
+      (*consdata)->propkernel = propKernelMonotoneOrdered;
+
    /* Specify the number of non-idenity permutations from the group to consider.
     * Note: the group order can be exponentially large;
     * If the group order is too large, then the number of considered permutations is limited.
@@ -605,32 +1556,74 @@ SCIP_RETCODE consdataCreate(
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert( conshdlrdata != NULL );
    (*consdata)->nperms = MIN(permutation->order - 1, INT_MAX);
-   if ( (*consdata)->nperms > conshdlrdata->maxorder
-      || (*consdata)->nperms * (*consdata)->nvars > conshdlrdata->maxordernvars )
-      SCIPwarningMessage(scip, "Symretope constraint will not capture all symmetries.\n");
-   if ( conshdlrdata->maxorder > 0 && (*consdata)->nperms > conshdlrdata->maxorder )
+   SCIP_CALL( getMemoryBudget(scip, conshdlrdata, &budget) );
+   if ( budget < 0.0 )
    {
-      (*consdata)->nperms = conshdlrdata->maxorder;
-      SCIPwarningMessage(scip, "=> The symmetry group order %lld is larger than maxorder: %d. "
-         "Restricting to %d permutations.\n",
-         permutation->order, conshdlrdata->maxorder, (*consdata)->nperms);
+      if ( (*consdata)->nperms > conshdlrdata->maxorder
+         || (*consdata)->nperms * (*consdata)->nvars > conshdlrdata->maxordernvars )
+         SCIPwarningMessage(scip, "Symretope constraint will not capture all symmetries.\n");
+      if ( conshdlrdata->maxorder > 0 && (*consdata)->nperms > conshdlrdata->maxorder )
+      {
+         (*consdata)->nperms = conshdlrdata->maxorder;
+         SCIPwarningMessage(scip, "=> The symmetry group order %lld is larger than maxorder: %d. "
+            "Restricting to %d permutations.\n",
+            permutation->order, conshdlrdata->maxorder, (*consdata)->nperms);
+      }
+      if ( conshdlrdata->maxordernvars > 0 && (*consdata)->nperms * (*consdata)->nvars > conshdlrdata->maxordernvars )
+      {
+         (*consdata)->nperms = conshdlrdata->maxordernvars / (*consdata)->nvars ;
+         /* In the extreme case that we have so many variables in the cycle that the integer division yields 0,
+          * we should run at least for a single permutation.
+          */
+         if ( (*consdata)->nperms <= 0 )
+            (*consdata)->nperms = 1;
+         SCIPwarningMessage(scip, "=> The symmetry group order * cardinality of support (%lld * %d) "
+            "is larger than maxordernvars: %d. Restricting to %d permutations.\n",
+            permutation->order, (*consdata)->nvars, conshdlrdata->maxordernvars, (*consdata)->nperms);
+      }
    }
-   if ( conshdlrdata->maxordernvars > 0 && (*consdata)->nperms * (*consdata)->nvars > conshdlrdata->maxordernvars )
+   else
    {
-      (*consdata)->nperms = conshdlrdata->maxordernvars / (*consdata)->nvars ;
-      /* In the extreme case that we have so many variables in the cycle that the integer division yields 0,
-       * we should run at least for a single permutation.
-       */
-      if ( (*consdata)->nperms <= 0 )
-         (*consdata)->nperms = 1;
-      SCIPwarningMessage(scip, "=> The symmetry group order * cardinality of support (%lld * %d) "
-         "is larger than maxordernvars: %d. Restricting to %d permutations.\n",
-         permutation->order, (*consdata)->nvars, conshdlrdata->maxordernvars, (*consdata)->nperms);
+      /* The memory budget replaces maxgroupordernvars, and maxgrouporder still limits the work per propagation. */
+      if ( conshdlrdata->maxorder > 0 && (*consdata)->nperms > conshdlrdata->maxorder )
+         (*consdata)->nperms = conshdlrdata->maxorder;
+
+      if ( SCIPisTransformed(scip) && (*consdata)->nperms > 0 )
+      {
+         SCIP_Real arenamem;
+         int nperms;
+
+         nperms = (*consdata)->nperms;
+         chooseBudgetedNPerms(conshdlrdata, permutation, budget, &(*consdata)->nperms, &withpowtable,
+            &(*consdata)->memsize, &arenamem);
+         conshdlrdata->memused += (*consdata)->memsize;
+         conshdlrdata->arenareserved = MAX(conshdlrdata->arenareserved, arenamem);
+
+         if ( (*consdata)->nperms < permutation->order - 1 )
+            SCIPwarningMessage(scip, "Symretope constraint will not capture all symmetries.\n");
+         if ( (*consdata)->nperms < nperms )
+         {
+            SCIPdebugMessage("Memory budget restricts symretope from %d to %d permutations (power table: %u).\n",
+               nperms, (*consdata)->nperms, withpowtable);
+         }
+      }
    }
 
    /* get transformed variables, if we are in the transformed problem */
    if ( SCIPisTransformed(scip) )
    {
+      /* Tabulate the powers used in propagation, such that permGet is a single lookup, if the memory budget allows. */
+      if ( budget < 0.0 )
+      {
+         withpowtable = (2.0 * (*consdata)->nperms + 1.0) * naffectedvariables * sizeof(int)
+            <= 1024.0 * 1024.0 * conshdlrdata->powtablememlimit;
+      }
+      /* A shared table belongs to the owner of the permutation object, since the owner frees it. */
+      if ( withpowtable && permutation->powtable == NULL && permutation->scip == scip )
+      {
+         SCIP_CALL( SCIPcomputePermutationPowTable(scip, permutation, (*consdata)->nperms) );
+      }
+
       /* Make sure that all variables cannot be multiaggregated (cannot be handled by cons_symretope, since one cannot
        * easily eliminate single variables from a symretope constraint.
        */
@@ -642,6 +1635,7 @@ SCIP_RETCODE consdataCreate(
 
       /* Add events */
       SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*consdata)->vareventdata), naffectedvariables) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*consdata)->uncaughtentries), naffectedvariables) );
       SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*consdata)->affectedentries), naffectedvariables) );
       for (i = 0; i < naffectedvariables; ++i)
       {
@@ -649,19 +1643,59 @@ SCIP_RETCODE consdataCreate(
          vareventdata = &(*consdata)->vareventdata[i];
          vareventdata->varid = i;
          vareventdata->consdata = *consdata;
-         SCIP_CALL( SCIPcatchVarEvent(scip, vars[i],
-            SCIP_EVENTTYPE_VARCHANGED,
-            conshdlrdata->eventhdlr, vareventdata, NULL) );
+         vareventdata->uncaughtpos = -1;
+
+         /* until the first propagation has determined the affected entries, every bound change is relevant */
+         (*consdata)->affectedentries[i] = TRUE;
+
+         /* Global bound changes are caught permanently, local ones only as long as the entry is affected. */
+         SCIP_CALL( SCIPcatchVarEvent(scip, vars[i], SCIP_EVENTTYPE_GBDCHANGED,
+               conshdlrdata->eventhdlr, vareventdata, NULL) );
+         SCIP_CALL( SCIPcatchVarEvent(scip, vars[i], SCIP_EVENTTYPE_BOUNDCHANGED,
+               conshdlrdata->eventhdlr, vareventdata, &vareventdata->filterpos) );
       }
+      (*consdata)->nuncaught = 0;
 
       /* Mark that we want to propagate. */
       (*consdata)->execprop = TRUE;
+
+      /* Incremental propagation needs a full propagation call first. */
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &((*consdata)->entrychanged), naffectedvariables) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*consdata)->changedentries), naffectedvariables) );
+      (*consdata)->nchangedentries = 0;
+      (*consdata)->lookupendsvalid = FALSE;
+      if ( (*consdata)->nperms > 0 )
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*consdata)->lookupends), (*consdata)->nperms) );
+      }
+      else
+         (*consdata)->lookupends = NULL;
+
+      (*consdata)->consid = conshdlrdata->nconsids++;
+      (*consdata)->cachegeneration = 0;
+
+      /* Allocate the snapshot of the local fixings; it is initialized once the variables are stored. */
+      (*consdata)->nbitwords = PACKEDNWORDS(naffectedvariables);
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &((*consdata)->fixed0bits), (*consdata)->nbitwords) );
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &((*consdata)->fixed1bits), (*consdata)->nbitwords) );
    }
    else
    {
       (*consdata)->vareventdata = NULL;
+      (*consdata)->uncaughtentries = NULL;
+      (*consdata)->nuncaught = 0;
       (*consdata)->affectedentries = NULL;
       (*consdata)->execprop = FALSE;
+      (*consdata)->lookupends = NULL;
+      (*consdata)->lookupendsvalid = FALSE;
+      (*consdata)->changedentries = NULL;
+      (*consdata)->entrychanged = NULL;
+      (*consdata)->nchangedentries = 0;
+      (*consdata)->consid = -1;
+      (*consdata)->cachegeneration = 0;
+      (*consdata)->fixed0bits = NULL;
+      (*consdata)->fixed1bits = NULL;
+      (*consdata)->nbitwords = 0;
    }
 
    for (i = 0; i < naffectedvariables; ++i)
@@ -670,6 +1704,12 @@ SCIP_RETCODE consdataCreate(
    }
    (*consdata)->vars = vars;
 
+   if ( (*consdata)->fixed0bits != NULL )
+   {
+      for (i = 0; i < naffectedvariables; ++i)
+         updateFixingSnapshot(*consdata, i);
+   }
+
    return SCIP_OKAY;
 }
 
@@ -720,7 +1760,7 @@ SCIP_RETCODE initLP(
    permutation = consdata->permutation;
 
    /* Get cycle of the first variable */
-   cycleid = permutation->varcycle[0];
+   cycleid = permutation->entries[0].cycle;
    cyclen = permutation->cyclelengths[cycleid];
    cycle = permutation->cycles[cycleid];
 
@@ -753,6 +1793,11 @@ SCIP_RETCODE initLP(
 
 /* Helper function:
  * During conflict analysis, list the variables that cause that "boundtype" cannot be tightened for "infervar".
+ *
+ * The reason of a fixing is recorded at inference time as the power of the permutation that forced it (inferinfo).
+ * The explanation is then the prefix of the lexicographic comparison for that power, up to the row that forces the
+ * fixing (or infeasibility). Only the entries of this prefix are touched, using clean buffer memory, so the running
+ * time is linear in the length of the prefix instead of in the number of variables.
  */
 static
 SCIP_RETCODE resolveSymretopeConflictVariables(
@@ -763,47 +1808,24 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
    int nvars,                                /**< The number of variables */
    SCIP_PERMUTATION* permutation,            /**< Permutation information */
    int permpow,                              /**< Power of the permutation for which the conflict should follow */
-   SCIP_BDCHGIDX* bdchgidx                   /**< Bound index at which the fixing of infervar is made. */
+   SCIP_BDCHGIDX* bdchgidx,                  /**< Bound index at which the fixing of infervar is made. */
+   int* nconflictvars                        /**< Pointer to increase by the number of bounds added to the conflict, or NULL */
 )
 {
+   int nadded = 0;
    int i;
    int j;
+   int r;
    #ifndef NDEBUG
    int infervarid;
    #endif
    int* virtualfixings;
 
-   /* Store all fixings part of our conflict. */
-   SCIP_CALL( SCIPallocBufferArray(scip, &virtualfixings, nvars) );
+   /* Store all fixings part of our conflict. The array is clean, and only the entries of the prefix are set. */
+   SCIP_CALL( SCIPallocCleanBufferArray(scip, &virtualfixings, nvars) );
    #ifndef NDEBUG
    infervarid = -1;
    #endif
-   for (i = 0; i < nvars; ++i)
-   {
-      virtualfixings[i] = UNFIXED;
-      if ( vars[i] == infervar )
-      {
-         #ifndef NDEBUG
-         infervarid = i;
-         #endif
-         /* If variable i gets fixed to 0, then upper bound is set.
-          * If variable i gets fixed to 1, then the lower bound is set.
-          * This is the case, because one cannot set the lower bound in an effective manner if we want to fix to 0,
-          * because this is the global lower bound, already.
-          */
-         if ( boundtype == SCIP_BOUNDTYPE_UPPER )
-            virtualfixings[i] = FIXED1;
-         /* Same: If variable i gets fixed to 1, then the lower bound is set.
-          * Infeasibility is found if we assume that it is 0.
-          */
-         else
-         {
-            assert( boundtype == SCIP_BOUNDTYPE_LOWER );
-            virtualfixings[i] = FIXED0;
-         }
-      }
-   }
-   assert( infervar == NULL || infervarid >= 0 );
 
    for (i=0; i < nvars; ++i)
    {
@@ -815,6 +1837,32 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
       if ( i == j )
          continue;
 
+      /* The fixing of infervar is known as soon as its row is reached.
+       * If variable i gets fixed to 0, then upper bound is set.
+       * If variable i gets fixed to 1, then the lower bound is set.
+       * This is the case, because one cannot set the lower bound in an effective manner if we want to fix to 0,
+       * because this is the global lower bound, already.
+       * Infeasibility is found if we assume the converse fixing.
+       */
+      for (r = 0; r < 2; ++r)
+      {
+         int entry = r == 0 ? i : j;
+
+         if ( virtualfixings[entry] == UNFIXED && vars[entry] == infervar )
+         {
+            #ifndef NDEBUG
+            infervarid = entry;
+            #endif
+            if ( boundtype == SCIP_BOUNDTYPE_UPPER )
+               virtualfixings[entry] = FIXED1;
+            else
+            {
+               assert( boundtype == SCIP_BOUNDTYPE_LOWER );
+               virtualfixings[entry] = FIXED0;
+            }
+         }
+      }
+
       /* If infeasibility is found. */
       if ( virtualfixings[i] == FIXED0 && virtualfixings[j] == FIXED1 )
          break;
@@ -829,6 +1877,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
          if ( SCIPvarGetLbAtIndex(vars[j], bdchgidx, FALSE) > 0.5 )
          {
             SCIP_CALL( SCIPaddConflictLb(scip, vars[j], bdchgidx) );
+            ++nadded;
             break;
          }
 
@@ -847,6 +1896,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
          if ( SCIPvarGetUbAtIndex(vars[i], bdchgidx, FALSE) < 0.5 )
          {
             SCIP_CALL( SCIPaddConflictUb(scip, vars[i], bdchgidx) );
+            ++nadded;
             break;
          }
 
@@ -865,6 +1915,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
       {
          assert( SCIPvarGetLbAtIndex(vars[i], bdchgidx, 0) < 0.5 );
          SCIP_CALL( SCIPaddConflictUb(scip, vars[i], bdchgidx) );
+         ++nadded;
          virtualfixings[i] = FIXED0;
 
          /* If it turns out to be (0, 1), break. */
@@ -875,6 +1926,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
             if ( vars[j] != infervar )
             {
                SCIP_CALL( SCIPaddConflictLb(scip, vars[j], bdchgidx) );
+               ++nadded;
             }
             break;
          }
@@ -888,6 +1940,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
       {
          assert( SCIPvarGetUbAtIndex(vars[j], bdchgidx, 0) > 0.5 );
          SCIP_CALL( SCIPaddConflictLb(scip, vars[j], bdchgidx) );
+         ++nadded;
          virtualfixings[j] = FIXED1;
 
          /* If it turns out to be (0, 1), break. */
@@ -898,6 +1951,7 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
             if ( vars[i] != infervar )
             {
                SCIP_CALL( SCIPaddConflictUb(scip, vars[i], bdchgidx) );
+               ++nadded;
             }
             break;
          }
@@ -913,18 +1967,31 @@ SCIP_RETCODE resolveSymretopeConflictVariables(
       assert( virtualfixings[i] == virtualfixings[j] );
    }
    /* We must have seen "infervarid", unless we have no infervar. */
-   assert( infervar == NULL || i >= infervarid || i >= permGet(permutation, infervarid, permpow) );
+   assert( infervar == NULL || infervarid >= 0 );
    /* The loop must always break somewhere. */
    assert( i < nvars );
 
-   SCIPfreeBufferArray(scip, &virtualfixings);
+   if ( nconflictvars != NULL )
+      *nconflictvars += nadded;
+
+   /* Clean the entries of the prefix again. */
+   for (r = 0; r <= i && r < nvars; ++r)
+   {
+      virtualfixings[r] = UNFIXED;
+      virtualfixings[permGet(permutation, r, -permpow)] = UNFIXED;
+   }
+
+   SCIPfreeCleanBufferArray(scip, &virtualfixings);
    return SCIP_OKAY;
 }
 
-/** Helper function: Get the variable fixing */
+/** Helper function: Get the variable fixing
+ *
+ *  The local bounds are read from the bit-packed snapshot of the constraint, if available.
+ */
 static
 int getVarFixing(
-   SCIP_VAR** vars,                          /**< The array of variables */
+   SCIP_CONSDATA* consdata,                  /**< The constraint data */
    int varid,                                /**< The variable ID for which the fixing is sought after */
    SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixings, /**< The virtual fixings structure, or NULL if fixings are applied globally. */
    SCIP_Bool useproblembounds,               /**< Whether local bounds of the problem instance should be used. */
@@ -932,7 +1999,10 @@ int getVarFixing(
 )
 {
    SCIP_VAR* var;
-   assert( vars != NULL );
+   int fixing;
+
+   assert( consdata != NULL );
+   assert( consdata->vars != NULL );
    /* if useproblembounds is FALSE, then virtualfixings must be defined. */
    assert( useproblembounds ? TRUE : virtualfixings != NULL );
 
@@ -945,7 +2015,7 @@ int getVarFixing(
    {
       #ifndef NDEBUG
       /* For debugging purposes, we do need var here. */
-      var = vars[varid];
+      var = consdata->vars[varid];
       assert( var != NULL );
       #endif
 
@@ -968,19 +2038,33 @@ int getVarFixing(
    /* The entry is not fixed virtually. Check the bounds of the problem (the local bounds). */
    if ( useproblembounds )
    {
-      var = vars[varid];
-      assert( var != NULL );
-      if ( SCIPvarGetLbLocal(var) > 0.5 )
+      if ( consdata->fixed0bits != NULL )
+         fixing = getSnapshotFixing(consdata, varid);
+      else
+      {
+         var = consdata->vars[varid];
+         assert( var != NULL );
+         if ( SCIPvarGetLbLocal(var) > 0.5 )
+            fixing = FIXED1;
+         else if ( SCIPvarGetUbLocal(var) < 0.5 )
+            fixing = FIXED0;
+         else
+            fixing = UNFIXED;
+      }
+
+      /* The snapshot must be in sync with the local bounds. */
+      assert( (SCIPvarGetLbLocal(consdata->vars[varid]) > 0.5) == (fixing == FIXED1) );
+      assert( (SCIPvarGetUbLocal(consdata->vars[varid]) < 0.5) == (fixing == FIXED0) );
+
+      if ( fixing == FIXED1 )
       {
-         assert( SCIPvarGetUbLocal(var) > 0.5 );
          assert( virtualfixings == NULL || (getVirtualFixing(virtualfixings, varid) & FIXED0) == 0 );
          if ( virtualfixings != NULL )
             setVirtualFixing(virtualfixings, varid, FIXED1);
          return FIXED1;
       }
-      else if ( SCIPvarGetUbLocal(var) < 0.5 )
+      else if ( fixing == FIXED0 )
       {
-         assert( SCIPvarGetLbLocal(var) < 0.5 );
          assert( virtualfixings == NULL || (getVirtualFixing(virtualfixings, varid) & FIXED1) == 0 );
          if ( virtualfixings != NULL )
             setVirtualFixing(virtualfixings, varid, FIXED0);
@@ -993,6 +2077,40 @@ int getVarFixing(
 }
 
 
+/** Helper function: Find the first entry in the contiguous index range [@p begin, @p end) that is not fixed.
+ *
+ *  If only the local bounds are of interest, the bit-packed snapshot is scanned word-wise. Otherwise, the entries are
+ *  looked up one by one.
+ *
+ *  @return the first unfixed entry, or -1 if all entries in the range are fixed.
+ */
+static
+int findFirstUnfixedEntry(
+   SCIP_CONSDATA* consdata,                  /**< The constraint data */
+   int begin,                                /**< The first entry of the range */
+   int end,                                  /**< The entry after the last entry of the range */
+   SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixings, /**< The virtual fixings structure, or NULL if fixings are applied globally. */
+   SCIP_Bool useproblembounds,               /**< Whether local bounds of the problem instance should be used. */
+   SCIP_Bool* checkedentries                 /**< For each variable entry, whether the entry has been looked up */
+)
+{
+   int i;
+
+   assert( consdata != NULL );
+
+   if ( virtualfixings == NULL && useproblembounds && consdata->fixed0bits != NULL )
+      return findFirstUnfixedSnapshotEntry(consdata, begin, end, checkedentries);
+
+   for (i = begin; i < end; ++i)
+   {
+      if ( getVarFixing(consdata, i, virtualfixings, useproblembounds, checkedentries) == UNFIXED )
+         return i;
+   }
+
+   return -1;
+}
+
+
 /** Helper function: Set the variable fixing.
  * If @p virtualfixings is not NULL, then the fixings are applied on the problem.
  * Otherwise, the fixings are applied on the virtual fixings defined by @p virtualfixings .
@@ -1018,6 +2136,8 @@ SCIP_RETCODE setVarFixing(
    if ( virtualfixings == NULL )
    {
       /* Virtual fixings are not defined, so we apply the fixings. */
+      SCIP_CONSDATA* consdata;
+
       if ( fixing == FIXED0 )
       {
          assert( vars[varid] != NULL );
@@ -1028,6 +2148,25 @@ SCIP_RETCODE setVarFixing(
          assert( vars[varid] != NULL );
          SCIP_CALL( SCIPinferVarLbCons(scip, vars[varid], 1.0, cons, inferinfo, FALSE, infeasible, tightened) ); /*lint !e713*/
       }
+
+      /* Do not rely on the bound change event being processed yet: update the snapshot right away. */
+      consdata = SCIPconsGetData(cons);
+      assert( consdata != NULL );
+      if ( *tightened && consdata->fixed0bits != NULL )
+         updateFixingSnapshot(consdata, varid);
+
+      /* Record the benefit of the power that lead to this fixing for the memory budget. */
+      if ( *tightened )
+         recordPowerBenefit(SCIPconshdlrGetData(SCIPconsGetHdlr(cons)), inferinfo);
+
+      /* Record the fixing for the propagation cache, if requested. A binary variable is fixed at most once. */
+      if ( *tightened && consdata->recordedfixings != NULL )
+      {
+         assert( consdata->recordedinferinfos != NULL );
+         assert( consdata->nrecordedfixings < consdata->nvars );
+         consdata->recordedfixings[consdata->nrecordedfixings] = fixing == FIXED1 ? varid + consdata->nvars : varid;
+         consdata->recordedinferinfos[consdata->nrecordedfixings++] = inferinfo;
+      }
    }
    else
    {
@@ -1188,9 +2327,9 @@ SCIP_RETCODE enqueueFixing(
                 * and why otherpermid wants to fix vars[i] to 1.
                 */
                SCIP_CALL( resolveSymretopeConflictVariables(scip, vars[i], SCIP_BOUNDTYPE_UPPER, vars, nvars,
-                  permutation, permpow, NULL) );
+                  permutation, permpow, NULL, NULL) );
                SCIP_CALL( resolveSymretopeConflictVariables(scip, vars[i], SCIP_BOUNDTYPE_LOWER, vars, nvars,
-                  permutation, otherpermpow, NULL) );
+                  permutation, otherpermpow, NULL, NULL) );
             }
             else /* I.e. b == FIXED1 */
             {
@@ -1199,9 +2338,9 @@ SCIP_RETCODE enqueueFixing(
                 * and why otherpermid wants to fix vars[i] to 0.
                 */
                SCIP_CALL( resolveSymretopeConflictVariables(scip, vars[i], SCIP_BOUNDTYPE_LOWER, vars, nvars,
-                  permutation, permpow, NULL) );
+                  permutation, permpow, NULL, NULL) );
                SCIP_CALL( resolveSymretopeConflictVariables(scip, vars[i], SCIP_BOUNDTYPE_UPPER, vars, nvars,
-                  permutation, otherpermpow, NULL) );
+                  permutation, otherpermpow, NULL, NULL) );
             }
 
             SCIP_CALL( SCIPanalyzeConflictCons(scip, cons, NULL) );
@@ -1290,6 +2429,27 @@ SCIP_RETCODE removeSubtree(
 }
 
 
+/** Whether the last evaluation of the power @p permpow of the constraint permutation has looked up @p entry
+ *
+ *  When evaluating a power, at index i both entry i and its preimage under the power are looked up. Hence, the
+ *  evaluation that stopped before index @p lookupend has looked up exactly the entries i and perm^permpow[i] for which
+ *  one of both is smaller than @p lookupend.
+ */
+static
+SCIP_Bool isEntryLookedUp(
+   SCIP_PERMUTATION*     permutation,        /**< the constraint permutation */
+   int                   permpow,            /**< the power of the permutation */
+   int                   lookupend,          /**< the index before which the last evaluation has looked up entries */
+   int                   entry               /**< the entry to test */
+   )
+{
+   assert( permutation != NULL );
+   assert( entry >= 0 && entry < permutation->nvars );
+
+   return entry < lookupend || permGet(permutation, entry, permpow) < lookupend;
+}
+
+
 static
 SCIP_RETCODE applyFixings(
    SCIP* scip,                               /**< SCIP instance */
@@ -1306,6 +2466,8 @@ SCIP_RETCODE applyFixings(
    SCIP_Bool* permsinqueue,                  /**< Pointer to the array for looking up which perms are in the queue */
    int* permsqueue,                          /**< Pointer to the permutation queue, which is implemented as a stack */
    int* permsqueuesize,                      /**< Pointer to integer storing the current number of permutations in the queue */
+   int* permindices,                         /**< For each permutation the index state, or -1 if it is not evaluated (yet) */
+   int* lookupends,                          /**< For each permutation the index before which its last evaluation looked up entries, or NULL if all are evaluated */
    int* ngen,                                /**< Pointer to store the number of propagations */
    SCIP_Bool* infeasible,                    /**< Pointer to store if infeasibility is found */
    SCIP_Bool* tightened                      /**< Pointer to store if the problem is tightened by the applied fixings */
@@ -1336,6 +2498,7 @@ SCIP_RETCODE applyFixings(
    assert( permsinqueue != NULL );
    assert( permsqueue != NULL );
    assert( permsqueuesize != NULL );
+   assert( permindices != NULL );
    assert( ngen != NULL );
    assert( infeasible != NULL );
    assert( tightened != NULL );
@@ -1368,6 +2531,16 @@ SCIP_RETCODE applyFixings(
       /* Update data structures */
       for (k=0; k < nperms; ++k)
       {
+         /* A permutation that is not evaluated has an empty implication tree. As its outcome of the last evaluation
+          * remains valid, it only needs to be evaluated if this fixing concerns an entry that it has looked up. */
+         if ( permindices[k] < 0 )
+         {
+            assert( lookupends != NULL );
+            if ( !isEntryLookedUp(permutation, permpows[k], lookupends[k], fixingvarid) )
+               continue;
+            permindices[k] = 0;
+         }
+
          permgraph = &permgraphs[2 * nvars * k];
          for (j = 0; j < 2; ++j)
          {
@@ -1486,7 +2659,7 @@ SCIP_RETCODE applyFixings(
                      {
                         SCIP_CALL( SCIPinitConflictAnalysis(scip, SCIP_CONFTYPE_PROPAGATION, FALSE) );
                         SCIP_CALL( resolveSymretopeConflictVariables(scip, NULL, SCIP_BOUNDTYPE_LOWER,
-                           vars, nvars, permutation, permpows[k], NULL) );
+                           vars, nvars, permutation, permpows[k], NULL, NULL) );
                         SCIP_CALL( SCIPanalyzeConflictCons(scip, cons, NULL) );
                      }
 
@@ -1624,6 +2797,10 @@ SCIP_RETCODE applyFixings(
  * When choosing @p basepow equal to 1 and @p support as all entries, the group generated by the permutation of the
  * constraint is considered. Otherwise, when different values are specified, the permutation is restricted to the
  * support and we use the permutation with @p basepow as exponent as generator.
+ *
+ * If @p incremental is TRUE, then only the permutations whose last evaluation (as stored in @p lookupends) has looked
+ * up an entry that changed since, or that is fixed during this call, are evaluated. The outcome of the evaluation of
+ * the other permutations cannot have changed. This requires that @p support is NULL.
  */
 static
 SCIP_RETCODE completeFixingsPerPermutation(
@@ -1639,7 +2816,10 @@ SCIP_RETCODE completeFixingsPerPermutation(
    SCIP_Bool*            checkedentries,     /**< For each variable index, whether their value has been looked up */
    int*                  impactfulentries,   /**< Whether entries appear in any implication tree, or NULL */
    int*                  nimpactfulentries,  /**< Pointer to how many impactful entries there are, already. */
-   SCIP_Bool*            entryisimpactful,   /**< Pointer to a boolean array specifying if an entry is impactful. */
+   int*                  impactfulepochs,    /**< Array specifying that an entry is impactful if its value equals epoch. */
+   int                   epoch,              /**< The epoch that marks impactful entries in impactfulepochs. */
+   int*                  lookupends,         /**< Array to store for each permutation the index before which it looked up entries, or NULL */
+   SCIP_Bool             incremental,        /**< Whether only the permutations affected by changed entries are evaluated */
    SCIP_Bool*            infeasible,         /**< pointer to store whether it was detected that the node is infeasible */
    int*                  ngen                /**< pointer to store number of generated bound strengthenings */
    )
@@ -1658,6 +2838,9 @@ SCIP_RETCODE completeFixingsPerPermutation(
    SCIP_SymretopeGraphNode* succ;
    SCIP_SymretopeGraphNode* twin;
    SCIP_SymretopeGraphNode* permgraph;
+   const int* powarr;
+   const int* invpowarr;
+   SCIP_Bool snapshotonly;
    int permpow;
    int leafid;
    int fixing;
@@ -1671,6 +2854,7 @@ SCIP_RETCODE completeFixingsPerPermutation(
    int jj;
    int k;
    SCIP_Bool tightened;
+   SCIP_CONSHDLRDATA* conshdlrdata;
 
    assert( scip != NULL );
    assert( cons != NULL );
@@ -1681,6 +2865,9 @@ SCIP_RETCODE completeFixingsPerPermutation(
    *ngen = 0;
    *infeasible = FALSE;
 
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+
    /* get data of constraint */
    consdata = SCIPconsGetData(cons);
    assert( consdata != NULL );
@@ -1710,7 +2897,7 @@ SCIP_RETCODE completeFixingsPerPermutation(
          return SCIP_OKAY;
 
       /* We must be able to store (at least) nperms powers in permpows. */
-      assert( nperms >= implgraph->maxnperms );
+      assert( nperms <= implgraph->maxnperms );
 
       /* The powers that need to be evaluated. */
       for (k = 0; k < nperms; ++k)
@@ -1777,26 +2964,57 @@ SCIP_RETCODE completeFixingsPerPermutation(
       permgraphleaves[2 * k + 1] = NULL;
    }
 
-   /* Initialize permutation indices. They start at 0. */
-   /* Initialize queues: Schedule all permutations that are not the identity. */
-   for (k = 0; k < nperms; ++k)
+   if ( incremental )
+   {
+      /* Only schedule the permutations that looked up a changed entry in their last evaluation. The others get index
+       * -1, such that they are only scheduled once a fixing of an entry they looked up is applied. */
+      assert( support == NULL );
+      assert( lookupends != NULL );
+      implgraph->permsqueuesize = 0;
+      for (k = 0; k < nperms; ++k)
+      {
+         implgraph->permindices[k] = -1;
+         implgraph->permsinqueue[k] = FALSE;
+         for (i = 0; i < consdata->nchangedentries; ++i)
+         {
+            if ( isEntryLookedUp(permutation, implgraph->permpows[k], lookupends[k], consdata->changedentries[i]) )
+            {
+               implgraph->permindices[k] = 0;
+               implgraph->permsinqueue[k] = TRUE;
+               implgraph->permsqueue[implgraph->permsqueuesize++] = k;
+               break;
+            }
+         }
+      }
+   }
+   else
    {
-      implgraph->permindices[k] = 0;
-      implgraph->permsinqueue[k] = TRUE;
-      implgraph->permsqueue[k] = k;
+      /* Initialize permutation indices. They start at 0. */
+      /* Initialize queues: Schedule all permutations that are not the identity. */
+      for (k = 0; k < nperms; ++k)
+      {
+         implgraph->permindices[k] = 0;
+         implgraph->permsinqueue[k] = TRUE;
+         implgraph->permsqueue[k] = k;
+      }
+      implgraph->permsqueuesize = nperms;
    }
-   implgraph->permsqueuesize = nperms;
 
    /* Variable fixings: To store the fixings of the two variables before extending the leaves. */
    SCIP_CALL( SCIPallocBufferArray(scip, &var1fixes, 2) );
    SCIP_CALL( SCIPallocBufferArray(scip, &var2fixes, 2) );
 
+   /* If only the local bounds are looked up and nobody records the lookups, the fixing of an entry is a plain lookup in
+    * the snapshot, which we decide once instead of in every getVarFixing() call of the index loop. */
+   snapshotonly = virtualfixings == NULL && useproblembounds && checkedentries == NULL && consdata->fixed0bits != NULL;
+
    while (implgraph->permsqueuesize > 0)
    {
       /* Pick a permutation that we still need to handle, and remove from queue. */
       k = implgraph->permsqueue[--implgraph->permsqueuesize];
       permpow = implgraph->permpows[k];
       implgraph->permsinqueue[k] = FALSE;
+      ++conshdlrdata->npowers;
 
       /* Get the permutation, and the inverse of the permutation. */
       assert( k >= 0 && k < nperms );
@@ -1806,6 +3024,10 @@ SCIP_RETCODE completeFixingsPerPermutation(
       root = &permgraphroots[k];
       permgraph = &permgraphs[2 * nvars * k];
 
+      /* Resolve the arrays of the power and its inverse once, if they are stored (e.g., tabulated or for involutions). */
+      powarr = permGetPowArray(permutation, permpow);
+      invpowarr = permGetPowArray(permutation, -permpow);
+
       /* apply events to current permutation until stopping criterion is met */
       while(TRUE)
       {
@@ -1871,7 +3093,7 @@ SCIP_RETCODE completeFixingsPerPermutation(
             break;
 
          /* If i is a fixed point for this permutation, then we increase the index by one and repeat. */
-         j = permGet(permutation, i, -permpow);
+         j = invpowarr != NULL ? invpowarr[i] : permGet(permutation, i, -permpow);
          assert( j >= 0 && j < nvars );
          if ( i == j )
          {
@@ -1885,18 +3107,18 @@ SCIP_RETCODE completeFixingsPerPermutation(
          if ( impactfulentries != NULL )
          {
             assert( nimpactfulentries != NULL );
-            assert( entryisimpactful != NULL );
+            assert( impactfulepochs != NULL );
 
-            if ( !entryisimpactful[i] )
+            if ( impactfulepochs[i] != epoch )
             {
                impactfulentries[(*nimpactfulentries)++] = i;
-               entryisimpactful[i] = TRUE;
+               impactfulepochs[i] = epoch;
                assert( *nimpactfulentries <= nvars );
             }
-            if ( !entryisimpactful[j] )
+            if ( impactfulepochs[j] != epoch )
             {
                impactfulentries[(*nimpactfulentries)++] = j;
-               entryisimpactful[j] = TRUE;
+               impactfulepochs[j] = epoch;
                assert( *nimpactfulentries <= nvars );
             }
          }
@@ -1908,10 +3130,12 @@ SCIP_RETCODE completeFixingsPerPermutation(
           * * perm[i] > i, invperm[i] > i.
           * Use that j = invperm[i].
           */
-         jj = permGet(permutation, i, permpow);
+         jj = powarr != NULL ? powarr[i] : permGet(permutation, i, permpow);
          if ( jj > i && j > i
-            && getVarFixing(vars, i, virtualfixings, useproblembounds, checkedentries) != FIXED0
-            && getVarFixing(vars, j, virtualfixings, useproblembounds, checkedentries) != FIXED1
+            && (snapshotonly ? getSnapshotFixing(consdata, i)
+               : getVarFixing(consdata, i, virtualfixings, useproblembounds, checkedentries)) != FIXED0
+            && (snapshotonly ? getSnapshotFixing(consdata, j)
+               : getVarFixing(consdata, j, virtualfixings, useproblembounds, checkedentries)) != FIXED1
             && (
                   (root->successor1 != NULL && root->successor1->nodetype == SYMRETOPE_COND)
                   || (root->successor2 != NULL && root->successor2->nodetype == SYMRETOPE_COND)
@@ -1935,7 +3159,8 @@ SCIP_RETCODE completeFixingsPerPermutation(
             assert( leaf->successor2 == NULL );
 
             /* Get the value of var i */
-            var1fix = getVarFixing(vars, i, virtualfixings, useproblembounds, checkedentries);
+            var1fix = snapshotonly ? getSnapshotFixing(consdata, i)
+               : getVarFixing(consdata, i, virtualfixings, useproblembounds, checkedentries);
             if ( var1fix == UNFIXED )
             {
                /* We can check whether an internal node exists by checking whether it has a predecessor. */
@@ -1961,7 +3186,8 @@ SCIP_RETCODE completeFixingsPerPermutation(
             var1fixes[leafid] = var1fix;
 
             /* Get the value of var j */
-            var2fix = getVarFixing(vars, j, virtualfixings, useproblembounds, checkedentries);
+            var2fix = snapshotonly ? getSnapshotFixing(consdata, j)
+               : getVarFixing(consdata, j, virtualfixings, useproblembounds, checkedentries);
             if ( var2fix == UNFIXED )
             {
                /* We can check whether a internal node exists by checking whether it has a predecessor. */
@@ -2128,7 +3354,7 @@ SCIP_RETCODE completeFixingsPerPermutation(
                      {
                         SCIP_CALL( SCIPinitConflictAnalysis(scip, SCIP_CONFTYPE_PROPAGATION, FALSE) );
                         SCIP_CALL( resolveSymretopeConflictVariables(scip, NULL, SCIP_BOUNDTYPE_LOWER, vars, nvars,
-                           permutation, permpow, NULL) );
+                           permutation, permpow, NULL, NULL) );
                         SCIP_CALL( SCIPanalyzeConflictCons(scip, cons, NULL) );
                      }
 
@@ -2234,13 +3460,13 @@ SCIP_RETCODE completeFixingsPerPermutation(
                            continue;
                         /* var dbg is fixed, or dbg is somewhere in the tree. */
                         assert(
-                           (getVarFixing(vars, dbg, virtualfixings, useproblembounds, checkedentries) != UNFIXED)
+                           (getVarFixing(consdata, dbg, virtualfixings, useproblembounds, checkedentries) != UNFIXED)
                            || ((&permgraph[2 * dbg + leafid])->predecessor != NULL)
                            || ((&permgraph[2 * dbg + (1 - leafid)])->predecessor != NULL)
                         );
                         /* var invperm[dbg] is fixed, or invperm[dbg] is somewhere in the tree. */
                         assert(
-                           (getVarFixing(vars, dbginv, virtualfixings, useproblembounds, checkedentries) != UNFIXED)
+                           (getVarFixing(consdata, dbginv, virtualfixings, useproblembounds, checkedentries) != UNFIXED)
                            || ((&permgraph[2 * dbginv + leafid])->predecessor != NULL)
                            || ((&permgraph[2 * dbginv + (1 - leafid)])->predecessor != NULL)
                         );
@@ -2343,6 +3569,7 @@ SCIP_RETCODE completeFixingsPerPermutation(
                nvars, nperms,
                fixingqueue,
                implgraph->permsinqueue, implgraph->permsqueue, &implgraph->permsqueuesize,
+               implgraph->permindices, lookupends,
                ngen, infeasible, &tightened) );
          if ( *infeasible )
             goto Cleanup;
@@ -2416,6 +3643,17 @@ SCIP_RETCODE completeFixingsPerPermutation(
       /* End of index increasing event for permutation k. */
    }
 
+   /* Store up to which index the evaluated permutations have looked up entries, for subsequent incremental calls. */
+   if ( lookupends != NULL )
+   {
+      assert( support == NULL );
+      for (k = 0; k < nperms; ++k)
+      {
+         if ( implgraph->permindices[k] >= 0 )
+            lookupends[k] = implgraph->permindices[k] + 1;
+      }
+   }
+
    Cleanup:
    /* Free memory: Variable fixings. */
    SCIPfreeBufferArray(scip, &var2fixes);
@@ -2448,23 +3686,77 @@ SCIP_RETCODE completeFixingsPerPermutation(
    {
       root = &permgraphroots[k];
 
-      SCIP_CALL( removeSubtree(scip, root, &permgraphleaves[2 * k]) );
-      assert( root->predecessor == NULL );
-      assert( root->successor1 == NULL );
-      assert( root->successor2 == NULL );
-   }
-   #ifndef NDEBUG
-   /* Sanity check: Make sure this memory is completely nulled by now. */
-   for (i = 0; i < 2 * nvars * nperms; ++i)
-   {
-      node = &permgraphs[i];
-      assert( node->fixing == 0 );
-      assert( node->nodetype == 0 );
-      assert( node->predecessor == NULL );
-      assert( node->successor1 == NULL );
-      assert( node->successor2 == NULL );
-   }
-   #endif
+      SCIP_CALL( removeSubtree(scip, root, &permgraphleaves[2 * k]) );
+      assert( root->predecessor == NULL );
+      assert( root->successor1 == NULL );
+      assert( root->successor2 == NULL );
+   }
+   #ifndef NDEBUG
+   /* Sanity check: Make sure this memory is completely nulled by now. */
+   for (i = 0; i < 2 * nvars * nperms; ++i)
+   {
+      node = &permgraphs[i];
+      assert( node->fixing == 0 );
+      assert( node->nodetype == 0 );
+      assert( node->predecessor == NULL );
+      assert( node->successor1 == NULL );
+      assert( node->successor2 == NULL );
+   }
+   #endif
+
+   return SCIP_OKAY;
+}
+
+/** Record that peeking on an entry lead to a fixing, such that later calls peek on this entry early */
+static
+SCIP_RETCODE recordPeekPayoff(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int                   i                   /**< entry on which peeking lead to a fixing */
+)
+{
+   assert( scip != NULL );
+   assert( consdata != NULL );
+   assert( 0 <= i && i < consdata->nvars );
+
+   if ( consdata->peekpayoff == NULL )
+   {
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &consdata->peekpayoff, consdata->nvars) );
+   }
+
+   if ( consdata->peekpayoff[i] < INT_MAX )
+      ++consdata->peekpayoff[i];
+
+   return SCIP_OKAY;
+}
+
+/** Order the stack of impactful entries such that the entries with the largest payoff of past peeks are popped first */
+static
+SCIP_RETCODE sortImpactfulEntriesByPayoff(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   int*                  impactfulentries,   /**< stack of impactful entries */
+   int                   nimpactfulentries   /**< number of impactful entries */
+)
+{
+   int* payoffs;
+   int k;
+
+   assert( scip != NULL );
+   assert( consdata != NULL );
+   assert( impactfulentries != NULL || nimpactfulentries == 0 );
+
+   if ( consdata->peekpayoff == NULL || nimpactfulentries <= 1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &payoffs, nimpactfulentries) );
+   for (k = 0; k < nimpactfulentries; ++k)
+      payoffs[k] = consdata->peekpayoff[impactfulentries[k]];
+
+   /* the stack is popped from the end, so sort increasingly */
+   SCIPsortIntInt(payoffs, impactfulentries, nimpactfulentries);
+
+   SCIPfreeBufferArray(scip, &payoffs);
 
    return SCIP_OKAY;
 }
@@ -2482,12 +3774,14 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
    int*                  ngen,               /**< pointer to store number of generated bound strengthenings */
    int                   eqpow,              /**< The power of the permutation that generates the strict equality-subgroup (in pseudocode: \mu) */
    int                   startcolour,        /**< The colour to start from. */
-   SCIP_SYMRETOPEGRAPH*  implgraph,          /**< Pointer to the implication graph data structure */
-   SCIP_FIXINGQUEUE*     fixingqueue,        /**< Pointer to the fixing queue data structure */
+   SCIP_SYMRETOPEARENA*  arena,              /**< Pointer to the arena holding the implication graph and fixing queue */
    SCIP_CONSDATA*        consdata,           /**< Constraint data of cons */
    SCIP_PERMUTATION*     permutation         /**< The permutation object that generates the group */
 )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_SYMRETOPEGRAPH* implgraph;
+   SCIP_FIXINGQUEUE* fixingqueue;
    int c;
    int i;
    int i_;
@@ -2499,12 +3793,19 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
    /* Marking for which entries peeking is necessary. */
    int* impactfulentries;
    int nimpactfulentries;
-   SCIP_Bool* entryisimpactful;
 
    assert( scip != NULL );
    assert( cons != NULL );
    assert( infeasible != NULL );
    assert( ngen != NULL );
+   assert( arena != NULL );
+   assert( arena->inuse );
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+
+   implgraph = &arena->implgraph;
+   fixingqueue = &arena->fixingqueue;
 
    assert( consdata != NULL );
    assert( consdata->vars != NULL );
@@ -2516,12 +3817,9 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
    assert( permutation->maxcyclesize >= 1 );
 
    /* If we are peeking, then we want to know which entries to peek on. */
+   nimpactfulentries = 0;
    if ( virtualfixings == NULL && findcompleteset )
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &impactfulentries, consdata->nvars) );
-      nimpactfulentries = 0;
-      SCIP_CALL( SCIPallocClearBufferArray(scip, &entryisimpactful, consdata->nvars) );
-   }
+      impactfulentries = arena->impactfulentries;
    else
       impactfulentries = NULL;
 
@@ -2539,9 +3837,13 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
       /* It is not possible that the generating power becomes larger than the order. */
       assert( eqpow < permutation->order );
 
-      /* Get the subcycle and length of subcycle c. */
+      /* Get the subcycle and length of subcycle c.
+       * Since the permutation is monotone and ordered, the cycle consists of the consecutive entries
+       * cycle[0], ..., cycle[0] + cyclen - 1.
+       */
       cycle = permutation->cycles[c];
       cyclen = permutation->cyclelengths[c];
+      assert( cycle[cyclen - 1] == cycle[0] + cyclen - 1 );
 
       /* Skip cycles for which the subcycle is trivial to the power eqpow. */
       if ( eqpow % cyclen == 0 )
@@ -2555,8 +3857,8 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
        * selected find equality for the previous cycles. This will also be found by the conflict analysis.
        */
       SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, eqpow, cycle, cyclen, virtualfixings,
-         useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, entryisimpactful, infeasible,
-         &newngen) );
+         useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, arena->impactfulepochs, arena->epoch,
+         NULL, FALSE, infeasible, &newngen) );
       *ngen += newngen;
 
       /* Infeasibility detected. Can stop here. */
@@ -2572,7 +3874,7 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
          SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixingspeek;
          int virtualngen;
 
-         SCIP_CALL( allocVirtualFixings(scip, &virtualfixingspeek, consdata->nvars) );
+         virtualfixingspeek = &arena->virtualfixingspeek;
 
          /* Get minimal unfixed entry in cycle.
           * We have shown that for a cycle (1, ..., n) there exists a vector X with X > perm(X),
@@ -2586,19 +3888,15 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
           *
           * Compute the first unfixed entry in the first half of the cycle.
           */
-         minunfixedentryinfirsthalfofcycle = -1;
-         for (i_ = 0; i_ < cyclen / 2; ++i_)
-         {
-            i = cycle[i_];
-            if ( getVarFixing(consdata->vars, i, virtualfixings, useproblembounds, NULL) == UNFIXED )
-            {
-               minunfixedentryinfirsthalfofcycle = i;
-               break;
-            }
-         }
+         minunfixedentryinfirsthalfofcycle = findFirstUnfixedEntry(consdata, cycle[0], cycle[0] + cyclen / 2,
+            virtualfixings, useproblembounds, NULL);
 
          peekinfeasible = FALSE;
          tightened = FALSE;
+
+         /* Peek on the entries with the largest payoff in past calls first, in case the peek budget runs out. */
+         SCIP_CALL( sortImpactfulEntriesByPayoff(scip, consdata, impactfulentries, nimpactfulentries) );
+
          // printf("Number of impactful entries: %i / %i \n", nimpactfulentries, consdata->nvars);
          while ( nimpactfulentries > 0 )
          {
@@ -2619,7 +3917,7 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
                 * fixings with inferinfo = -1, causing less effective RESPROP calls and leading to more running time. */
                SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, eqpow, cycle, cyclen,
                   virtualfixings, useproblembounds, checkedentries, impactfulentries, &nimpactfulentries,
-                  entryisimpactful, infeasible, &newngen) );
+                  arena->impactfulepochs, arena->epoch, NULL, FALSE, infeasible, &newngen) );
                *ngen += newngen;
 
                /* If infeasibility is found, then we can stop here. */
@@ -2629,9 +3927,21 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
             tightened = FALSE;
 
             /* If entry i is fixed, do not need to peek. */
-            if ( getVarFixing(consdata->vars, i, virtualfixings, useproblembounds, checkedentries) != UNFIXED )
+            if ( getVarFixing(consdata, i, virtualfixings, useproblembounds, checkedentries) != UNFIXED )
                continue;
 
+            /* Stop peeking if the budget of this propagation call is used up. */
+            if ( arena->npeeksleft <= 0 )
+            {
+               if ( arena->npeeksleft == 0 )
+               {
+                  ++conshdlrdata->npeekbudgetstops;
+                  arena->npeeksleft = -1;
+               }
+               nimpactfulentries = 0;
+               break;
+            }
+
             /* If i is the first unfixed entry and in the first half of the vector, fixing to 1 is possible.
              * Check: what if we fix to 0?
              */
@@ -2647,9 +3957,10 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
                   copyVirtualFixings(virtualfixings, virtualfixingspeek);
                assert( getVirtualFixing(virtualfixingspeek, i) == UNFIXED );
                setVirtualFixing(virtualfixingspeek, i, FIXED0);
+               ++conshdlrdata->npeekcalls;
+               --arena->npeeksleft;
                SCIP_CALL( propVariablesMonotoneOrderedHotstart(scip, cons, virtualfixingspeek, useproblembounds,
-                  checkedentries, FALSE, &peekinfeasible, &virtualngen, eqpow, c, implgraph, fixingqueue, consdata,
-                  permutation) );
+                  checkedentries, FALSE, &peekinfeasible, &virtualngen, eqpow, c, arena, consdata, permutation) );
                if ( peekinfeasible )
                {
                   /* Zero-fixing of "i" is not possible. Fix to 1. */
@@ -2657,7 +3968,11 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
                   if ( *infeasible )
                      goto CleanupPeek;
                   if ( tightened )
+                  {
                      ++(*ngen);
+                     ++conshdlrdata->npeekfixings;
+                     SCIP_CALL( recordPeekPayoff(scip, consdata, i) );
+                  }
 
                   continue;
                }
@@ -2675,9 +3990,10 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
                assert( getVirtualFixing(virtualfixingspeek, i) == UNFIXED );
                setVirtualFixing(virtualfixingspeek, i, FIXED1);
 
+               ++conshdlrdata->npeekcalls;
+               --arena->npeeksleft;
                SCIP_CALL( propVariablesMonotoneOrderedHotstart(scip, cons, virtualfixingspeek, useproblembounds,
-                  checkedentries, FALSE, &peekinfeasible, &virtualngen, eqpow, c, implgraph, fixingqueue, consdata,
-                  permutation) );
+                  checkedentries, FALSE, &peekinfeasible, &virtualngen, eqpow, c, arena, consdata, permutation) );
                if ( peekinfeasible )
                {
                   /* One-fixing of "i" is not possible. Fix to 0. */
@@ -2685,7 +4001,11 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
                   if ( *infeasible )
                      goto CleanupPeek;
                   if ( tightened )
+                  {
                      ++(*ngen);
+                     ++conshdlrdata->npeekfixings;
+                     SCIP_CALL( recordPeekPayoff(scip, consdata, i) );
+                  }
 
                   continue;
                }
@@ -2693,24 +4013,22 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
          }
 
          CleanupPeek:
-         freeVirtualFixings(scip, &virtualfixingspeek);
+         clearVirtualFixings(virtualfixingspeek);
       }
 
       /* Update eqpow */
-      unfixedExists = FALSE;
       SCIP_CALL( SCIPallocBufferArray(scip, &subcyclevalues, cyclen) );
 
-      /* Determine if there are unfixed entries.
-       * Additionally, fill "subcyclevalues" with 0- or 1-entries associated to the fixings.
-       */
+      /* Determine if there are unfixed entries. */
+      unfixedExists = findFirstUnfixedEntry(consdata, cycle[0], cycle[0] + cyclen, virtualfixings,
+         useproblembounds, checkedentries) >= 0;
+
+      /* If all entries are fixed, fill "subcyclevalues" with 0- or 1-entries associated to the fixings. */
       for (i_ = 0; i_ < cyclen && !unfixedExists; ++i_)
       {
          i = cycle[i_];
-         switch (getVarFixing(consdata->vars, i, virtualfixings, useproblembounds, checkedentries))
+         switch (getVarFixing(consdata, i, virtualfixings, useproblembounds, NULL))
          {
-            case UNFIXED:
-               unfixedExists = TRUE;
-               break;
             case FIXED0:
                subcyclevalues[i_] = 0;
                break;
@@ -2753,13 +4071,7 @@ SCIP_RETCODE propVariablesMonotoneOrderedHotstart(
       SCIPfreeBufferArray(scip, &subcyclevalues);
    }
 
-   /* Cleaning up */
-   if ( virtualfixings == NULL && findcompleteset )
-   {
-      assert( nimpactfulentries == 0 || *infeasible );
-      SCIPfreeBufferArray(scip, &impactfulentries);
-      SCIPfreeBufferArray(scip, &entryisimpactful);
-   }
+   assert( nimpactfulentries == 0 || *infeasible );
 
    return SCIP_OKAY;
 }
@@ -2778,8 +4090,7 @@ SCIP_RETCODE propVariablesMonotoneOrdered(
    int*                  ngen                /**< pointer to store number of generated bound strengthenings */
 )
 {
-   SCIP_SYMRETOPEGRAPH* implgraph;
-   SCIP_FIXINGQUEUE* fixingqueue;
+   SCIP_SYMRETOPEARENA* arena;
    SCIP_CONSDATA* consdata;
    SCIP_PERMUTATION* permutation;
 
@@ -2794,14 +4105,13 @@ SCIP_RETCODE propVariablesMonotoneOrdered(
    assert( permutation->isordered );
    assert( permutation->maxcyclesize >= 1 );
 
-   SCIP_CALL( allocSymretopeGraph(scip, &implgraph, consdata->nvars, permutation->maxcyclesize - 1) );
-   SCIP_CALL( allocFixingQueue(scip, &fixingqueue, consdata->nvars) );
+   SCIP_CALL( acquireArena(scip, SCIPconshdlrGetData(SCIPconsGetHdlr(cons)), consdata->nvars,
+      permutation->maxcyclesize - 1, 2 * consdata->nvars * (permutation->maxcyclesize - 1), &arena) );
 
    SCIP_CALL( propVariablesMonotoneOrderedHotstart(scip, cons, virtualfixings, useproblembounds, checkedentries,
-      findcompleteset, infeasible, ngen, 1, 0, implgraph, fixingqueue, consdata, permutation) );
+      findcompleteset, infeasible, ngen, 1, 0, arena, consdata, permutation) );
 
-   freeFixingQueue(scip, &fixingqueue);
-   freeSymretopeGraph(scip, &implgraph);
+   releaseArena(scip, &arena);
    return SCIP_OKAY;
 }
 
@@ -2814,17 +4124,20 @@ SCIP_RETCODE propVariablesStandard(
    SCIP_Bool             useproblembounds,   /**< whether or not the bounds of the problem must be used, in addition to the virtual fixings. */
    SCIP_Bool*            checkedentries,     /**< For each variable index, whether their value has been looked up */
    SCIP_Bool             dopeek,             /**< whether the complete set of fixings is sought after, or feasibility only */
+   SCIP_Bool             incremental,        /**< whether only permutations affected by changed entries may be evaluated */
    SCIP_Bool*            infeasible,         /**< pointer to store whether it was detected that the node is infeasible */
    int*                  ngen                /**< pointer to store number of generated bound strengthenings */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
+   SCIP_SYMRETOPEARENA* arena;
    SCIP_SYMRETOPEGRAPH* implgraph;
    SCIP_FIXINGQUEUE* fixingqueue;
    int* impactfulentries;
    int nimpactfulentries;
+   int* lookupends;
    int newngen;
-   SCIP_Bool* entryisimpactful;
 
    assert( scip != NULL );
    assert( cons != NULL );
@@ -2839,38 +4152,48 @@ SCIP_RETCODE propVariablesStandard(
    SCIPdebugMsg(scip, "Propagating variables of constraint <%s>; (%d).\n", SCIPconsGetName(cons), consdata->debugcnt);
    #endif
 
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+
+   /* Get the data structures for the permutation graph and the fixing queue, that we will recycle for various calls
+    * to the propagator */
+   SCIP_CALL( acquireArena(scip, conshdlrdata, consdata->nvars, consdata->nperms,
+      2 * consdata->nvars * consdata->nperms, &arena) );
+   implgraph = &arena->implgraph;
+   fixingqueue = &arena->fixingqueue;
+
    /* If we are peeking, then we want to know which entries are effective to peek on. */
+   nimpactfulentries = 0;
    if ( virtualfixings == NULL && dopeek )
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &impactfulentries, consdata->nvars) );
-      nimpactfulentries = 0;
-      SCIP_CALL( SCIPallocBufferArray(scip, &entryisimpactful, consdata->nvars) );
-   }
+      impactfulentries = arena->impactfulentries;
    else
       impactfulentries = NULL;
 
-   /* Initialize data structure for permutation graph */
-   SCIP_CALL( allocSymretopeGraph(scip, &implgraph, consdata->nvars, consdata->nperms) );
-
-   /* And for the fixing queue, that we will recycle for various calls to the propagator */
-   SCIP_CALL( allocFixingQueue(scip, &fixingqueue, consdata->nvars) );
+   /* Without peeking, the outcome per permutation only depends on the entries it looked up. We record these, such that
+    * the next call needs to evaluate only the permutations that looked up an entry whose bounds changed in between.
+    * Peeking depends on all permutations jointly, so then every call evaluates all permutations. */
+   lookupends = NULL;
+   if ( incremental && virtualfixings == NULL && !dopeek && consdata->lookupends != NULL )
+   {
+      lookupends = consdata->lookupends;
+      incremental = consdata->lookupendsvalid;
+   }
+   else
+      incremental = FALSE;
 
    /* First, compute fixings until the set of fixings is complete for all permutations in the group */
    SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, 1, NULL, -1, virtualfixings,
-      useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, entryisimpactful, infeasible, &newngen) );
+      useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, arena->impactfulepochs, arena->epoch,
+      lookupends, incremental, infeasible, &newngen) );
    *ngen += newngen;
 
+   if ( virtualfixings == NULL )
+      consdata->lookupendsvalid = lookupends != NULL && !(*infeasible);
+
    /* If infeasibility is found, then we can stop here. */
    if ( *infeasible )
    {
-      freeFixingQueue(scip, &fixingqueue);
-      freeSymretopeGraph(scip, &implgraph);
-
-      if ( virtualfixings == NULL && dopeek )
-      {
-         SCIPfreeBufferArray(scip, &impactfulentries);
-         SCIPfreeBufferArray(scip, &entryisimpactful);
-      }
+      releaseArena(scip, &arena);
       return SCIP_OKAY;
    }
 
@@ -2887,21 +4210,25 @@ SCIP_RETCODE propVariablesStandard(
       assert( consdata->vars != NULL );
       assert( consdata->nvars > 0 );
       tightened = FALSE;
-      SCIP_CALL( allocVirtualFixings(scip, &virtualfixingspeek, consdata->nvars) );
+      virtualfixingspeek = &arena->virtualfixingspeek;
+
+      /* Peek on the entries with the largest payoff in past calls first, in case the peek budget runs out. */
+      SCIP_CALL( sortImpactfulEntriesByPayoff(scip, consdata, impactfulentries, nimpactfulentries) );
+
       // printf("Number of impactful entries: %i / %i \n", nimpactfulentries, consdata->nvars);
       while ( nimpactfulentries > 0 )
       {
          /* Get the entry for which we would like to peek. */
          i = impactfulentries[--nimpactfulentries];
-         assert( entryisimpactful[i] );
+         assert( arena->impactfulepochs[i] == arena->epoch );
 
          if ( tightened )
          {
             /* Compute fixings until the set of fixings is complete for all permutations in the group, again.
              * We add new (not earlier encountered) entries to impactfulentries, if we happen to find them. */
             SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, 1, NULL, -1, virtualfixings,
-               useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, entryisimpactful,
-               infeasible, &newngen) );
+               useproblembounds, checkedentries, impactfulentries, &nimpactfulentries, arena->impactfulepochs,
+               arena->epoch, NULL, FALSE, infeasible, &newngen) );
             *ngen += newngen;
             /* If infeasibility is found, then we can stop here. */
             if ( *infeasible )
@@ -2909,14 +4236,29 @@ SCIP_RETCODE propVariablesStandard(
          }
          tightened = FALSE;
 
-         if ( getVarFixing(consdata->vars, i, NULL, useproblembounds, NULL) != UNFIXED )
+         if ( getVarFixing(consdata, i, NULL, useproblembounds, NULL) != UNFIXED )
             continue;
 
+         /* Stop peeking if the budget of this propagation call is used up. */
+         if ( arena->npeeksleft <= 0 )
+         {
+            if ( arena->npeeksleft == 0 )
+            {
+               ++conshdlrdata->npeekbudgetstops;
+               arena->npeeksleft = -1;
+            }
+            nimpactfulentries = 0;
+            break;
+         }
+
          /* What if variable "i" is 0? */
          clearVirtualFixings(virtualfixingspeek);
          setVirtualFixing(virtualfixingspeek, i, FIXED0);
+         ++conshdlrdata->npeekcalls;
+         --arena->npeeksleft;
          SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, 1, NULL, -1, virtualfixingspeek,
-            useproblembounds, checkedentries, NULL, NULL, NULL, &peekinfeasible, &virtualngen) );
+            useproblembounds, checkedentries, NULL, NULL, NULL, -1, NULL, FALSE, &peekinfeasible,
+            &virtualngen) );
          if ( peekinfeasible )
          {
             /* Zero-fixing of "i" is not possible. Fix to 1. */
@@ -2925,7 +4267,11 @@ SCIP_RETCODE propVariablesStandard(
             if ( *infeasible )
                goto Cleanup;
             if ( tightened )
+            {
                ++(*ngen);
+               ++conshdlrdata->npeekfixings;
+               SCIP_CALL( recordPeekPayoff(scip, consdata, i) );
+            }
 
             continue;
          }
@@ -2933,8 +4279,11 @@ SCIP_RETCODE propVariablesStandard(
          /* What if variable "i" is 1? */
          clearVirtualFixings(virtualfixingspeek);
          setVirtualFixing(virtualfixingspeek, i, FIXED1);
+         ++conshdlrdata->npeekcalls;
+         --arena->npeeksleft;
          SCIP_CALL( completeFixingsPerPermutation(scip, cons, implgraph, fixingqueue, 1, NULL, -1, virtualfixingspeek,
-            useproblembounds, checkedentries, NULL, NULL, NULL, &peekinfeasible, &virtualngen) );
+            useproblembounds, checkedentries, NULL, NULL, NULL, -1, NULL, FALSE, &peekinfeasible,
+            &virtualngen) );
          if ( peekinfeasible )
          {
             /* One-fixing of "i" is not possible. Fix to 0. */
@@ -2943,26 +4292,82 @@ SCIP_RETCODE propVariablesStandard(
             if ( *infeasible )
                goto Cleanup;
             if ( tightened )
+            {
                ++(*ngen);
+               ++conshdlrdata->npeekfixings;
+               SCIP_CALL( recordPeekPayoff(scip, consdata, i) );
+            }
 
             continue;
          }
       }
 
       Cleanup:
-      freeVirtualFixings(scip, &virtualfixingspeek);
+      clearVirtualFixings(virtualfixingspeek);
 
       assert( nimpactfulentries == 0 || *infeasible );
-      SCIPfreeBufferArray(scip, &impactfulentries);
-      SCIPfreeBufferArray(scip, &entryisimpactful);
    }
 
-   freeFixingQueue(scip, &fixingqueue);
-   freeSymretopeGraph(scip, &implgraph);
+   releaseArena(scip, &arena);
+
+   return SCIP_OKAY;
+}
+
+/** propagation kernel for monotone and ordered permutations */
+static
+SCIP_DECL_SYMRETOPEPROPKERNEL(propKernelMonotoneOrdered)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSDATA* consdata;
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+   assert( consdata->permutation->ismonotone && consdata->permutation->isordered );
+
+   ++conshdlrdata->nhotstartcalls;
+   SCIPstartClock(scip, conshdlrdata->hotstartclock);
+   SCIP_CALL( propVariablesMonotoneOrdered(scip, cons, virtualfixings, useproblembounds, checkedentries,
+      findcompleteset, infeasible, ngen) );
+   SCIPstopClock(scip, conshdlrdata->hotstartclock);
+
+   if ( virtualfixings == NULL )
+      consdata->lookupendsvalid = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** propagation kernel for general permutations */
+static
+SCIP_DECL_SYMRETOPEPROPKERNEL(propKernelStandard)
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+
+   ++conshdlrdata->nstandardcalls;
+   SCIPstartClock(scip, conshdlrdata->standardclock);
+   SCIP_CALL( propVariablesStandard(scip, cons, virtualfixings, useproblembounds, checkedentries,
+      findcompleteset, incremental, infeasible, ngen) );
+   SCIPstopClock(scip, conshdlrdata->standardclock);
 
    return SCIP_OKAY;
 }
 
+/** Whether propagation should determine the complete set of fixings by peeking */
+static
+SCIP_Bool isPeekingEnabled(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONSHDLRDATA*    conshdlrdata        /**< constraint handler data */
+)
+{
+   assert( conshdlrdata != NULL );
+
+   return conshdlrdata->symretopepeek && (SCIPinProbing(scip) ? conshdlrdata->probingpeek : TRUE);
+}
+
 /** The propagation function for the symretope constraint handler */
 static
 SCIP_RETCODE propVariables(
@@ -2971,6 +4376,7 @@ SCIP_RETCODE propVariables(
    SCIP_SYMRETOPEVIRTUALFIXINGS* virtualfixings, /**< virtual fixings structure, or NULL if fixings are to be applied globally. */
    SCIP_Bool             useproblembounds,   /**< whether or not the bounds of the problem must be used, in addition to the virtual fixings. */
    SCIP_Bool*            checkedentries,     /**< For each variable index, whether their value has been looked up */
+   SCIP_Bool             incremental,        /**< whether only permutations affected by changed entries may be evaluated */
    SCIP_Bool*            infeasible,         /**< pointer to store whether it was detected that the node is infeasible */
    int*                  ngen                /**< pointer to store number of generated bound strengthenings */
 )
@@ -2993,20 +4399,213 @@ SCIP_RETCODE propVariables(
    assert( consdata != NULL );
    assert( consdata->permutation != NULL );
 
-   findcompleteset = conshdlrdata->symretopepeek &&
-      (SCIPinProbing(scip) ? conshdlrdata->probingpeek : TRUE);
+   findcompleteset = isPeekingEnabled(scip, conshdlrdata);
 
-   if ( consdata->permutation->ismonotone && consdata->permutation->isordered )
+   assert( consdata->propkernel != NULL );
+   SCIP_CALL( consdata->propkernel(scip, cons, virtualfixings, useproblembounds, checkedentries, findcompleteset,
+         incremental, infeasible, ngen) );
+
+   /* The bound changes since the last call are accounted for now. */
+   if ( virtualfixings == NULL && consdata->entrychanged != NULL )
    {
-      // printf("Yep it's monotone and ordered!\n");
-      SCIP_CALL( propVariablesMonotoneOrdered(scip, cons, virtualfixings, useproblembounds, checkedentries,
-         findcompleteset, infeasible, ngen) );
+      while ( consdata->nchangedentries > 0 )
+         consdata->entrychanged[consdata->changedentries[--consdata->nchangedentries]] = FALSE;
    }
-   else
+
+   return SCIP_OKAY;
+}
+
+
+/** Catch the local bound change events of exactly the affected entries of a constraint.
+ *
+ *  Bound changes of the other entries do not trigger propagation, so dropping their events saves the event dispatch.
+ *  The dropped entries are kept in the uncaughtentries list, and their snapshot entries are updated by
+ *  syncFixingSnapshot() instead. An entry is removed from the list as soon as it is affected again.
+ */
+static
+SCIP_RETCODE updateEventCatching(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+)
+{
+   SCIP_EVENTDATA* vareventdata;
+   int entry;
+   int i;
+
+   assert( scip != NULL );
+   assert( conshdlrdata != NULL );
+   assert( consdata != NULL );
+   assert( consdata->vareventdata != NULL );
+   assert( consdata->affectedentries != NULL );
+   assert( consdata->uncaughtentries != NULL );
+
+   /* Catch the events of the uncaught entries that are affected again, and remove them from the list. */
+   i = 0;
+   while ( i < consdata->nuncaught )
+   {
+      entry = consdata->uncaughtentries[i];
+      if ( !consdata->affectedentries[entry] )
+      {
+         ++i;
+         continue;
+      }
+
+      vareventdata = &consdata->vareventdata[entry];
+      assert( vareventdata->filterpos < 0 );
+      assert( vareventdata->uncaughtpos == i );
+
+      SCIP_CALL( SCIPcatchVarEvent(scip, consdata->vars[entry], SCIP_EVENTTYPE_BOUNDCHANGED,
+            conshdlrdata->eventhdlr, vareventdata, &vareventdata->filterpos) );
+      vareventdata->uncaughtpos = -1;
+      ++conshdlrdata->neventswitches;
+
+      /* Move the last entry of the list to the freed position. */
+      --consdata->nuncaught;
+      if ( i < consdata->nuncaught )
+      {
+         consdata->uncaughtentries[i] = consdata->uncaughtentries[consdata->nuncaught];
+         consdata->vareventdata[consdata->uncaughtentries[i]].uncaughtpos = i;
+      }
+   }
+
+   /* Drop the events of the caught entries that are not affected, and add them to the list. */
+   for (i = 0; i < consdata->nvars; ++i)
+   {
+      vareventdata = &consdata->vareventdata[i];
+
+      if ( !consdata->affectedentries[i] && vareventdata->filterpos >= 0 )
+      {
+         SCIP_CALL( SCIPdropVarEvent(scip, consdata->vars[i], SCIP_EVENTTYPE_BOUNDCHANGED,
+               conshdlrdata->eventhdlr, vareventdata, vareventdata->filterpos) );
+         vareventdata->filterpos = -1;
+         vareventdata->uncaughtpos = consdata->nuncaught;
+         consdata->uncaughtentries[consdata->nuncaught++] = i;
+         ++conshdlrdata->neventswitches;
+      }
+   }
+   assert( 0 <= consdata->nuncaught && consdata->nuncaught <= consdata->nvars );
+
+   return SCIP_OKAY;
+}
+
+
+/** Propagate a constraint in the CONSPROP callback
+ *
+ *  If the propagation cache is enabled and holds the outcome for the current local state of the constraint, then that
+ *  outcome is applied again. The fixings are replayed in their original order with their original inference
+ *  information, such that conflict resolution sees the same local bounds as before. Otherwise, the constraint is
+ *  propagated and the outcome is stored in the cache.
+ */
+static
+SCIP_RETCODE propConsLocal(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_CONS*            cons,               /**< constraint to be propagated */
+   SCIP_Bool*            infeasible,         /**< pointer to store whether it was detected that the node is infeasible */
+   int*                  ngen                /**< pointer to store number of generated bound strengthenings */
+)
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_SYMRETOPECACHEENTRY* entry;
+   uint64_t* cachewords = NULL;
+   SCIP_Bool findcompleteset = FALSE;
+   SCIP_Bool usecache;
+   int i;
+
+   assert( scip != NULL );
+   assert( conshdlrdata != NULL );
+   assert( cons != NULL );
+   assert( infeasible != NULL );
+   assert( ngen != NULL );
+
+   consdata = SCIPconsGetData(cons);
+   assert( consdata != NULL );
+
+   /* The snapshot entries of entries whose events are not caught may be outdated. */
+   if ( consdata->fixed0bits != NULL )
+      syncFixingSnapshot(consdata);
+
+   usecache = conshdlrdata->propcachememlimit > 0 && consdata->fixed0bits != NULL && consdata->nvars > 0;
+   if ( usecache )
+   {
+      if ( conshdlrdata->propcache == NULL )
+      {
+         SCIP_CALL( createPropCache(scip, &conshdlrdata->propcache) );
+      }
+
+      /* The key is the snapshot of the local fixings. */
+      SCIP_CALL( SCIPallocBufferArray(scip, &cachewords, 2 * consdata->nbitwords) );
+      for (i = 0; i < consdata->nbitwords; ++i)
+      {
+         cachewords[i] = consdata->fixed0bits[i];
+         cachewords[consdata->nbitwords + i] = consdata->fixed1bits[i];
+      }
+      findcompleteset = isPeekingEnabled(scip, conshdlrdata);
+
+      entry = lookupPropCache(conshdlrdata->propcache, consdata, cachewords, findcompleteset);
+      if ( entry != NULL )
+      {
+         SCIP_Bool tightened;
+
+         for (i = 0; i < entry->nfixings && !(*infeasible); ++i)
+         {
+            SCIP_CALL( setVarFixing(scip, cons, consdata->vars, entry->fixings[i] % consdata->nvars, NULL,
+                  entry->fixings[i] >= consdata->nvars ? FIXED1 : FIXED0, infeasible, &tightened,
+                  entry->inferinfos[i]) );
+            if ( tightened )
+               ++(*ngen);
+         }
+         if ( entry->infeasible )
+            *infeasible = TRUE;
+
+         /* It is unknown which entries this outcome depends on, so every bound change triggers propagation again. */
+         for (i = 0; i < consdata->nvars; ++i)
+            consdata->affectedentries[i] = TRUE;
+         consdata->lookupendsvalid = FALSE;
+
+         if ( conshdlrdata->dynamicevents )
+         {
+            SCIP_CALL( updateEventCatching(scip, conshdlrdata, consdata) );
+         }
+
+         SCIPfreeBufferArray(scip, &cachewords);
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &consdata->recordedfixings, consdata->nvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &consdata->recordedinferinfos, consdata->nvars) );
+      consdata->nrecordedfixings = 0;
+   }
+
+   /* Clear the affected entries list, unless propagation is incremental: then the permutations that are not
+    * evaluated again keep depending on the entries they looked up before. */
+   if ( !conshdlrdata->incrementalprop || !consdata->lookupendsvalid )
+   {
+      for (i = 0; i < consdata->nvars; ++i)
+         consdata->affectedentries[i] = FALSE;
+   }
+
+   SCIP_CALL( propVariables(scip, cons, NULL, TRUE, consdata->affectedentries, conshdlrdata->incrementalprop,
+         infeasible, ngen) );
+
+   if ( usecache )
    {
-      // printf("Not monotone and ordered!\n");
-      SCIP_CALL( propVariablesStandard(scip, cons, virtualfixings, useproblembounds, checkedentries,
-         findcompleteset, infeasible, ngen) );
+      SCIP_CALL( insertPropCache(scip, conshdlrdata->propcache, 1024LL * 1024LL * conshdlrdata->propcachememlimit,
+            consdata, cachewords, findcompleteset, *infeasible, consdata->recordedfixings,
+            consdata->recordedinferinfos, *infeasible ? 0 : consdata->nrecordedfixings) );
+
+      SCIPfreeBufferArray(scip, &consdata->recordedinferinfos);
+      SCIPfreeBufferArray(scip, &consdata->recordedfixings);
+      consdata->recordedinferinfos = NULL;
+      consdata->recordedfixings = NULL;
+      consdata->nrecordedfixings = 0;
+      SCIPfreeBufferArray(scip, &cachewords);
+   }
+
+   if ( conshdlrdata->dynamicevents && consdata->vareventdata != NULL )
+   {
+      SCIP_CALL( updateEventCatching(scip, conshdlrdata, consdata) );
    }
 
    return SCIP_OKAY;
@@ -3068,6 +4667,8 @@ SCIP_RETCODE addSymresackInequality(
 
 /** Maximize a linear function on a "strict" symresack,
  *  that is a symresack where we do not allow the solution x = gamma(x).
+ *
+ *  The work arrays are passed by the caller, such that they can be shared by all powers of a separation round.
  */
 static
 SCIP_RETCODE maximizeObjectiveSymresackStrict(
@@ -3076,6 +4677,8 @@ SCIP_RETCODE maximizeObjectiveSymresackStrict(
    SCIP_Real*           objective,           /**< the objective vector */
    int*                 perm,                /**< the permutation (without fixed points) as an array */
    int*                 invperm,             /**< the inverse permutation as an array */
+   int*                 componentends,       /**< work array of size nvars for the other ends of the paths */
+   SCIP_Real*           componentobj,        /**< work array of size nvars for the objectives of the paths */
    int*                 maxcrit,             /**< pointer to the critical entry where optimality is found at */
    SCIP_Real*           maxsoluval           /**< pointer to store the optimal objective value */
 )
@@ -3091,15 +4694,13 @@ SCIP_RETCODE maximizeObjectiveSymresackStrict(
    int critinv;
    int i;
 
-   /* For every vertex of degree < 2 we maintain componentends and componentobj. */
-   int* componentends;
-   SCIP_Real* componentobj;
-
    assert( scip != NULL );
    assert( nvars > 0 );
    assert( objective != NULL );
    assert( perm != NULL );
    assert( invperm != NULL );
+   assert( componentends != NULL );
+   assert( componentobj != NULL );
    assert( maxcrit != NULL );
    assert( maxsoluval != NULL );
 
@@ -3107,10 +4708,8 @@ SCIP_RETCODE maximizeObjectiveSymresackStrict(
    *maxcrit = -1;
    *maxsoluval = -SCIP_DEFAULT_INFINITY;
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &componentends, nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &componentobj, nvars) );
-
-   /* Initialization: Every entry is a component in the graph,
+   /* For every vertex of degree < 2 we maintain componentends and componentobj.
+    * Initialization: Every entry is a component in the graph,
     * having the corresponding objective
     */
    for (i = 0; i < nvars; ++i)
@@ -3181,9 +4780,6 @@ SCIP_RETCODE maximizeObjectiveSymresackStrict(
    /* It is always possible to make the first non-fixed entry critical. */
    assert( *maxcrit >= 0 );
 
-   SCIPfreeBufferArray(scip, &componentobj);
-   SCIPfreeBufferArray(scip, &componentends);
-
    return SCIP_OKAY;
 }
 
@@ -3199,13 +4795,11 @@ SCIP_RETCODE maximizeObjectiveSymresackCriticalEntry(
    int*                 perm,                /**< the permutation (without fixed points) as an array */
    int*                 invperm,             /**< the inverse permutation as an array */
    int                  crit,                /**< critical entry where optimality is found at */
+   int*                 entrycomponent,      /**< work array of size nvars for the component of each entry */
+   SCIP_Real*           componentobjective,  /**< work array of size nvars for the objectives of the components */
    int*                 maxsolu              /**< pointer to the optimal objective array */
 )
 {
-   /* Compute to which components all entries belong. */
-   int* entrycomponent;
-   SCIP_Real* componentobjective;
-
    int i;
    int c;
 
@@ -3214,13 +4808,12 @@ SCIP_RETCODE maximizeObjectiveSymresackCriticalEntry(
    assert( objective != NULL );
    assert( perm != NULL );
    assert( invperm != NULL );
+   assert( entrycomponent != NULL );
+   assert( componentobjective != NULL );
    assert( maxsolu != NULL );
    assert( crit >= 0 );
    assert( crit <= nvars );
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &entrycomponent, nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &componentobjective, nvars) );
-
    /* Initially: Everything forms its own component */
    for (i = 0; i < nvars; ++i)
    {
@@ -3297,13 +4890,15 @@ SCIP_RETCODE maximizeObjectiveSymresackCriticalEntry(
          maxsolu[i] = 0;
    }
 
-   SCIPfreeBufferArray(scip, &componentobjective);
-   SCIPfreeBufferArray(scip, &entrycomponent);
-
    return SCIP_OKAY;
 }
 
 /** separate symresack cover inequalities
+ *
+ *  The symresacks of all powers are separated in one round. The power perm^k is obtained from perm^(k-1) by one
+ *  composition with perm, and the work arrays of the oracles are shared by all powers. Since the sum of the positive
+ *  objective coefficients bounds the maximal violation, powers for which this bound is not efficacious are skipped,
+ *  and a maximally violated cover is only computed if the critical entry yields a violated cover.
  *
  *  We currently do NOT enter cuts into the pool.
  */
@@ -3317,12 +4912,17 @@ SCIP_RETCODE separateSymresackCoversSymretope(
    SCIP_Bool*            infeasible          /**< pointer to store whether we detected infeasibility */
    )
 {
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_Real constobjective;
+   SCIP_Real posobjective;
    SCIP_Real* sepaobjective;
+   SCIP_Real* componentobj;
    SCIP_Real maxsoluobj;
+   int* componentends;
    int* maxsolu;
    int* invperm;
    int* perm;
+   int* genperm;
    int nvars;
    int maxcrit;
    int i;
@@ -3352,11 +4952,21 @@ SCIP_RETCODE separateSymresackCoversSymretope(
    SCIP_CALL( SCIPallocBufferArray(scip, &maxsolu, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &perm, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &invperm, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &componentends, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &componentobj, nvars) );
+
+   genperm = consdata->permutation->perm;
+   for (i = 0; i < nvars; ++i)
+      perm[i] = i;
 
    for (k=1; k <= consdata->nperms; ++k)
    {
-      SCIP_CALL( getPermArray(consdata->permutation, k, perm, nvars) );
-      SCIP_CALL( getPermArray(consdata->permutation, -k, invperm, nvars) );
+      /* perm^k = perm o perm^(k-1) */
+      for (i = 0; i < nvars; ++i)
+      {
+         perm[i] = genperm[perm[i]];
+         invperm[perm[i]] = i;
+      }
 
       #ifndef NDEBUG
       {
@@ -3371,6 +4981,7 @@ SCIP_RETCODE separateSymresackCoversSymretope(
 
       /* initialize objective */
       constobjective = 1.0; /* constant part of separation objective */
+      posobjective = 0.0;
       for (i = 0; i < nvars; ++i)
       {
          if ( i < perm[i] )
@@ -3382,14 +4993,20 @@ SCIP_RETCODE separateSymresackCoversSymretope(
          }
          else
             sepaobjective[i] = 0;
+
+         if ( SCIPisGT(scip, sepaobjective[i], 0.0) )
+            posobjective += sepaobjective[i];
       }
 
+      /* no cover of this power can be violated */
+      if ( ! SCIPisEfficacious(scip, posobjective + constobjective) )
+         continue;
+
       /* Find critical row of a maximally violated cover */
-      SCIP_CALL( maximizeObjectiveSymresackStrict(scip, nvars, sepaobjective, perm, invperm, &maxcrit, &maxsoluobj) );
+      SCIP_CALL( maximizeObjectiveSymresackStrict(scip, nvars, sepaobjective, perm, invperm, componentends, componentobj,
+            &maxcrit, &maxsoluobj) );
       assert( maxcrit >= 0 );
       assert( invperm[maxcrit] != maxcrit );
-      SCIPdebugMsg(scip, "Critical row %d found; Computing maximally violated cover.\n", maxcrit);
-      SCIP_CALL( maximizeObjectiveSymresackCriticalEntry(scip, nvars, sepaobjective, perm, invperm, maxcrit, maxsolu) );
 
       /* Add constant to maxsoluobj to get the real objective */
       maxsoluobj += constobjective;
@@ -3397,6 +5014,10 @@ SCIP_RETCODE separateSymresackCoversSymretope(
       /* Check whether the separation objective is positive, i.e., a violated cover was found. */
       if ( SCIPisEfficacious(scip, maxsoluobj) )
       {
+         SCIPdebugMsg(scip, "Critical row %d found; Computing maximally violated cover.\n", maxcrit);
+         SCIP_CALL( maximizeObjectiveSymresackCriticalEntry(scip, nvars, sepaobjective, perm, invperm, maxcrit,
+               componentends, componentobj, maxsolu) );
+
          /* Now add the cut. Reuse array maxsolu as coefficient vector for the constraint. */
          SCIP_Real rhs = -1.0;
          for (i = 0; i < nvars; ++i)
@@ -3423,6 +5044,13 @@ SCIP_RETCODE separateSymresackCoversSymretope(
       }
    }
 
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert( conshdlrdata != NULL );
+   ++conshdlrdata->nsepacalls;
+   conshdlrdata->nsepacuts += *ngen;
+
+   SCIPfreeBufferArrayNull(scip, &componentobj);
+   SCIPfreeBufferArrayNull(scip, &componentends);
    SCIPfreeBufferArrayNull(scip, &invperm);
    SCIPfreeBufferArrayNull(scip, &perm);
    SCIPfreeBufferArrayNull(scip, &maxsolu);
@@ -3445,14 +5073,11 @@ SCIP_RETCODE checkSymretopeSolution(
    SCIP_CONSDATA* consdata;
    SCIP_PERMUTATION* permutation;
    SCIP_VAR** vars;
+   SCIP_Real* vals;
+   uint64_t* packedsol;
    int nvars;
    int i;
-   int j;
    int k;
-   SCIP_Real vali;
-   SCIP_Real valj;
-   int intvali;
-   int intvalj;
 
    assert( cons != NULL );
    consdata = SCIPconsGetData(cons);
@@ -3472,35 +5097,41 @@ SCIP_RETCODE checkSymretopeSolution(
    nvars = consdata->nvars;
    permutation = consdata->permutation;
 
+   /* get the solution values once, and pack them such that the comparisons can be done word-wise */
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &packedsol, PACKEDNWORDS(nvars)) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, nvars, vars, vals) );
+#ifndef NDEBUG
+   for (i = 0; i < nvars; ++i)
+      assert( SCIPisFeasIntegral(scip, vals[i]) );
+#endif
+   packBinaryVector(vals, nvars, packedsol);
+
    /* detect first non-constant pair of variables */
    for (k = 1; k <= consdata->nperms; ++k)
    {
-      for (i = 0; i < nvars; ++i)
-      {
-         j = permGet(permutation, i, -k);
-         vali = SCIPgetSolVal(scip, sol, vars[i]);
-         assert( SCIPisFeasIntegral(scip, vali) );
-         intvali = vali > 0.5 ? 1 : 0;
+      i = permFindFirstPackedDifference(permutation, -k, packedsol);
 
-         valj = SCIPgetSolVal(scip, sol, vars[j]);
-         assert( SCIPisFeasIntegral(scip, valj) );
-         intvalj = valj > 0.5 ? 1 : 0;
+      /* the solution and its image coincide */
+      if ( i < 0 )
+         continue;
 
-         if ( intvali < intvalj )
-         {
-            *result = SCIP_INFEASIBLE;
-            SCIPdebugMsg(scip, "Solution is infeasible.\n");
-            if ( printreason )
-               SCIPinfoMessage(scip, NULL,
-                  "Permutation perm[%d] has first non-constant pair (%d, %d) of variables has pattern (0,1).\n",
-                  k, i, j);
-            return SCIP_OKAY;
-         }
-         if ( intvali > intvalj )
-            break;
-         assert( intvali == intvalj );
+      /* pair is (0,1) --> solution is infeasible */
+      if ( (packedsol[PACKEDWORD(i)] & PACKEDMASK(i)) == 0 )
+      {
+         *result = SCIP_INFEASIBLE;
+         SCIPdebugMsg(scip, "Solution is infeasible.\n");
+         if ( printreason )
+            SCIPinfoMessage(scip, NULL,
+               "Permutation perm[%d] has first non-constant pair (%d, %d) of variables has pattern (0,1).\n",
+               k, i, permGet(permutation, i, -k));
+         break;
       }
    }
+
+   SCIPfreeBufferArray(scip, &packedsol);
+   SCIPfreeBufferArray(scip, &vals);
+
    return SCIP_OKAY;
 }
 
@@ -3787,6 +5418,89 @@ SCIP_RETCODE SCIPcreateSymbreakConsSymretope(
 }
 
 
+/*
+ * Table callback methods
+ */
+
+/** table data */
+struct SCIP_TableData
+{
+   SCIP_CONSHDLRDATA*    conshdlrdata;       /**< pass data of constraint handler for table output function */
+};
+
+
+/** output method of symretope constraint handler statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUT(tableOutputSymretope)
+{
+   SCIP_TABLEDATA* tabledata;
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Longint ncalls;
+
+   assert( scip != NULL );
+   assert( table != NULL );
+
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+   conshdlrdata = tabledata->conshdlrdata;
+   assert( conshdlrdata != NULL );
+
+   ncalls = conshdlrdata->nhotstartcalls + conshdlrdata->nstandardcalls;
+   if ( ncalls == 0 && conshdlrdata->nexecpropskips == 0 && conshdlrdata->nsepacalls == 0 )
+      return SCIP_OKAY;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "Symretope          :       Time      Calls\n");
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  monotone ordered : %10.2f %10" SCIP_LONGINT_FORMAT "\n",
+      SCIPgetClockTime(scip, conshdlrdata->hotstartclock), conshdlrdata->nhotstartcalls);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  standard         : %10.2f %10" SCIP_LONGINT_FORMAT "\n",
+      SCIPgetClockTime(scip, conshdlrdata->standardclock), conshdlrdata->nstandardcalls);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  powers per call  : %10.2f\n",
+      ncalls > 0 ? (SCIP_Real) conshdlrdata->npowers / ncalls : 0.0);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  execprop skips   : %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->nexecpropskips);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  event switches   : %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->neventswitches);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  peek calls       : %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->npeekcalls);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  peek fixings     : %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->npeekfixings);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  peek budget stops: %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->npeekbudgetstops);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  resprops         : %10" SCIP_LONGINT_FORMAT "\n",
+      conshdlrdata->nresprops);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  avg. expl. length: %10.2f\n",
+      conshdlrdata->nresprops > 0 ? (SCIP_Real) conshdlrdata->nresproplength / conshdlrdata->nresprops : 0.0);
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  cover separation : %10" SCIP_LONGINT_FORMAT " calls, %"
+      SCIP_LONGINT_FORMAT " cuts\n", conshdlrdata->nsepacalls, conshdlrdata->nsepacuts);
+   if ( conshdlrdata->nbudgetlimited > 0 || conshdlrdata->nbudgetdegraded > 0 )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  memory budget    : %10d limited, %d degraded\n",
+         conshdlrdata->nbudgetlimited, conshdlrdata->nbudgetdegraded);
+   }
+   if ( conshdlrdata->propcache != NULL )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, file, "  cache lookups    : %10" SCIP_LONGINT_FORMAT " (%"
+         SCIP_LONGINT_FORMAT " hits)\n", conshdlrdata->propcache->nlookups, conshdlrdata->propcache->nhits);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** destructor of statistics table to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_TABLEFREE(tableFreeSymretope)
+{
+   SCIP_TABLEDATA* tabledata;
+   tabledata = SCIPtableGetData(table);
+   assert( tabledata != NULL );
+
+   SCIPfreeBlockMemory(scip, &tabledata);
+
+   return SCIP_OKAY;
+}
+
+
 /*--------------------------------------------------------------------------------------------
  *--------------------------------- SCIP functions -------------------------------------------
  *--------------------------------------------------------------------------------------------*/
@@ -3836,12 +5550,81 @@ SCIP_DECL_CONSFREE(consFreeSymretope)
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert( conshdlrdata != NULL );
 
+   if ( conshdlrdata->arena != NULL )
+      freeArena(scip, &conshdlrdata->arena);
+   conshdlrdata->arenareserved = 0.0;
+
+   if ( conshdlrdata->propcache != NULL )
+   {
+      SCIP_CALL( freePropCache(scip, &conshdlrdata->propcache) );
+   }
+
+   SCIP_CALL( SCIPfreeClock(scip, &conshdlrdata->standardclock) );
+   SCIP_CALL( SCIPfreeClock(scip, &conshdlrdata->hotstartclock) );
+
    SCIPfreeBlockMemory(scip, &conshdlrdata);
 
    return SCIP_OKAY;
 }
 
 
+/** initialization method of constraint handler (called after problem was transformed) */
+static
+SCIP_DECL_CONSINIT(consInitSymretope)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   /* reset the statistics */
+   SCIP_CALL( SCIPresetClock(scip, conshdlrdata->hotstartclock) );
+   SCIP_CALL( SCIPresetClock(scip, conshdlrdata->standardclock) );
+   conshdlrdata->nhotstartcalls = 0;
+   conshdlrdata->nstandardcalls = 0;
+   conshdlrdata->npowers = 0;
+   conshdlrdata->npeekcalls = 0;
+   conshdlrdata->npeekfixings = 0;
+   conshdlrdata->npeekbudgetstops = 0;
+   conshdlrdata->nexecpropskips = 0;
+   conshdlrdata->neventswitches = 0;
+   conshdlrdata->nresprops = 0;
+   conshdlrdata->nresproplength = 0;
+   conshdlrdata->nsepacalls = 0;
+   conshdlrdata->nsepacuts = 0;
+
+   return SCIP_OKAY;
+}
+
+
+/** deinitialization method of constraint handler (called before transformed problem is freed) */
+static
+SCIP_DECL_CONSEXIT(consExitSymretope)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert( scip != NULL );
+   assert( conshdlr != NULL );
+   assert( strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0 );
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   /* The cached outcomes belong to the constraints of the transformed problem. Its statistics are reported in
+    * the statistics table. */
+   if ( conshdlrdata->propcache != NULL )
+   {
+      SCIP_CALL( freePropCache(scip, &conshdlrdata->propcache) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** transforms constraint data into data belonging to the transformed problem */
 static
 SCIP_DECL_CONSTRANS(consTransSymretope)
@@ -3869,9 +5652,17 @@ SCIP_DECL_CONSTRANS(consTransSymretope)
    /* create transformed constraint data */
    nvars = sourcedata->nvars;
 
-   /* Create consdata */
-   SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, sourcedata->vars, nvars,
-      sourcedata->permutation->perm, sourcedata->ismodelcons) );
+   /* Create consdata, sharing the permutation object if it is owned by this SCIP instance, see
+    * SCIPcapturePermutation(); this is not the case for the original problem of a concurrent solver. */
+   if ( nvars == 0 )
+   {
+      SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, NULL, 0, NULL, NULL, sourcedata->ismodelcons) );
+   }
+   else
+   {
+      SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, sourcedata->vars, nvars, sourcedata->permutation->perm,
+            sourcedata->permutation->scip == scip ? sourcedata->permutation : NULL, sourcedata->ismodelcons) );
+   }
 
    /* create transformed constraint */
    SCIP_CALL( SCIPcreateCons(scip, targetcons, SCIPconsGetName(sourcecons), conshdlr, consdata,
@@ -3915,11 +5706,91 @@ SCIP_DECL_CONSINITLP(consInitlpSymretope)
 }
 
 
+/** Partition the constraints into groups, such that constraints of different groups share no variables
+ *
+ *  The identifier of a group is the smallest index of its constraints in @p conss. The groups are computed in INITSOL,
+ *  and again in CONSPROP for all constraints of the handler as soon as a constraint that is not grouped yet (one that
+ *  is added later) is propagated.
+ */
+static
+SCIP_RETCODE computeConsGroups(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< symretope constraints */
+   int                   nconss              /**< number of constraints */
+)
+{
+   SCIP_DISJOINTSET* consgroups;
+   int* consofvar;
+   int* groupofrep;
+   int nprobvars;
+   int c;
+   int i;
+
+   assert( scip != NULL );
+   assert( conss != NULL || nconss == 0 );
+
+   if ( nconss == 0 )
+      return SCIP_OKAY;
+
+   nprobvars = SCIPgetNVars(scip);
+   SCIP_CALL( SCIPallocBufferArray(scip, &consofvar, nprobvars) );
+   for (i = 0; i < nprobvars; ++i)
+      consofvar[i] = -1;
+   SCIP_CALL( SCIPcreateDisjointset(scip, &consgroups, nconss) );
+
+   /* join the constraints that share an active variable */
+   for (c = 0; c < nconss; ++c)
+   {
+      SCIP_CONSDATA* consdata;
+
+      consdata = SCIPconsGetData(conss[c]);
+      assert( consdata != NULL );
+
+      for (i = 0; i < consdata->nvars; ++i)
+      {
+         int probindex;
+
+         probindex = SCIPvarGetProbindex(consdata->vars[i]);
+         if ( probindex < 0 )
+            continue;
+         assert( probindex < nprobvars );
+
+         if ( consofvar[probindex] < 0 )
+            consofvar[probindex] = c;
+         else
+            SCIPdisjointsetUnion(consgroups, consofvar[probindex], c, FALSE);
+      }
+   }
+
+   /* use the smallest constraint index of a group as its identifier */
+   SCIP_CALL( SCIPallocBufferArray(scip, &groupofrep, nconss) );
+   for (c = 0; c < nconss; ++c)
+      groupofrep[c] = -1;
+   for (c = 0; c < nconss; ++c)
+   {
+      int rep;
+
+      rep = SCIPdisjointsetFind(consgroups, c);
+      if ( groupofrep[rep] < 0 )
+         groupofrep[rep] = c;
+      SCIPconsGetData(conss[c])->groupid = groupofrep[rep];
+   }
+
+   SCIPfreeBufferArray(scip, &groupofrep);
+   SCIPfreeDisjointset(scip, &consgroups);
+   SCIPfreeBufferArray(scip, &consofvar);
+
+   return SCIP_OKAY;
+}
+
+
 /** solving process initialization method of constraint handler (called when branch and bound process is about to begin) */
 static
 SCIP_DECL_CONSINITSOL(consInitsolSymretope)
 {
    SCIP_CONSHDLRDATA* conshdlrdata;
+   int maxnperms;
+   int maxnnodes;
    int c;
 
    assert( scip != NULL );
@@ -3931,6 +5802,8 @@ SCIP_DECL_CONSINITSOL(consInitsolSymretope)
    assert( conshdlrdata != NULL );
 
    conshdlrdata->maxnvars = 0;
+   maxnperms = 0;
+   maxnnodes = 0;
 
    /* loop through constraints */
    for (c = 0; c < nconss; ++c)
@@ -3945,6 +5818,26 @@ SCIP_DECL_CONSINITSOL(consInitsolSymretope)
       /* update conshdlrdata if necessary */
       if ( consdata->nvars > conshdlrdata->maxnvars )
          conshdlrdata->maxnvars = consdata->nvars;
+      if ( getArenaNPerms(consdata) > maxnperms )
+         maxnperms = getArenaNPerms(consdata);
+      if ( 2 * consdata->nvars * getArenaNPerms(consdata) > maxnnodes )
+         maxnnodes = 2 * consdata->nvars * getArenaNPerms(consdata);
+   }
+
+   /* Size the propagation arena once for all constraints, such that propagation does not need to allocate memory.
+    * The number of permutations per constraint is bounded by maxgrouporder and maxgroupordernvars.
+    */
+   if ( conshdlrdata->maxnvars > 0 && maxnperms > 0 )
+   {
+      SCIP_SYMRETOPEARENA* arena;
+
+      SCIP_CALL( acquireArena(scip, conshdlrdata, conshdlrdata->maxnvars, maxnperms, maxnnodes, &arena) );
+      releaseArena(scip, &arena);
+   }
+
+   if ( conshdlrdata->groupprop )
+   {
+      SCIP_CALL( computeConsGroups(scip, conss, nconss) );
    }
 
    return SCIP_OKAY;
@@ -4363,9 +6256,16 @@ SCIP_DECL_CONSCHECK(consCheckSymretope)
 static
 SCIP_DECL_CONSPROP(consPropSymretope)
 {  /*lint --e{715}*/
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
+   SCIP_Bool groupreduced;
+   SCIP_Bool repeated;
+   SCIP_Bool ungrouped;
+   int* order = NULL;
+   int* groups = NULL;
+   int groupbegin;
+   int groupend;
    int c;
-   int i;
 
    SCIP_Bool success = FALSE;
 
@@ -4378,42 +6278,98 @@ SCIP_DECL_CONSPROP(consPropSymretope)
 
    SCIPdebugMsg(scip, "Propagation method of symretope constraint handler.\n");
 
-   /* loop through constraints */
-   for (c = 0; c < nconss; ++c)
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+
+   /* In group-wise propagation, visit the constraints group by group, in a deterministic order. */
+   if ( conshdlrdata->groupprop && nconss > 1 )
    {
-      SCIP_Bool infeasible = FALSE;
-      int ngen = 0;
+      /* Constraints added after INITSOL are not grouped yet, and may share variables with constraints of any group. */
+      ungrouped = FALSE;
+      for (c = 0; c < nconss && !ungrouped; ++c)
+         ungrouped = SCIPconsGetData(conss[c])->groupid < 0;
+      if ( ungrouped )
+      {
+         SCIP_CALL( computeConsGroups(scip, SCIPconshdlrGetConss(conshdlr), SCIPconshdlrGetNConss(conshdlr)) );
+      }
 
-      assert( conss[c] != NULL );
+      SCIP_CALL( SCIPallocBufferArray(scip, &order, nconss) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &groups, nconss) );
+      for (c = 0; c < nconss; ++c)
+      {
+         order[c] = c;
+         groups[c] = SCIPconsGetData(conss[c])->groupid;
+         assert( groups[c] >= 0 );
+      }
+      SCIPsortIntInt(groups, order, nconss);
+   }
 
-      consdata = SCIPconsGetData(conss[c]);
-      assert( consdata != NULL );
+   /* loop through the groups of constraints */
+   for (groupbegin = 0; groupbegin < nconss; groupbegin = groupend)
+   {
+      groupend = groupbegin + 1;
+      if ( groups != NULL )
+      {
+         while ( groupend < nconss && groups[groupend] == groups[groupbegin] )
+            ++groupend;
+      }
 
-      /* Only propagate if there is reason to. */
-      if ( !consdata->execprop )
-         continue;
+      /* Fixings of one constraint can wake up the other constraints of its group, but no constraints of other
+       * groups. So in group-wise propagation, we repeat until no constraint of the group has to be propagated. */
+      repeated = FALSE;
+      do
+      {
+         groupreduced = FALSE;
 
-      /* Clear the affected entries list */
-      for (i = 0; i < consdata->nvars; ++i)
-         consdata->affectedentries[i] = FALSE;
+         for (c = groupbegin; c < groupend; ++c)
+         {
+            SCIP_CONS* cons;
+            SCIP_Bool infeasible = FALSE;
+            int ngen = 0;
 
-      SCIP_CALL( propVariables(scip, conss[c], NULL, TRUE, consdata->affectedentries, &infeasible, &ngen) );
+            cons = conss[order != NULL ? order[c] : c];
+            assert( cons != NULL );
 
-      /* If this subtree is infeasible, cutoff. */
-      if ( infeasible )
-      {
-         *result = SCIP_CUTOFF;
-         return SCIP_OKAY;
-      }
+            consdata = SCIPconsGetData(cons);
+            assert( consdata != NULL );
 
-      /* If it's not infeasible, do not propagate again until an affected variable is changed. */
-      consdata->execprop = FALSE;
+            /* Only propagate if there is reason to. Repeated rounds of group-wise propagation do not count as skips. */
+            if ( !consdata->execprop )
+            {
+               if ( !repeated )
+                  ++conshdlrdata->nexecpropskips;
+               continue;
+            }
 
-      success = success || ( ngen > 0 );
+            SCIP_CALL( propConsLocal(scip, conshdlrdata, cons, &infeasible, &ngen) );
 
-      *result = SCIP_DIDNOTFIND;
+            /* If this subtree is infeasible, cutoff. */
+            if ( infeasible )
+            {
+               *result = SCIP_CUTOFF;
+               goto Cleanup;
+            }
+
+            /* If it's not infeasible, do not propagate again until an affected variable is changed. */
+            consdata->execprop = FALSE;
+
+            success = success || ( ngen > 0 );
+            groupreduced = groupreduced || ( ngen > 0 );
+
+            *result = SCIP_DIDNOTFIND;
+         }
+         repeated = TRUE;
+      }
+      while ( groups != NULL && groupreduced );
    }
 
+ Cleanup:
+   SCIPfreeBufferArrayNull(scip, &groups);
+   SCIPfreeBufferArrayNull(scip, &order);
+
+   if ( *result == SCIP_CUTOFF )
+      return SCIP_OKAY;
+
    if ( success )
    {
       *result = SCIP_REDUCEDDOM;
@@ -4462,7 +6418,9 @@ SCIP_DECL_CONSPRESOL(consPresolSymretope)
       }
       else
       {
-         SCIP_CALL( propVariables(scip, conss[c], NULL, TRUE, NULL, &infeasible, &ngen) );
+         if ( consdata->fixed0bits != NULL )
+            syncFixingSnapshot(consdata);
+         SCIP_CALL( propVariables(scip, conss[c], NULL, TRUE, NULL, FALSE, &infeasible, &ngen) );
       }
 
       if ( infeasible )
@@ -4492,6 +6450,8 @@ static
 SCIP_DECL_CONSRESPROP(consRespropSymretope)
 {  /*lint --e{715}*/
    int nvars;
+   int nconflictvars = 0;
+   SCIP_CONSHDLRDATA* conshdlrdata;
    SCIP_CONSDATA* consdata;
    SCIP_VAR** vars;
    SCIP_PERMUTATION* permutation;
@@ -4508,6 +6468,10 @@ SCIP_DECL_CONSRESPROP(consRespropSymretope)
 
    *result = SCIP_DIDNOTFIND;
 
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert( conshdlrdata != NULL );
+   ++conshdlrdata->nresprops;
+
    /* Get instance data */
    consdata = SCIPconsGetData(cons);
    assert( consdata != NULL );
@@ -4571,7 +6535,7 @@ SCIP_DECL_CONSRESPROP(consRespropSymretope)
       /* Run the propagation algorithm with the converse fixing applied. This will definitively yield infeasible.
        * In this, do not use global bound information, only the fixings specified in virtualfixings.
        */
-      SCIP_CALL( propVariables(scip, cons, virtualfixings, FALSE, conflictentries, &infeasible, &ngen) );
+      SCIP_CALL( propVariables(scip, cons, virtualfixings, FALSE, conflictentries, FALSE, &infeasible, &ngen) );
       assert( infeasible );
 
       /* Now the conflict consists of checkedentries for sure.
@@ -4607,7 +6571,7 @@ SCIP_DECL_CONSRESPROP(consRespropSymretope)
             }
 
             /* Run propagator virtually to determine if it is feasible or not. */
-            SCIP_CALL( propVariables(scip, cons, virtualfixings, FALSE, NULL, &infeasible, &ngen) );
+            SCIP_CALL( propVariables(scip, cons, virtualfixings, FALSE, NULL, FALSE, &infeasible, &ngen) );
 
             /* If entry i is not necessary for certifying infeasibility, remove from conflict. */
             if ( infeasible )
@@ -4628,13 +6592,16 @@ SCIP_DECL_CONSRESPROP(consRespropSymretope)
             if ( SCIPvarGetUbAtIndex(vars[j], bdchgidx, FALSE) < 0.5 )
             {
                SCIP_CALL( SCIPaddConflictUb(scip, vars[j], bdchgidx) );
+               ++nconflictvars;
             }
             else if ( SCIPvarGetLbAtIndex(vars[j], bdchgidx, FALSE) > 0.5 )
             {
                SCIP_CALL( SCIPaddConflictLb(scip, vars[j], bdchgidx) );
+               ++nconflictvars;
             }
          }
       }
+      conshdlrdata->nresproplength += nconflictvars;
 
       SCIPfreeBufferArray(scip, &conflictentries);
       freeVirtualFixings(scip, &virtualfixingsinitial);
@@ -4648,7 +6615,9 @@ SCIP_DECL_CONSRESPROP(consRespropSymretope)
       /* If inferinfo >= 0, then this is found without peeking. Inferinfo encodes the permutation at which it fails. */
       /* Get the power of the permutation for which this fixing is found. This is stored in "inferinfo" */
       /* Now list the conflict that makes sure that the bound "boundtype" must be tightened for variable "infervar" */
-      SCIP_CALL( resolveSymretopeConflictVariables(scip, infervar, boundtype, vars, nvars, permutation, inferinfo, bdchgidx) );
+      SCIP_CALL( resolveSymretopeConflictVariables(scip, infervar, boundtype, vars, nvars, permutation, inferinfo,
+            bdchgidx, &nconflictvars) );
+      conshdlrdata->nresproplength += nconflictvars;
 
       *result = SCIP_SUCCESS;
       return SCIP_OKAY;
@@ -4757,7 +6726,10 @@ static
 SCIP_DECL_CONSCOPY(consCopySymrestope)
 {
    SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSHDLR* conshdlr;
    SCIP_CONSDATA* sourcedata;
+   SCIP_CONSDATA* consdata;
+   SCIP_PERMUTATION* sharedpermutation;
    SCIP_VAR** sourcevars;
    SCIP_VAR** vars;
    int nvars;
@@ -4812,9 +6784,21 @@ SCIP_DECL_CONSCOPY(consCopySymrestope)
       if ( name == NULL )
          name = SCIPconsGetName(sourcecons);
 
-      SCIP_CALL( SCIPcreateConsSymretope(scip, cons, name, sourcedata->permutation->perm, vars, nvars,
-            sourcedata->ismodelcons, initial, separate, enforce, check, propagate, local,
-            modifiable, dynamic, removable, stickingatnode) );
+      conshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
+      if ( conshdlr == NULL )
+      {
+         SCIPerrorMessage("Symretope constraint handler not found.\n");
+         return SCIP_PLUGINNOTFOUND;
+      }
+
+      /* Only the variable mapping differs between the copies, so the permutation object is shared. Objects that the
+       * source SCIP itself shares with another instance are not passed on, see SCIPcapturePermutation(). */
+      sharedpermutation = sourcedata->permutation->scip == sourcescip ? sourcedata->permutation : NULL;
+
+      SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, vars, nvars, sourcedata->permutation->perm,
+            sharedpermutation, sourcedata->ismodelcons) );
+      SCIP_CALL( SCIPcreateCons(scip, cons, name, conshdlr, consdata, initial, separate, enforce, check, propagate,
+            local, modifiable, dynamic, removable, stickingatnode) );
    }
 
    SCIPfreeBufferArray(scip, &vars);
@@ -4828,15 +6812,9 @@ static
 SCIP_DECL_CONSPARSE(consParseSymretope)
 {  /*lint --e{715}*/
    const char* s;
-   char* endptr;
    SCIP_VAR** vars;
-   SCIP_VAR* var;
    int* perm;
-   int val;
-   int nvars = 0;
-   int cnt = 0;
-   int nfoundpermidx = 0;
-   int maxnvars = 128;
+   int nvars;
 
    assert( success != NULL );
 
@@ -4855,120 +6833,13 @@ SCIP_DECL_CONSPARSE(consParseSymretope)
    }
    s += 10;
 
-   /* loop through string */
-   SCIP_CALL( SCIPallocBufferArray(scip, &vars, maxnvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &perm, maxnvars) );
-
-   do
-   {
-      if ( cnt > 1 )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected two arrays, but got more\n");
-         *success = FALSE;
-
-         SCIPfreeBufferArray(scip, &perm);
-         SCIPfreeBufferArray(scip, &vars);
-      }
-
-      /* skip whitespace and ',' */
-      while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-         ++s;
-
-      /* if we could not find starting indicator of array */
-      if ( *s != '[' )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected '[' to start new array\n");
-         *success = FALSE;
-
-         SCIPfreeBufferArray(scip, &perm);
-         SCIPfreeBufferArray(scip, &vars);
-      }
-      ++s;
-
-      /* read array, cnt = 0: variables; cnt = 1: permutation*/
-      if ( cnt == 0 )
-      {
-         do
-         {
-            /* skip whitespace and ',' */
-            while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-               ++s;
-
-            /* parse variable name */
-            SCIP_CALL( SCIPparseVarName(scip, s, &var, &endptr) );
-            if ( var == NULL )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unknown variable name at '%s'\n", str);
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-            s = endptr;
-            assert( s != NULL );
-
-            vars[nvars++] = var;
-
-            if ( nvars >= maxnvars )
-            {
-               int newsize;
-
-               newsize = SCIPcalcMemGrowSize(scip, nvars + 1);
-               SCIP_CALL( SCIPreallocBufferArray(scip, &vars, newsize) );
-               SCIP_CALL( SCIPreallocBufferArray(scip, &perm, newsize) );
-               maxnvars = newsize;
-            }
-         }
-         while ( *s != ']' );
-      }
-      else
-      {
-         do
-         {
-            /* skip whitespace and ',' */
-            while ( *s != '\0' && ( isspace((unsigned char)*s) ||  *s == ',' ) )
-               ++s;
-
-            /* parse integer value */
-            if ( ! SCIPstrToIntValue(s, &val, &endptr) )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "could not extract int from string '%s'\n", str);
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &perm);
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-            s = endptr;
-            assert( s != NULL );
-
-            perm[nfoundpermidx++] = val;
-
-            if ( nfoundpermidx > nvars )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "permutation is longer than vars array\n");
-               *success = FALSE;
-               SCIPfreeBufferArray(scip, &perm);
-               SCIPfreeBufferArray(scip, &vars);
-               return SCIP_OKAY;
-            }
-         }
-         while ( *s != ']' );
-      }
-      ++s;
-      ++cnt;
-   }
-   while ( *s != ')' );
+   /* read variables and permutation in one pass, the permutation is checked to be a bijection */
+   SCIP_CALL( SCIPparsePermutationArrays(scip, s, &vars, &perm, &nvars, success) );
+   if ( ! *success )
+      return SCIP_OKAY;
 
-   if ( nfoundpermidx == nvars )
-   {
       /* Do NOT add symretope as a model constraint. */
-      SCIP_CALL( SCIPcreateConsBasicSymretope(scip, cons, name, perm, vars, nvars, FALSE) );
-   }
-   else
-   {
-      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL,
-         "Length of permutation is not equal to number of given variables.\n");
-      *success = FALSE;
-   }
+   SCIP_CALL( SCIPcreateConsBasicSymretope(scip, cons, name, perm, vars, nvars, FALSE) );
 
    SCIPfreeBufferArray(scip, &perm);
    SCIPfreeBufferArray(scip, &vars);
@@ -4985,10 +6856,6 @@ static
 SCIP_DECL_CONSPRINT(consPrintSymretope)
 {  /*lint --e{715}*/
    SCIP_CONSDATA* consdata;
-   SCIP_VAR** vars;
-   int* perm;
-   int nvars;
-   int i;
 
    assert( scip != NULL );
    assert( conshdlr != NULL );
@@ -5008,22 +6875,9 @@ SCIP_DECL_CONSPRINT(consPrintSymretope)
    assert( consdata->permutation != NULL );
    assert( consdata->permutation->perm != NULL );
 
-   vars = consdata->vars;
-   nvars = consdata->nvars;
-   perm = consdata->permutation->perm;
-
-   SCIPinfoMessage(scip, file, "symretope([");
-   SCIP_CALL( SCIPwriteVarName(scip, file, vars[0], TRUE) );
-
-   for (i = 1; i < nvars; ++i)
-   {
-      SCIPinfoMessage(scip, file, ",");
-      SCIP_CALL( SCIPwriteVarName(scip, file, vars[i], TRUE) );
-   }
-   SCIPinfoMessage(scip, file, "],[%d", perm[0]);
-   for (i = 1; i < nvars; ++i)
-      SCIPinfoMessage(scip, file, ",%d", perm[i]);
-   SCIPinfoMessage(scip, file, "])");
+   SCIPinfoMessage(scip, file, "symretope(");
+   SCIP_CALL( SCIPwritePermutationArrays(scip, file, consdata->vars, consdata->permutation->perm, consdata->nvars) );
+   SCIPinfoMessage(scip, file, ")");
 
    return SCIP_OKAY;
 }
@@ -5084,6 +6938,7 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
    )
 {
    SCIP_CONSHDLRDATA* conshdlrdata = NULL;
+   SCIP_TABLEDATA* tabledata;
    SCIP_CONSHDLR* conshdlr;
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &conshdlrdata) );
@@ -5095,6 +6950,32 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
          conshdlrdata) );
    assert( conshdlr != NULL );
 
+   conshdlrdata->arena = NULL;
+   conshdlrdata->propcache = NULL;
+   conshdlrdata->nconsids = 0;
+   conshdlrdata->memused = 0.0;
+   conshdlrdata->arenareserved = 0.0;
+   BMSclearMemoryArray(conshdlrdata->powbenefit, NPOWBENEFITBUCKETS);
+   conshdlrdata->npowbenefit = 0;
+   conshdlrdata->nbudgetlimited = 0;
+   conshdlrdata->nbudgetdegraded = 0;
+
+   /* statistics; they are reset in CONSINIT */
+   SCIP_CALL( SCIPcreateClock(scip, &conshdlrdata->hotstartclock) );
+   SCIP_CALL( SCIPcreateClock(scip, &conshdlrdata->standardclock) );
+   conshdlrdata->nhotstartcalls = 0;
+   conshdlrdata->nstandardcalls = 0;
+   conshdlrdata->npowers = 0;
+   conshdlrdata->npeekcalls = 0;
+   conshdlrdata->npeekfixings = 0;
+   conshdlrdata->npeekbudgetstops = 0;
+   conshdlrdata->nexecpropskips = 0;
+   conshdlrdata->neventswitches = 0;
+   conshdlrdata->nresprops = 0;
+   conshdlrdata->nresproplength = 0;
+   conshdlrdata->nsepacalls = 0;
+   conshdlrdata->nsepacuts = 0;
+
    /* include event handler */
    conshdlrdata->eventhdlr = NULL;
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &conshdlrdata->eventhdlr,
@@ -5105,6 +6986,8 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
    SCIP_CALL( SCIPsetConshdlrCopy(scip, conshdlr, conshdlrCopySymretope, consCopySymrestope) );
    SCIP_CALL( SCIPsetConshdlrEnforelax(scip, conshdlr, consEnforelaxSymretope) );
    SCIP_CALL( SCIPsetConshdlrFree(scip, conshdlr, consFreeSymretope) );
+   SCIP_CALL( SCIPsetConshdlrInit(scip, conshdlr, consInitSymretope) );
+   SCIP_CALL( SCIPsetConshdlrExit(scip, conshdlr, consExitSymretope) );
    SCIP_CALL( SCIPsetConshdlrDelete(scip, conshdlr, consDeleteSymretope) );
    SCIP_CALL( SCIPsetConshdlrGetVars(scip, conshdlr, consGetVarsSymretope) );
    SCIP_CALL( SCIPsetConshdlrGetNVars(scip, conshdlr, consGetNVarsSymretope) );
@@ -5118,6 +7001,13 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
    SCIP_CALL( SCIPsetConshdlrInitlp(scip, conshdlr, consInitlpSymretope) );
    SCIP_CALL( SCIPsetConshdlrInitsol(scip, conshdlr, consInitsolSymretope) );
 
+   /* include table */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &tabledata) );
+   tabledata->conshdlrdata = conshdlrdata;
+   SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_SYMRETOPE, TABLE_DESC_SYMRETOPE, TRUE,
+         NULL, tableFreeSymretope, NULL, NULL, NULL, NULL, tableOutputSymretope,
+         tabledata, TABLE_POSITION_SYMRETOPE, TABLE_EARLIEST_SYMRETOPE) );
+
    SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/forceconscopy",
          "Whether symresack constraints should be forced to be copied to sub SCIPs.",
          &conshdlrdata->forceconscopy, TRUE, DEFAULT_FORCECONSCOPY, NULL, NULL) );
@@ -5131,7 +7021,7 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
          &conshdlrdata->maxorder, TRUE, DEFAULT_SYMRETOPEMAXORDER, 0, INT_MAX, NULL, NULL) );
 
    SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/maxgroupordernvars",
-         "Maximal value of group order multiplied with group support  before restricting number of permutations.",
+         "Maximal value of group order multiplied with group support  before restricting number of permutations (only used without memory budget).",
          &conshdlrdata->maxordernvars, TRUE, DEFAULT_SYMRETOPEMAXORDERNVARS, 0, INT_MAX, NULL, NULL) );
 
    SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/sepaallviolperms",
@@ -5142,6 +7032,34 @@ SCIP_RETCODE SCIPincludeConshdlrSymretope(
          "Whether peeking should be done during probing.",
          &conshdlrdata->probingpeek, TRUE, DEFAULT_PROBINGPEEK, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/powtablememlimit",
+         "Maximal memory (in MB) for tabulating the permutation powers of a symretope constraint (0: never tabulate).",
+         &conshdlrdata->powtablememlimit, TRUE, DEFAULT_POWTABLEMEMLIMIT, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/incrementalprop",
+         "Whether propagation without peeking only re-evaluates the powers affected by bound changes since the last call.",
+         &conshdlrdata->incrementalprop, TRUE, DEFAULT_INCREMENTALPROP, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/propcachememlimit",
+         "Maximal memory (in MB) of the cache of propagation outcomes per local state (0: no caching).",
+         &conshdlrdata->propcachememlimit, TRUE, DEFAULT_PROPCACHEMEMLIMIT, 0, INT_MAX / 2048, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/groupprop",
+         "Whether constraints sharing variables are propagated group-wise until a fixpoint within the group is reached.",
+         &conshdlrdata->groupprop, TRUE, DEFAULT_GROUPPROP, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/peekbudget",
+         "Maximal number of tentative fixings tested by peeking per propagation call, in the order of their past payoff (-1: no limit)",
+         &conshdlrdata->peekbudget, TRUE, DEFAULT_PEEKBUDGET, -1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/memorybudget",
+         "Memory budget (in MB) of all symretope constraints, which replaces maxgroupordernvars (-1: a tenth of limits/memory, 0: no budget)",
+         &conshdlrdata->memorybudget, TRUE, DEFAULT_MEMORYBUDGET, -1, INT_MAX / 2048, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/dynamicevents",
+         "Whether local bound change events are only caught for the entries on which the last propagation depended.",
+         &conshdlrdata->dynamicevents, TRUE, DEFAULT_DYNAMICEVENTS, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
@@ -5205,7 +7123,7 @@ SCIP_RETCODE SCIPcreateConsSymretope(
    }
 
    /* create constraint data */
-   SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, vars, nvars, perm, ismodelcons) );
+   SCIP_CALL( consdataCreate(scip, conshdlr, &consdata, vars, nvars, perm, NULL, ismodelcons) );
 
    /* create constraint */
    SCIP_CALL( SCIPcreateCons(scip, cons, name, conshdlr, consdata, initial, separate, enforce, check, propagate,
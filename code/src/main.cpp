@@ -1,6 +1,16 @@
 /**@file   main.cpp
  * @brief  main file for symretope propagation code
  * @author Jasper van Doornmalen, Christopher Hojny
+ *
+ * Besides solving a single instance, the driver has a batch mode "-b <job file> [-j <threads>]". Each nonempty line
+ * of the job file that does not start with '#' describes one job by the usual command line arguments, e.g.,
+ *
+ *    instance.mps.gz -s settings.set -p 3 -t 3600 -sbcs instance.symcache
+ *
+ * The jobs are run by the given number of worker threads, each one with its own SCIP instance whose plugins are
+ * included only once and whose parameters are reset between jobs. Instead of the statistics, one JSON object per job
+ * is printed to standard output. Running more than one thread requires SCIP to be built thread-safe, and a
+ * thread-safe symmetry computation (bliss or none); with nauty, the jobs are run on a single thread.
  */
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
@@ -11,117 +21,176 @@
 #include <scip/scipdefplugins.h>
 #include "readArguments.h"
 #include "cons_symretope.h"
+#include <scip/../symmetry/compute_symmetry.h>
 
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+/** arguments of a run */
+struct SbcsArgs
+{
+   const char*           filename;           /**< problem file */
+   const char*           settingsname;       /**< settings file, or NULL */
+   const char*           symcachefile;       /**< symmetry cache file, or NULL */
+   const char*           solutionfile;       /**< solution file to read, or NULL */
+   const char*           writesolfilename;   /**< solution file to write, or NULL */
+   SCIP_Real             timeLimit;          /**< time limit */
+   SCIP_Real             memLimit;           /**< memory limit */
+   SCIP_Longint          nodeLimit;          /**< node limit */
+   SCIP_Bool             onlypre;            /**< only run preprocessing? */
+   SCIP_Real             cutoffvalue;        /**< value of cutoff (SCIP_INVALID otherwise) */
+   int                   dispFreq;           /**< display frequency */
+   int                   permseed;           /**< seed for permutations */
+   int                   randseed;           /**< seed for randomization */
+};
+typedef struct SbcsArgs SBCS_ARGS;
+
+/** job of the batch mode */
+struct SbcsJob
+{
+   int                   lineno;             /**< line of the job in the job file */
+   std::vector<std::string> tokens;          /**< arguments of the job, the first one being the program name */
+   std::vector<char*>    argv;               /**< pointers to the arguments, valid once all jobs are read */
+   SBCS_ARGS             args;               /**< parsed arguments */
+};
+typedef struct SbcsJob SBCS_JOB;
+
+/** data shared by the worker threads of the batch mode */
+struct SbcsBatch
+{
+   std::vector<SBCS_JOB> jobs;               /**< jobs */
+   std::atomic<int>      nextjob;            /**< index of the next job to run */
+   std::mutex            outputmutex;        /**< mutex protecting the output of the results */
+   int                   nfailed;            /**< number of jobs that failed, protected by outputmutex */
+};
+typedef struct SbcsBatch SBCS_BATCH;
 
-/** run scip with commandline arguments */
+
+/** parse the arguments of a run; the batch mode options are only parsed if jobfile is not NULL */
 static
-SCIP_RETCODE runSCIP(
-   int                   argc,
-   char**                argv
+SCIP_RETCODE parseArguments(
+   int                   argc,               /**< number of arguments */
+   char**                argv,               /**< arguments */
+   SBCS_ARGS*            args,               /**< pointer to store the parsed arguments */
+   const char**          jobfile,            /**< pointer to store the job file, or NULL */
+   int*                  nthreads            /**< pointer to store the number of threads, or NULL */
    )
 {
-   SCIP* scip = 0;
-   const char* filename;
-   const char* settingsname;
-   const char* solutionfile;
-   const char* writesolfilename;
-   SCIP_Real timeLimit;
-   SCIP_Real memLimit;
-   SCIP_Longint nodeLimit;
-   SCIP_Bool onlypre = FALSE;
-   SCIP_RETCODE retcode;
-   SCIP_Real cutoffvalue = SCIP_INVALID;
-   int dispFreq;
-   int permseed;
-   int randseed;
+   assert( args != NULL );
 
-   /* parse command line arguments */
-   retcode = readArguments(argc, argv, &filename, &solutionfile, &writesolfilename, &settingsname,
-      &timeLimit, &memLimit, &nodeLimit, &dispFreq, &onlypre, &permseed, &randseed, &cutoffvalue);
-   if ( retcode != SCIP_OKAY )
-      exit(1);
-   assert( filename != 0 );
+   SCIP_CALL( readArguments(argc, argv, &args->filename, &args->solutionfile, &args->writesolfilename,
+         &args->settingsname, &args->symcachefile, &args->timeLimit, &args->memLimit, &args->nodeLimit,
+         &args->dispFreq, &args->onlypre, &args->permseed, &args->randseed, &args->cutoffvalue, jobfile, nthreads) );
 
-   /* initialize SCIP */
-   SCIP_CALL( SCIPcreate(&scip) );
+   return SCIP_OKAY;
+}
 
-   SCIPprintVersion(scip, 0);
 
-   SCIPinfoMessage(scip, 0, "\n");
-   SCIPinfoMessage(scip, 0, "Symretope propagation methods - (c) Jasper van Doornmalen, Christopher Hojny.\n");
-   SCIPinfoMessage(scip, 0, "[GitHash: %s]\n", SYMGITHASH);
-   SCIPinfoMessage(scip, 0, "\n");
+/** create a SCIP instance and include the plugins */
+static
+SCIP_RETCODE createSCIP(
+   SCIP**                scip                /**< pointer to store the SCIP instance */
+   )
+{
+   SCIP_CALL( SCIPcreate(scip) );
 
    /* include default SCIP plugins */
-   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
-   SCIP_CALL( SCIPincludeConshdlrSymretope(scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(*scip) );
+   SCIP_CALL( SCIPincludeConshdlrSymretope(*scip) );
+
+   return SCIP_OKAY;
+}
 
 
+/** set the parameters of a run */
+static
+SCIP_RETCODE setParameters(
+   SCIP*                 scip,               /**< SCIP instance */
+   const SBCS_ARGS*      args                /**< arguments of the run */
+   )
+{
    /* --------------------------------------------------------------------- */
    /* handle permutations */
-   if ( permseed >= 0 )
+   if ( args->permseed >= 0 )
    {
-      SCIP_CALL( SCIPsetIntParam(scip, "randomization/permutationseed", permseed) );
+      SCIP_CALL( SCIPsetIntParam(scip, "randomization/permutationseed", args->permseed) );
    }
 
-   if ( randseed >= 0 )
+   if ( args->randseed >= 0 )
    {
-      SCIP_CALL( SCIPsetIntParam(scip, "randomization/randomseedshift", randseed) );
+      SCIP_CALL( SCIPsetIntParam(scip, "randomization/randomseedshift", args->randseed) );
    }
 
    /* --------------------------------------------------------------------- */
 
    /* set time, node, and memory limit */
-   if ( ! SCIPisInfinity(scip, timeLimit) )
-      SCIP_CALL( SCIPsetRealParam(scip, "limits/time", timeLimit) );
-   if ( ! SCIPisInfinity(scip, memLimit) )
-      SCIP_CALL( SCIPsetRealParam(scip, "limits/memory", memLimit) );
-   if ( nodeLimit < SCIP_LONGINT_MAX )
-      SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", nodeLimit) );
-   if ( dispFreq >= 0 )
-      SCIP_CALL( SCIPsetIntParam(scip, "display/freq", dispFreq) );
+   if ( ! SCIPisInfinity(scip, args->timeLimit) )
+      SCIP_CALL( SCIPsetRealParam(scip, "limits/time", args->timeLimit) );
+   if ( ! SCIPisInfinity(scip, args->memLimit) )
+      SCIP_CALL( SCIPsetRealParam(scip, "limits/memory", args->memLimit) );
+   if ( args->nodeLimit < SCIP_LONGINT_MAX )
+      SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", args->nodeLimit) );
+   if ( args->dispFreq >= 0 )
+      SCIP_CALL( SCIPsetIntParam(scip, "display/freq", args->dispFreq) );
 
    /* check for parameters */
-   if ( settingsname != 0 )
+   if ( args->settingsname != 0 )
    {
-      if ( SCIPfileExists(settingsname) )
+      if ( SCIPfileExists(args->settingsname) )
       {
-         SCIPinfoMessage(scip, 0, "reading parameter file <%s> ...\n\n", settingsname);
-         SCIP_CALL( SCIPreadParams(scip, settingsname) );
+         SCIPinfoMessage(scip, 0, "reading parameter file <%s> ...\n\n", args->settingsname);
+         SCIP_CALL( SCIPreadParams(scip, args->settingsname) );
       }
       else
       {
-         SCIPerrorMessage("parameter file <%s> not found - using default parameters.\n", settingsname);
+         SCIPerrorMessage("parameter file <%s> not found - using default parameters.\n", args->settingsname);
       }
    }
 
-   /* output changed parameters */
-   SCIPinfoMessage(scip, 0, "Changed settings:\n");
-   SCIP_CALL( SCIPwriteParams(scip, 0, FALSE, TRUE) );
-   SCIPinfoMessage(scip, 0, "\n");
+   /* possibly cache symmetries across runs */
+   if ( args->symcachefile != 0 )
+   {
+      SCIP_CALL( SCIPsetStringParam(scip, "propagating/symmetry/cachefile", args->symcachefile) );
+   }
+
+   return SCIP_OKAY;
+}
+
 
+/** read the problem of a run and solve or presolve it */
+static
+SCIP_RETCODE solveProblem(
+   SCIP*                 scip,               /**< SCIP instance */
+   const SBCS_ARGS*      args                /**< arguments of the run */
+   )
+{
    /* solve problem */
-   if ( ! onlypre )
+   if ( ! args->onlypre )
       SCIPinfoMessage(scip, 0, "\nsolving problem ...\n\n");
    else
       SCIPinfoMessage(scip, 0, "\nrunning preprocessing ...\n\n");
 
    /* read problem */
-   SCIP_CALL( SCIPreadProb(scip, filename, 0) );
+   SCIP_CALL( SCIPreadProb(scip, args->filename, 0) );
 
    /* possibly read solution */
-   if ( solutionfile != 0 )
+   if ( args->solutionfile != 0 )
    {
-      SCIP_CALL( SCIPreadSol(scip, solutionfile) );
+      SCIP_CALL( SCIPreadSol(scip, args->solutionfile) );
    }
 
    /* handle cutoff */
-   if ( cutoffvalue != SCIP_INVALID )
+   if ( args->cutoffvalue != SCIP_INVALID )
    {
-      SCIPinfoMessage(scip, 0, "\nSetting cutoff value to %g.\n\n", cutoffvalue);
-      SCIP_CALL( SCIPsetObjlimit(scip, cutoffvalue) );
+      SCIPinfoMessage(scip, 0, "\nSetting cutoff value to %g.\n\n", args->cutoffvalue);
+      SCIP_CALL( SCIPsetObjlimit(scip, args->cutoffvalue) );
       SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
    }
 
@@ -130,7 +199,7 @@ SCIP_RETCODE runSCIP(
    SCIP_CALL( SCIPsetIntParam(scip, "constraints/orbisack/sepafreq", -1));
    SCIP_CALL( SCIPsetIntParam(scip, "constraints/orbitope/sepafreq", -1));
 
-   if ( onlypre )
+   if ( args->onlypre )
    {
       SCIP_CALL( SCIPpresolve(scip) );
    }
@@ -139,22 +208,25 @@ SCIP_RETCODE runSCIP(
       SCIP_CALL( SCIPsolve(scip) );
    }
 
-   SCIP_CALL( SCIPprintStatistics(scip, 0) );
-#if 0
-   if ( SCIPgetBestSol(scip) != 0 )
-   {
-      SCIP_CALL( SCIPprintSol(scip, SCIPgetBestSol(scip), 0, FALSE) );
-   }
-#endif
+   return SCIP_OKAY;
+}
+
 
-   if ( writesolfilename != NULL )
+/** write the solution information of a run, if requested */
+static
+SCIP_RETCODE writeSolution(
+   SCIP*                 scip,               /**< SCIP instance */
+   const SBCS_ARGS*      args                /**< arguments of the run */
+   )
+{
+   if ( args->writesolfilename != NULL )
    {
       FILE* file;
 
-      file = fopen(writesolfilename, "w");
+      file = fopen(args->writesolfilename, "w");
       if( file == NULL )
       {
-         SCIPwarningMessage(scip, "error creating file <%s>\n", writesolfilename);
+         SCIPwarningMessage(scip, "error creating file <%s>\n", args->writesolfilename);
       }
       else
       {
@@ -168,11 +240,54 @@ SCIP_RETCODE runSCIP(
          SCIPinfoMessage(scip, file, "\n");
          SCIP_CALL_FINALLY( SCIPprintBestSol(scip, file, printzeros), fclose(file) );
 
-         SCIPinfoMessage(scip, NULL, "written solution information to file <%s>\n", writesolfilename);
+         SCIPinfoMessage(scip, NULL, "written solution information to file <%s>\n", args->writesolfilename);
          fclose(file);
       }
    }
 
+   return SCIP_OKAY;
+}
+
+
+/** run scip with commandline arguments */
+static
+SCIP_RETCODE runSCIP(
+   const SBCS_ARGS*      args                /**< arguments of the run */
+   )
+{
+   SCIP* scip = 0;
+
+   assert( args->filename != 0 );
+
+   /* initialize SCIP */
+   SCIP_CALL( createSCIP(&scip) );
+
+   SCIPprintVersion(scip, 0);
+
+   SCIPinfoMessage(scip, 0, "\n");
+   SCIPinfoMessage(scip, 0, "Symretope propagation methods - (c) Jasper van Doornmalen, Christopher Hojny.\n");
+   SCIPinfoMessage(scip, 0, "[GitHash: %s]\n", SYMGITHASH);
+   SCIPinfoMessage(scip, 0, "\n");
+
+   SCIP_CALL( setParameters(scip, args) );
+
+   /* output changed parameters */
+   SCIPinfoMessage(scip, 0, "Changed settings:\n");
+   SCIP_CALL( SCIPwriteParams(scip, 0, FALSE, TRUE) );
+   SCIPinfoMessage(scip, 0, "\n");
+
+   SCIP_CALL( solveProblem(scip, args) );
+
+   SCIP_CALL( SCIPprintStatistics(scip, 0) );
+#if 0
+   if ( SCIPgetBestSol(scip) != 0 )
+   {
+      SCIP_CALL( SCIPprintSol(scip, SCIPgetBestSol(scip), 0, FALSE) );
+   }
+#endif
+
+   SCIP_CALL( writeSolution(scip, args) );
+
    SCIP_CALL( SCIPfreeProb(scip) );
 
    // SCIPprintMemoryDiagnostic(scip);
@@ -186,6 +301,307 @@ SCIP_RETCODE runSCIP(
 }
 
 
+/*
+ * Batch mode
+ */
+
+/** get a name of a solving status for the results of the batch mode */
+static
+const char* getStatusName(
+   SCIP_STATUS           status              /**< solving status */
+   )
+{
+   switch ( status )
+   {
+   case SCIP_STATUS_USERINTERRUPT:
+      return "userinterrupt";
+   case SCIP_STATUS_NODELIMIT:
+      return "nodelimit";
+   case SCIP_STATUS_TOTALNODELIMIT:
+      return "totalnodelimit";
+   case SCIP_STATUS_STALLNODELIMIT:
+      return "stallnodelimit";
+   case SCIP_STATUS_TIMELIMIT:
+      return "timelimit";
+   case SCIP_STATUS_MEMLIMIT:
+      return "memlimit";
+   case SCIP_STATUS_GAPLIMIT:
+      return "gaplimit";
+   case SCIP_STATUS_SOLLIMIT:
+      return "sollimit";
+   case SCIP_STATUS_BESTSOLLIMIT:
+      return "bestsollimit";
+   case SCIP_STATUS_RESTARTLIMIT:
+      return "restartlimit";
+   case SCIP_STATUS_OPTIMAL:
+      return "optimal";
+   case SCIP_STATUS_INFEASIBLE:
+      return "infeasible";
+   case SCIP_STATUS_UNBOUNDED:
+      return "unbounded";
+   case SCIP_STATUS_INFORUNBD:
+      return "inforunbd";
+   case SCIP_STATUS_TERMINATE:
+      return "terminate";
+   default:
+      return "unknown";
+   }
+}
+
+
+/** append a string as JSON string literal */
+static
+void appendJSONString(
+   std::ostringstream&   out,                /**< output stream */
+   const char*           str                 /**< string, or NULL for null */
+   )
+{
+   const char* c;
+
+   if ( str == NULL )
+   {
+      out << "null";
+      return;
+   }
+
+   out << '"';
+   for (c = str; *c != '\0'; ++c)
+   {
+      if ( *c == '"' || *c == '\\' )
+         out << '\\' << *c;
+      else if ( (unsigned char) *c < 0x20 )
+      {
+         char buf[8];
+
+         (void) snprintf(buf, sizeof(buf), "\\u%04x", (unsigned int) (unsigned char) *c);
+         out << buf;
+      }
+      else
+         out << *c;
+   }
+   out << '"';
+}
+
+
+/** read the jobs of the job file; returns SCIP_READERROR if the file cannot be read or a job is invalid */
+static
+SCIP_RETCODE readJobs(
+   const char*           jobfile,            /**< name of the job file */
+   const char*           progname,           /**< program name, used as first argument of each job */
+   std::vector<SBCS_JOB>& jobs               /**< vector to store the jobs */
+   )
+{
+   std::ifstream in(jobfile);
+   std::string line;
+   int lineno = 0;
+
+   if ( ! in )
+   {
+      SCIPerrorMessage("cannot read job file <%s>.\n", jobfile);
+      return SCIP_NOFILE;
+   }
+
+   while ( std::getline(in, line) )
+   {
+      std::istringstream tokenizer(line);
+      std::string token;
+      SBCS_JOB job;
+
+      ++lineno;
+      job.lineno = lineno;
+      job.tokens.push_back(progname);
+      while ( tokenizer >> token )
+      {
+         if ( token[0] == '#' )
+            break;
+         job.tokens.push_back(token);
+      }
+
+      if ( job.tokens.size() > 1 )
+         jobs.push_back(job);
+   }
+
+   /* the jobs do not move anymore, so the arguments can point into their tokens */
+   for (size_t j = 0; j < jobs.size(); ++j)
+   {
+      SBCS_JOB& job = jobs[j];
+
+      for (size_t t = 0; t < job.tokens.size(); ++t)
+         job.argv.push_back(&job.tokens[t][0]);
+
+      if ( parseArguments((int) job.argv.size(), job.argv.data(), &job.args, NULL, NULL) != SCIP_OKAY )
+      {
+         SCIPerrorMessage("invalid job in line %d of job file <%s>.\n", job.lineno, jobfile);
+         return SCIP_READERROR;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** run a job of the batch mode on a SCIP instance with included plugins, and collect its results
+ *
+ *  A symmetry cache file, given by -sbcs or by the settings, is made specific to the job by appending ".job<index>",
+ *  since jobs running at the same time on other threads must not read and write the same cache file.
+ */
+static
+SCIP_RETCODE runJob(
+   SCIP*                 scip,               /**< SCIP instance */
+   const SBCS_ARGS*      args,               /**< arguments of the job */
+   int                   jobidx,             /**< index of the job in the job file */
+   std::ostringstream&   result              /**< stream to append the results to */
+   )
+{
+   char* cachefile;
+
+   SCIP_CALL( SCIPresetParams(scip) );
+   SCIP_CALL( setParameters(scip, args) );
+
+   SCIP_CALL( SCIPgetStringParam(scip, "propagating/symmetry/cachefile", &cachefile) );
+   if ( strcmp(cachefile, "-") != 0 )
+   {
+      std::ostringstream jobcachefile;
+
+      jobcachefile << cachefile << ".job" << jobidx;
+      SCIP_CALL( SCIPsetStringParam(scip, "propagating/symmetry/cachefile", jobcachefile.str().c_str()) );
+   }
+   SCIP_CALL( solveProblem(scip, args) );
+
+   result << ",\"status\":";
+   appendJSONString(result, getStatusName(SCIPgetStatus(scip)));
+   result << ",\"primalbound\":" << SCIPgetPrimalbound(scip);
+   result << ",\"dualbound\":" << SCIPgetDualbound(scip);
+   result << ",\"gap\":" << SCIPgetGap(scip);
+   result << ",\"solvingtime\":" << SCIPgetSolvingTime(scip);
+   result << ",\"presolvingtime\":" << SCIPgetPresolvingTime(scip);
+   result << ",\"nodes\":" << SCIPgetNTotalNodes(scip);
+   result << ",\"nruns\":" << SCIPgetNRuns(scip);
+
+   SCIP_CALL( writeSolution(scip, args) );
+
+   SCIP_CALL( SCIPfreeProb(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/** worker thread of the batch mode
+ *
+ *  The plugins of the SCIP instance are included once. If a job fails, the instance is freed and a new one is created
+ *  for the next job, since the state of the instance is unknown.
+ */
+static
+void runBatchWorker(
+   SBCS_BATCH*           batch               /**< batch data */
+   )
+{
+   SCIP* scip = NULL;
+   int j;
+
+   assert( batch != NULL );
+
+   while ( (j = batch->nextjob++) < (int) batch->jobs.size() )
+   {
+      const SBCS_JOB& job = batch->jobs[j];
+      std::ostringstream result;
+      SCIP_RETCODE retcode = SCIP_OKAY;
+
+      result.precision(15);
+      result << "{\"job\":" << j << ",\"line\":" << job.lineno << ",\"file\":";
+      appendJSONString(result, job.args.filename);
+      result << ",\"settings\":";
+      appendJSONString(result, job.args.settingsname);
+      result << ",\"permseed\":" << job.args.permseed << ",\"randseed\":" << job.args.randseed;
+
+      if ( scip == NULL )
+      {
+         retcode = createSCIP(&scip);
+         if ( retcode == SCIP_OKAY )
+            SCIPsetMessagehdlrQuiet(scip, TRUE);
+      }
+
+      if ( retcode == SCIP_OKAY )
+         retcode = runJob(scip, &job.args, j, result);
+
+      if ( retcode != SCIP_OKAY && scip != NULL )
+         (void) SCIPfree(&scip);
+
+      result << ",\"retcode\":" << (int) retcode << "}\n";
+
+      {
+         std::lock_guard<std::mutex> lock(batch->outputmutex);
+
+         if ( retcode != SCIP_OKAY )
+            ++batch->nfailed;
+         std::cout << result.str() << std::flush;
+      }
+   }
+
+   if ( scip != NULL )
+      (void) SCIPfree(&scip);
+}
+
+
+/** run the jobs of a job file on a number of worker threads
+ *
+ *  Each worker thread has its own SCIP instance, so the plugins of sbcs do not share data between jobs. Note the
+ *  following restrictions if more than one thread is used:
+ *  - Each job gets its own symmetry cache file (see runJob()), so the cache is only reused if the same job file is run
+ *    again.
+ *  - Jobs must not write their solutions (-w) to the same file.
+ *  - Symmetry computation with nauty is not thread-safe in SCIP, since its interface keeps static data. If SCIP is
+ *    built with nauty, the jobs are therefore run on a single thread; use SYM=bliss to run them on several threads.
+ *  - The shared memory checks of the block memory (BMScheckEmptyMemory) are only done after all threads finished.
+ */
+static
+SCIP_RETCODE runBatch(
+   const char*           jobfile,            /**< name of the job file */
+   const char*           progname,           /**< program name */
+   int                   nthreads            /**< number of worker threads */
+   )
+{
+   SBCS_BATCH batch;
+   std::vector<std::thread> workers;
+
+   assert( jobfile != NULL );
+   assert( nthreads >= 1 );
+
+   SCIP_CALL( readJobs(jobfile, progname, batch.jobs) );
+
+   batch.nextjob = 0;
+   batch.nfailed = 0;
+
+   if ( nthreads > (int) batch.jobs.size() )
+      nthreads = MAX((int) batch.jobs.size(), 1);
+
+   /* only bliss is known to compute symmetries thread-safely */
+   if ( nthreads > 1 && SYMcanComputeSymmetry() && strncmp(SYMsymmetryGetName(), "bliss", 5) != 0 )
+   {
+      fprintf(stderr, "WARNING: symmetry computation with <%s> is not thread-safe, running the jobs on a single "
+         "thread.\n", SYMsymmetryGetName());
+      nthreads = 1;
+   }
+
+   /* the calling thread acts as the first worker */
+   for (int t = 1; t < nthreads; ++t)
+      workers.push_back(std::thread(runBatchWorker, &batch));
+   runBatchWorker(&batch);
+   for (size_t t = 0; t < workers.size(); ++t)
+      workers[t].join();
+
+   BMScheckEmptyMemory();
+
+   if ( batch.nfailed > 0 )
+   {
+      SCIPerrorMessage("%d of %d jobs failed.\n", batch.nfailed, (int) batch.jobs.size());
+      return SCIP_ERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+
 
 /** main function */
 int
@@ -194,9 +610,20 @@ main(
    char**                argv
    )
 {
+   SBCS_ARGS args;
    SCIP_RETCODE retcode;
+   const char* jobfile;
+   int nthreads;
+
+   /* parse command line arguments */
+   retcode = parseArguments(argc, argv, &args, &jobfile, &nthreads);
+   if ( retcode != SCIP_OKAY )
+      exit(1);
 
-   retcode = runSCIP(argc, argv);
+   if ( jobfile != NULL )
+      retcode = runBatch(jobfile, argv[0], nthreads);
+   else
+      retcode = runSCIP(&args);
    if ( retcode != SCIP_OKAY )
    {
       SCIPprintError(retcode);
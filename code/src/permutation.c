@@ -23,6 +23,7 @@
 
 #include "permutation.h"
 #include "scip/scip.h"
+#include <ctype.h>
 
 
 /** Compute the greatest common divisor of two nonnegative integers
@@ -86,43 +87,49 @@ SCIP_RETCODE SCIPgetPermutation(
    int cyclemaxindex;
    SCIP_Bool ismonotone;
    SCIP_Bool isordered;
-   int* checked;
    int thiscyclesize;
    int maxcyclesize;
    int ndescendpoints;
    int** cycles;
    int* cycleblock;
-   int* varcycle;
-   int* varcyclepos;
+   SCIP_PERMENTRY* entries;
    int* cyclelengths;
-   // int* cyclelengthsind;
-   // int* diffcyclelengths;
-   // int ndiffcyclelengths;
-   // int maxndiffcyclelengths;
+   int* cyclelengthsind;
+   int* diffcyclelengths;
+   int ndiffcyclelengths;
+   int maxndiffcyclelengths;
    int cycleid;
    int cycleblockpos;
 
    /* Careful: This is not a copy! */
    permutation->perm = perm;
 
-   /* Get the group order */
    assert( nvars > 0 );
+
+   /* The cycles are stored cycle-major in one contiguous block, and the cycle information of each entry is stored in
+    * a single record, such that permGet only touches the record of the entry, the cycle arrays and the cycle block.
+    */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cycleblock, nvars ) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &entries, nvars ) );
+
+   for (i = 0; i < nvars; ++i)
+      entries[i].cycle = -1;
+
+   /* Walk all cycles once, and get the group order and the structure of the permutation */
    order = 1;
    ncycles = 0;
    prevcyclemaxindex = -1;
    cyclemaxindex = -1;
    ismonotone = TRUE;
    isordered = TRUE;
-
-   SCIP_CALL( SCIPallocClearBufferArray(scip, &checked, nvars) );
    maxcyclesize = 0;
+   cycleblockpos = 0;
    for (i = 0; i < nvars; ++i)
    {
       /* If this index is already processed, skip this iteration. */
-      if ( checked[i] )
+      if ( entries[i].cycle >= 0 )
          continue;
 
-      ++ncycles;
       j = i;
       thiscyclesize = 0;
       ndescendpoints = 0;
@@ -136,7 +143,9 @@ SCIP_RETCODE SCIPgetPermutation(
          if ( perm[j] < j )
             ++ndescendpoints;
 
-         checked[j] = TRUE;
+         entries[j].cycle = ncycles;
+         entries[j].cyclepos = thiscyclesize;
+         cycleblock[cycleblockpos++] = j;
          j = perm[j];
          ++thiscyclesize;
       } while (j != i);
@@ -150,17 +159,9 @@ SCIP_RETCODE SCIPgetPermutation(
       order = lcm(order, thiscyclesize);
       if ( maxcyclesize < thiscyclesize )
          maxcyclesize = thiscyclesize;
+      ++ncycles;
    }
-
-   #ifndef NDEBUG
-   /* Debugging: Check if all entries are checked */
-   for (i = 0; i < nvars; ++i)
-   {
-      assert( checked[i] );
-   }
-   #endif
-
-   SCIPfreeBufferArray(scip, &checked);
+   assert( cycleblockpos == nvars );
 
    /* If this is an orbitope/orbisack, then do something. */
    if ( order <= 2 )
@@ -177,92 +178,73 @@ SCIP_RETCODE SCIPgetPermutation(
 
    /* Compute the cycle decomposition */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cycles, ncycles ) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cycleblock, nvars ) );
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cyclelengths, ncycles ) );
-   // SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cyclelengthsind, ncycles) );
-   // /* For the different cycle lengths: How many different cycle lengths could there exist?
-   //  * In the worst case, the maximal k, where 1 + 2 + ... + k <= n
-   //  * That is a quadratic formula with k = (sqrt(1 + 8n) - 1) / 2 as answer.
-   //  */
-   // maxndiffcyclelengths = (((int) SQRT((SCIP_Real) (1 + 8 * nvars))) / 2) + 1;
-   // SCIP_CALL( SCIPallocBlockMemoryArray(scip, &diffcyclelengths, maxndiffcyclelengths) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &varcycle, nvars ) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &varcyclepos, nvars ) );
-
-   for (i = 0; i < nvars; ++i)
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &cyclelengthsind, ncycles) );
+   /* For the different cycle lengths: How many different cycle lengths could there exist?
+    * In the worst case, the maximal k, where 1 + 2 + ... + k <= n
+    * That is a quadratic formula with k = (sqrt(1 + 8n) - 1) / 2 as answer.
+    */
+   maxndiffcyclelengths = (((int) SQRT((SCIP_Real) (1 + 8 * nvars))) / 2) + 1;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &diffcyclelengths, maxndiffcyclelengths) );
+
+   ndiffcyclelengths = 0;
+   for (cycleblockpos = 0; cycleblockpos < nvars; cycleblockpos += thiscyclesize)
    {
-      varcycle[i] = -1;
-      varcyclepos[i] = -1;
-   }
+      cycleid = entries[cycleblock[cycleblockpos]].cycle;
+      assert( entries[cycleblock[cycleblockpos]].cyclepos == 0 );
 
-   cycleid = 0;
-   cycleblockpos = 0;
-   // ndiffcyclelengths = 0;
-   for (i = 0; i < nvars; ++i)
-   {
-      /* If this index is already processed, don't process. */
-      if ( varcycle[i] >= 0 )
-         continue;
+      /* The cycle ends where the next cycle of the block starts. */
+      thiscyclesize = 1;
+      while ( cycleblockpos + thiscyclesize < nvars
+         && entries[cycleblock[cycleblockpos + thiscyclesize]].cycle == cycleid )
+         ++thiscyclesize;
 
       /* Store where the cycle starts */
       cycles[cycleid] = &cycleblock[cycleblockpos];
-
-      /* Walk a circle in the cycle */
-      j = i;
-      thiscyclesize = 0;
-      do
-      {
-         varcycle[j] = cycleid;
-         varcyclepos[j] = thiscyclesize;
-         cycleblock[cycleblockpos] = j;
-         j = perm[j];
-         ++thiscyclesize;
-         ++cycleblockpos;
-      } while (j != i);
-      assert( j == i );
-
       cyclelengths[cycleid] = thiscyclesize;
 
       /* Check if there is a cycle of this length. */
-      // if ( thiscyclesize <= 1 )
-      // {
-      //    cyclelengthsind[cycleid] = -1;
-      // }
-      // else
-      // {
-      //    for (j = 0; j < ndiffcyclelengths; ++j)
-      //    {
-      //       if ( diffcyclelengths[j] == thiscyclesize )
-      //       {
-      //          cyclelengthsind[cycleid] = j;
-      //          break;
-      //       }
-      //    }
-      //    /* If the loop did not break */
-      //    if (j == ndiffcyclelengths)
-      //    {
-      //       assert( ndiffcyclelengths < maxndiffcyclelengths );
-      //       cyclelengthsind[cycleid] = ndiffcyclelengths;
-      //       diffcyclelengths[ndiffcyclelengths++] = thiscyclesize;
-      //    }
-      // }
-
-      ++cycleid;
+      if ( thiscyclesize <= 1 )
+      {
+         cyclelengthsind[cycleid] = -1;
+      }
+      else
+      {
+         for (j = 0; j < ndiffcyclelengths; ++j)
+         {
+            if ( diffcyclelengths[j] == thiscyclesize )
+            {
+               cyclelengthsind[cycleid] = j;
+               break;
+            }
+         }
+         /* If the loop did not break */
+         if (j == ndiffcyclelengths)
+         {
+            assert( ndiffcyclelengths < maxndiffcyclelengths );
+            cyclelengthsind[cycleid] = ndiffcyclelengths;
+            diffcyclelengths[ndiffcyclelengths++] = thiscyclesize;
+         }
+      }
    }
-   assert( cycleid == ncycles );
    assert( cycleblockpos == nvars );
 
    permutation->cycles = cycles;
    permutation->cycleblock = cycleblock;
-   permutation->ncycles = ncycles;
    permutation->cyclelengths = cyclelengths;
-   // permutation->cyclelengthsind = cyclelengthsind;
-   // permutation->diffcyclelengths = diffcyclelengths;
-   // permutation->ndiffcyclelengths = ndiffcyclelengths;
-   // permutation->maxndiffcyclelengths = maxndiffcyclelengths;
+   permutation->cyclelengthsind = cyclelengthsind;
+   permutation->diffcyclelengths = diffcyclelengths;
+   permutation->ndiffcyclelengths = ndiffcyclelengths;
+   permutation->maxndiffcyclelengths = maxndiffcyclelengths;
    permutation->maxcyclesize = maxcyclesize;
-   permutation->varcycle = varcycle;
-   permutation->varcyclepos = varcyclepos;
+   permutation->entries = entries;
+
+   /* The table of powers is only built on request. */
+   permutation->powtable = NULL;
+   permutation->npowtable = 0;
+
+   permutation->nuses = 1;
+   permutation->scip = scip;
 
    return SCIP_OKAY;
 }
@@ -279,37 +261,64 @@ int permGet(
    int pow                                   /**< power to permute */
 )
 {
-   int cycleid;
-   int cyclelen;
+   SCIP_PERMENTRY* entry;
+   int cyclen;
    int pos;
 
    assert( perm != NULL );
    assert( index >= 0 );
    assert( index <= perm->nvars );
-   assert( perm->varcycle != NULL );
-   assert( perm->cyclelengths != NULL );
-   assert( perm->varcyclepos != NULL );
+   assert( perm->entries != NULL );
    assert( perm->cycles != NULL );
+   assert( perm->cyclelengths != NULL );
 
-   cycleid = perm->varcycle[index];
-   assert( cycleid < perm->ncycles );
+   /* If the power is tabulated, this is a single lookup. */
+   if ( perm->powtable != NULL && pow >= -perm->npowtable && pow <= perm->npowtable )
+      return perm->powtable[(pow + perm->npowtable) * perm->nvars + index];
 
-   cyclelen = perm->cyclelengths[cycleid];
+   entry = &perm->entries[index];
+   assert( 0 <= entry->cycle && entry->cycle < perm->ncycles );
+   cyclen = perm->cyclelengths[entry->cycle];
+   assert( entry->cyclepos >= 0 );
+   assert( entry->cyclepos < cyclen );
 
-   /* Get position of index in cycle */
-   pos = perm->varcyclepos[index];
-   assert( pos >= 0 );
-   assert( pos < cyclelen );
-
-   /* Update this position by "pow" places. */
-   pos = (pos + pow) % cyclelen;
+   /* Update the position of index in its cycle by "pow" places. */
+   pos = (entry->cyclepos + pow) % cyclen;
    if ( pos < 0 )
-      pos += cyclelen;
+      pos += cyclen;
    assert( pos >= 0 );
-   assert( pos < cyclelen );
+   assert( pos < cyclen );
 
    /* Return value of new position */
-   return perm->cycles[cycleid][pos];
+   return perm->cycles[entry->cycle][pos];
+}
+
+/** Given a SCIP_PERMUTATION object, give the array of the permutation raised to a power, if it is stored already.
+ * @param perm The SCIP_PERMUTATION object
+ * @param pow The power.
+ * @return The array of the power, or NULL if it is not stored.
+ */
+const int* permGetPowArray(
+   SCIP_PERMUTATION* perm,                   /**< the permutation */
+   int pow                                   /**< power to permute */
+)
+{
+   SCIP_Longint reducedpow;
+
+   assert( perm != NULL );
+   assert( perm->order > 0 );
+
+   if ( perm->powtable != NULL && pow >= -perm->npowtable && pow <= perm->npowtable )
+      return &perm->powtable[(pow + perm->npowtable) * perm->nvars];
+
+   reducedpow = pow % perm->order;
+   if ( reducedpow < 0 )
+      reducedpow += perm->order;
+
+   if ( reducedpow == 1 % perm->order )
+      return perm->perm;
+
+   return NULL;
 }
 
 /** Given a SCIP_PERMUTATION object, give the permutation array that maps 0..nvars to the permutation raised to a power.
@@ -374,10 +383,511 @@ SCIP_RETCODE SCIPfreePermutationContents(
    }
    SCIPfreeBlockMemoryArray(scip, &permutation->cycles, permutation->ncycles);
    SCIPfreeBlockMemoryArray(scip, &permutation->cycleblock, permutation->nvars);
+   SCIPfreeBlockMemoryArrayNull(scip, &permutation->powtable, (2 * permutation->npowtable + 1) * permutation->nvars);
    SCIPfreeBlockMemoryArray(scip, &permutation->cyclelengths, permutation->ncycles);
-   // SCIPfreeBlockMemoryArray(scip, &permutation->cyclelengthsind, permutation->ncycles);
-   // SCIPfreeBlockMemoryArray(scip, &permutation->diffcyclelengths, permutation->maxndiffcyclelengths);
-   SCIPfreeBlockMemoryArray(scip, &permutation->varcycle, permutation->nvars);
-   SCIPfreeBlockMemoryArray(scip, &permutation->varcyclepos, permutation->nvars);
+   SCIPfreeBlockMemoryArray(scip, &permutation->cyclelengthsind, permutation->ncycles);
+   SCIPfreeBlockMemoryArray(scip, &permutation->diffcyclelengths, permutation->maxndiffcyclelengths);
+   SCIPfreeBlockMemoryArray(scip, &permutation->entries, permutation->nvars);
+   return SCIP_OKAY;
+}
+
+/** Capture a SCIP_PERMUTATION object that is shared by another user.
+ * @param permutation The SCIP_PERMUTATION object.
+ */
+void SCIPcapturePermutation(
+   SCIP_PERMUTATION* permutation
+)
+{
+   assert( permutation != NULL );
+   assert( permutation->nuses >= 1 );
+
+   ++(permutation->nuses);
+}
+
+/** Release a SCIP_PERMUTATION object, freeing it with the last release.
+ * @param permutation Pointer to the SCIP_PERMUTATION object, which is set to NULL.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_RETCODE SCIPreleasePermutation(
+   SCIP_PERMUTATION** permutation
+)
+{
+   SCIP* scip;
+
+   assert( permutation != NULL );
+   assert( *permutation != NULL );
+   assert( (*permutation)->nuses >= 1 );
+
+   if ( --((*permutation)->nuses) == 0 )
+   {
+      scip = (*permutation)->scip;
+      assert( scip != NULL );
+
+      SCIP_CALL( SCIPfreePermutationContents(scip, *permutation, TRUE) );
+      SCIPfreeBlockMemory(scip, permutation);
+   }
+   *permutation = NULL;
+
+   return SCIP_OKAY;
+}
+
+/** Skip white space and separating commas in a string.
+ * @param s The string.
+ * @return Pointer to the first character that is neither white space nor ','.
+ */
+static
+const char* skipSeparators(
+   const char* s
+)
+{
+   while ( *s != '\0' && ( isspace((unsigned char)*s) || *s == ',' ) )
+      ++s;
+   return s;
+}
+
+/** Parse the arguments "[<vars>],[<perm>])" of a permutation based constraint from a string.
+ * The variables are parsed first, such that the permutation array can be allocated with its exact size and the
+ * permutation is checked to be a bijection on 0..nvars-1 in the same pass that reads it.
+ * @param scip The SCIP instance.
+ * @param str The string, directly after the opening parenthesis of the constraint.
+ * @param vars Pointer to store the buffer array of variables in; only allocated if success is TRUE.
+ * @param perm Pointer to store the buffer array of the permutation in; only allocated if success is TRUE.
+ *    It has to be freed before vars.
+ * @param nvars Pointer to store the number of variables in.
+ * @param success Pointer to store whether the arguments could be parsed.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_RETCODE SCIPparsePermutationArrays(
+   SCIP* scip,
+   const char* str,
+   SCIP_VAR*** vars,
+   int** perm,
+   int* nvars,
+   SCIP_Bool* success
+)
+{
+   const char* s;
+   char* endptr;
+   SCIP_VAR* var;
+   SCIP_Bool* isimage;
+   SCIP_Bool parseerror = FALSE;
+   int maxnvars = 128;
+   int nperm = 0;
+   int val;
+
+   assert( scip != NULL );
+   assert( str != NULL );
+   assert( vars != NULL );
+   assert( perm != NULL );
+   assert( nvars != NULL );
+   assert( success != NULL );
+
+   *success = FALSE;
+   *nvars = 0;
+   *vars = NULL;
+   *perm = NULL;
+
+   s = skipSeparators(str);
+   if ( *s != '[' )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected '[' to start array of variables\n");
+      return SCIP_OKAY;
+   }
+   ++s;
+
+   /* read the variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, vars, maxnvars) );
+   s = skipSeparators(s);
+   while ( *s != ']' )
+   {
+      SCIP_CALL( SCIPparseVarName(scip, s, &var, &endptr) );
+      if ( var == NULL )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unknown variable name at '%s'\n", s);
+         SCIPfreeBufferArray(scip, vars);
+         return SCIP_OKAY;
+      }
+      s = endptr;
+      assert( s != NULL );
+
+      if ( *nvars >= maxnvars )
+      {
+         maxnvars = SCIPcalcMemGrowSize(scip, *nvars + 1);
+         SCIP_CALL( SCIPreallocBufferArray(scip, vars, maxnvars) );
+      }
+      (*vars)[(*nvars)++] = var;
+
+      s = skipSeparators(s);
+      if ( *s == '\0' )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unexpected end of array of variables\n");
+         SCIPfreeBufferArray(scip, vars);
+         return SCIP_OKAY;
+      }
+   }
+   ++s;
+
+   s = skipSeparators(s);
+   if ( *s != '[' )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected '[' to start permutation array\n");
+      SCIPfreeBufferArray(scip, vars);
+      return SCIP_OKAY;
+   }
+   ++s;
+
+   /* read the permutation, which has exactly nvars entries */
+   SCIP_CALL( SCIPallocBufferArray(scip, perm, MAX(*nvars, 1)) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &isimage, MAX(*nvars, 1)) );
+   s = skipSeparators(s);
+   while ( *s != ']' )
+   {
+      if ( ! SCIPstrToIntValue(s, &val, &endptr) )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "could not extract int from string '%s'\n", s);
+         parseerror = TRUE;
+         break;
+      }
+      s = endptr;
+      assert( s != NULL );
+
+      if ( nperm >= *nvars )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "permutation is longer than vars array\n");
+         parseerror = TRUE;
+         break;
+      }
+      if ( val < 0 || val >= *nvars || isimage[val] )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "entry %d of permutation array is not a permutation of 0..%d\n",
+            val, *nvars - 1);
+         parseerror = TRUE;
+         break;
+      }
+      isimage[val] = TRUE;
+      (*perm)[nperm++] = val;
+
+      s = skipSeparators(s);
+      if ( *s == '\0' )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "unexpected end of permutation array\n");
+         parseerror = TRUE;
+         break;
+      }
+   }
+   SCIPfreeBufferArray(scip, &isimage);
+
+   /* On an error, s may already point past the offending entry, possibly at the closing ']'. */
+   if ( ! parseerror && *s == ']' )
+   {
+      ++s;
+      while ( *s != '\0' && isspace((unsigned char)*s) )
+         ++s;
+
+      if ( *s != ')' )
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL, "expected two arrays followed by ')'\n");
+      else if ( nperm != *nvars )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_MINIMAL, NULL,
+            "Length of permutation is not equal to number of given variables.\n");
+      }
+      else
+         *success = TRUE;
+   }
+
+   if ( ! *success )
+   {
+      SCIPfreeBufferArray(scip, perm);
+      SCIPfreeBufferArray(scip, vars);
+      *nvars = 0;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** Write the arguments "[<vars>],[<perm>]" of a permutation based constraint, such that SCIPparsePermutationArrays
+ * can read them back. The permutation is collected in chunks of SCIP_MAXSTRLEN characters instead of writing every
+ * entry with a separate message.
+ * @param scip The SCIP instance.
+ * @param file The output file, or NULL for standard output.
+ * @param vars The variables.
+ * @param perm The permutation on 0..nvars-1.
+ * @param nvars The number of variables, which is positive.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_RETCODE SCIPwritePermutationArrays(
+   SCIP* scip,
+   FILE* file,
+   SCIP_VAR** vars,
+   int* perm,
+   int nvars
+)
+{
+   char buffer[SCIP_MAXSTRLEN];
+   int pos = 0;
+   int i;
+
+   assert( scip != NULL );
+   assert( vars != NULL );
+   assert( perm != NULL );
+   assert( nvars > 0 );
+
+   SCIPinfoMessage(scip, file, "[");
+   SCIP_CALL( SCIPwriteVarName(scip, file, vars[0], TRUE) );
+   for (i = 1; i < nvars; ++i)
+   {
+      SCIPinfoMessage(scip, file, ",");
+      SCIP_CALL( SCIPwriteVarName(scip, file, vars[i], TRUE) );
+   }
+
+   pos = SCIPsnprintf(buffer, SCIP_MAXSTRLEN, "],[%d", perm[0]);
+   for (i = 1; i < nvars; ++i)
+   {
+      /* an entry needs at most 12 characters including its separator */
+      if ( pos > SCIP_MAXSTRLEN - 16 )
+      {
+         SCIPinfoMessage(scip, file, "%s", buffer);
+         pos = 0;
+      }
+      pos += SCIPsnprintf(buffer + pos, SCIP_MAXSTRLEN - pos, ",%d", perm[i]);
+   }
+   SCIPinfoMessage(scip, file, "%s]", buffer);
+
+   return SCIP_OKAY;
+}
+
+/** Get the position of the lowest set bit of a nonzero word.
+ * @param word The word, which must be nonzero.
+ * @return The position of the lowest set bit.
+ */
+int getLowestBit(
+   uint64_t word
+)
+{
+   int pos = 0;
+
+   assert( word != 0 );
+
+   if ( (word & 0xFFFFFFFFULL) == 0 )
+   {
+      word >>= 32;
+      pos += 32;
+   }
+   if ( (word & 0xFFFFULL) == 0 )
+   {
+      word >>= 16;
+      pos += 16;
+   }
+   if ( (word & 0xFFULL) == 0 )
+   {
+      word >>= 8;
+      pos += 8;
+   }
+   while ( (word & 1ULL) == 0 )
+   {
+      word >>= 1;
+      ++pos;
+   }
+
+   return pos;
+}
+
+/** Pack a vector of binary values into words of PACKEDWORDBITS entries.
+ * @param vals The values, where each value larger than 0.5 is interpreted as 1 and all others as 0.
+ * @param nvals The number of values.
+ * @param packed The allocated array of PACKEDNWORDS(nvals) words to store the packed vector in.
+ *    Unused bits of the last word are set to 0.
+ */
+void packBinaryVector(
+   SCIP_Real* vals,
+   int nvals,
+   uint64_t* packed
+)
+{
+   int i;
+
+   assert( vals != NULL || nvals == 0 );
+   assert( packed != NULL || nvals == 0 );
+
+   for (i = 0; i < PACKEDNWORDS(nvals); ++i)
+      packed[i] = 0;
+
+   for (i = 0; i < nvals; ++i)
+   {
+      if ( vals[i] > 0.5 )
+         packed[PACKEDWORD(i)] |= PACKEDMASK(i);
+   }
+}
+
+/** Given a packed binary vector x and an index map, find the first entry i with x[i] != x[gather[i]].
+ * The comparison is done word-wise, i.e., PACKEDWORDBITS entries at a time.
+ * @param packed The packed binary vector x.
+ * @param gather The index map, e.g., the inverse of a permutation, with an entry for each of the nvals entries.
+ * @param nvals The number of entries of x.
+ * @return The first differing entry, or -1 if x and its image coincide.
+ */
+int findFirstPackedDifference(
+   uint64_t* packed,
+   int* gather,
+   int nvals
+)
+{
+   uint64_t image;
+   uint64_t diff;
+   int begin;
+   int end;
+   int w;
+   int i;
+   int j;
+
+   assert( packed != NULL || nvals == 0 );
+   assert( gather != NULL || nvals == 0 );
+
+   for (w = 0; w < PACKEDNWORDS(nvals); ++w)
+   {
+      begin = w * PACKEDWORDBITS;
+      end = MIN(begin + PACKEDWORDBITS, nvals);
+
+      /* Gather the image of the entries of this word. */
+      image = 0;
+      for (i = begin; i < end; ++i)
+      {
+         j = gather[i];
+         assert( 0 <= j && j < nvals );
+         if ( packed[PACKEDWORD(j)] & PACKEDMASK(j) )
+            image |= PACKEDMASK(i);
+      }
+
+      diff = image ^ packed[w];
+      if ( diff != 0 )
+         return begin + getLowestBit(diff);
+   }
+
+   return -1;
+}
+
+/** Given a packed binary vector x and a SCIP_PERMUTATION object, find the first entry i with x[i] != x[perm^pow(i)].
+ * The comparison is done word-wise, i.e., PACKEDWORDBITS entries at a time.
+ * @param perm The SCIP_PERMUTATION object.
+ * @param pow The power of the permutation.
+ * @param packed The packed binary vector x with perm->nvars entries.
+ * @return The first differing entry, or -1 if x and its image coincide.
+ */
+int permFindFirstPackedDifference(
+   SCIP_PERMUTATION* perm,
+   int pow,
+   uint64_t* packed
+)
+{
+   uint64_t image;
+   uint64_t diff;
+   int begin;
+   int end;
+   int w;
+   int i;
+   int j;
+
+   assert( perm != NULL );
+   assert( packed != NULL );
+
+   for (w = 0; w < PACKEDNWORDS(perm->nvars); ++w)
+   {
+      begin = w * PACKEDWORDBITS;
+      end = MIN(begin + PACKEDWORDBITS, perm->nvars);
+
+      /* Gather the image of the entries of this word. */
+      image = 0;
+      for (i = begin; i < end; ++i)
+      {
+         j = permGet(perm, i, pow);
+         if ( packed[PACKEDWORD(j)] & PACKEDMASK(j) )
+            image |= PACKEDMASK(i);
+      }
+
+      diff = image ^ packed[w];
+      if ( diff != 0 )
+         return begin + getLowestBit(diff);
+   }
+
+   return -1;
+}
+
+/** Build the table of the powers -npowers, ..., npowers of a SCIP_PERMUTATION object, such that permGet is a single
+ * lookup for these powers. An existing table is replaced.
+ * @param scip The SCIP instance.
+ * @param perm The SCIP_PERMUTATION object.
+ * @param npowers The number of positive (and negative) powers to tabulate. Powers beyond the group order are not needed,
+ *    so this number is capped by order - 1.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_RETCODE SCIPcomputePermutationPowTable(
+   SCIP* scip,
+   SCIP_PERMUTATION* perm,
+   int npowers
+)
+{
+   int* shifts;
+   int* row;
+   int* cycle;
+   int cyclelen;
+   int shift;
+   int pow;
+   int c;
+   int d;
+   int i;
+
+   assert( scip != NULL );
+   assert( perm != NULL );
+   assert( npowers >= 0 );
+
+   /* Remove a previously computed table. */
+   SCIPfreeBlockMemoryArrayNull(scip, &perm->powtable, (2 * perm->npowtable + 1) * perm->nvars);
+   perm->npowtable = 0;
+
+   if ( npowers > perm->order - 1 )
+      npowers = (int) (perm->order - 1);
+   if ( npowers <= 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &perm->powtable, (2 * npowers + 1) * perm->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shifts, perm->ndiffcyclelengths) );
+
+   for (pow = -npowers; pow <= npowers; ++pow)
+   {
+      row = &perm->powtable[(pow + npowers) * perm->nvars];
+
+      /* The shift of the cycle positions only depends on the cycle length, so compute it once per distinct length. */
+      for (d = 0; d < perm->ndiffcyclelengths; ++d)
+      {
+         shifts[d] = pow % perm->diffcyclelengths[d];
+         if ( shifts[d] < 0 )
+            shifts[d] += perm->diffcyclelengths[d];
+      }
+
+      for (c = 0; c < perm->ncycles; ++c)
+      {
+         cycle = perm->cycles[c];
+         cyclelen = perm->cyclelengths[c];
+
+         /* Fixed points do not have a distinct cycle length entry. */
+         if ( perm->cyclelengthsind[c] < 0 )
+         {
+            assert( cyclelen == 1 );
+            row[cycle[0]] = cycle[0];
+            continue;
+         }
+
+         shift = shifts[perm->cyclelengthsind[c]];
+         assert( 0 <= shift && shift < cyclelen );
+         for (i = 0; i < cyclelen - shift; ++i)
+            row[cycle[i]] = cycle[i + shift];
+         for (; i < cyclelen; ++i)
+            row[cycle[i]] = cycle[i + shift - cyclelen];
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &shifts);
+   perm->npowtable = npowers;
+
    return SCIP_OKAY;
 }
@@ -20,12 +20,34 @@
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
+#ifndef __SCIP_PERMUTATION_H__
+#define __SCIP_PERMUTATION_H__
+
 #include "scip/scip.h"
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Macros for packed binary vectors, storing entry i in bit i % PACKEDWORDBITS of word i / PACKEDWORDBITS */
+#define PACKEDWORDBITS       64                                          /* Number of entries per word. */
+#define PACKEDNWORDS(n)      (((n) + PACKEDWORDBITS - 1) / PACKEDWORDBITS) /* Number of words for n entries. */
+#define PACKEDWORD(i)        ((i) / PACKEDWORDBITS)                      /* Word containing entry i. */
+#define PACKEDMASK(i)        (((uint64_t) 1) << ((i) % PACKEDWORDBITS))  /* Bit of entry i in its word. */
+
+
+/** Cycle information of a single entry of a permutation, stored together such that permGet touches one record
+ *
+ *  The start and the length of the cycle are looked up through the cycle index, in cycles and cyclelengths.
+ */
+typedef struct SCIP_PermEntry SCIP_PERMENTRY;
+struct SCIP_PermEntry
+{
+   int                   cycle;              /**< index of the cycle that contains this entry */
+   int                   cyclepos;           /**< position of this entry in its cycle */
+};
+
 
 /** Permutation specification */
 typedef struct SCIP_Permutation SCIP_PERMUTATION;
@@ -39,14 +61,17 @@ struct SCIP_Permutation
    int                   ncycles;            /**< The number of cycles in the cycle decomposition */
    int*                  cyclelengths;       /**< The length of each cycle in the cycle decomposition */
    int                   maxcyclesize;       /**< The maximal size of a cycle in the permutation */
-   // int*                  cyclelengthsind;    /**< The index of the cycle length in diffcyclelengths.*/
-   // int*                  diffcyclelengths;   /**< The different cycle lengths popping up in the cycle decomposition */
-   // int                   ndiffcyclelengths;  /**< The number of different cycle lengths */
-   // int                   maxndiffcyclelengths; /**< An upper bound on the maximal number of different cycle lengths. */
-   int*                  varcycle;           /**< For each variable index, the index of the cycle that contains this */
-   int*                  varcyclepos;        /**< For each variable index, the position in the cycle that contains this */
+   int*                  cyclelengthsind;    /**< The index of the cycle length in diffcyclelengths, or -1 for fixed points */
+   int*                  diffcyclelengths;   /**< The different cycle lengths popping up in the cycle decomposition */
+   int                   ndiffcyclelengths;  /**< The number of different cycle lengths */
+   int                   maxndiffcyclelengths; /**< An upper bound on the maximal number of different cycle lengths. */
+   SCIP_PERMENTRY*       entries;            /**< For each variable index, the cycle that contains it and its position */
    SCIP_Bool             ismonotone;         /**< Whether the generating permutation is monotonous */
    SCIP_Bool             isordered;          /**< Whether the generating permutation is ordered */
+   int*                  powtable;           /**< Table of the powers -npowtable, ..., npowtable, or NULL. Row p + npowtable is perm^p. */
+   int                   npowtable;          /**< The number of positive (and negative) powers in powtable */
+   int                   nuses;              /**< The number of users sharing this object (reference count) */
+   SCIP*                 scip;               /**< The SCIP instance whose block memory holds this object */
 };
 
 
@@ -103,6 +128,20 @@ int permGet(
 );
 
 
+/** Given a SCIP_PERMUTATION object, give the array of the permutation raised to a power, if it is stored already.
+ * This is the case for tabulated powers, and for powers that are congruent to 1 modulo the order (in particular all odd
+ * powers of an involution). Then the power of an entry can be looked up without the case distinctions of permGet.
+ * @param perm The SCIP_PERMUTATION object
+ * @param pow The power.
+ * @return The array of the power, or NULL if it is not stored.
+ */
+SCIP_EXPORT
+const int* permGetPowArray(
+   SCIP_PERMUTATION* perm,                   /**< the permutation */
+   int pow                                   /**< power to permute */
+);
+
+
 /** Given a SCIP_PERMUTATION object, give the permutation array that maps 0..nvars to the permutation raised to a power.
  * @param perm The SCIP_PERMUTATION object
  * @param pow The power for which we want to permute.
@@ -119,6 +158,22 @@ SCIP_RETCODE getPermArray(
 );
 
 
+/** Build the table of the powers -npowers, ..., npowers of a SCIP_PERMUTATION object, such that permGet is a single
+ * lookup for these powers. An existing table is replaced.
+ * @param scip The SCIP instance.
+ * @param perm The SCIP_PERMUTATION object.
+ * @param npowers The number of positive (and negative) powers to tabulate. Powers beyond the group order are not needed,
+ *    so this number is capped by order - 1.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputePermutationPowTable(
+   SCIP* scip,
+   SCIP_PERMUTATION* perm,
+   int npowers
+);
+
+
 /** Free a SCIP_PERMUTATION object.
  * @param scip the SCIP instance
  * @param permutation The SCIP_PERMUTATION object
@@ -134,6 +189,128 @@ SCIP_RETCODE SCIPfreePermutationContents(
 );
 
 
+/** Capture a SCIP_PERMUTATION object that is shared by another user.
+ *
+ * The permutation data is immutable after creation (apart from the table of powers, which is only ever added), so
+ * copies of a constraint may share it instead of recomputing the cycle decomposition. The reference count is not
+ * synchronized, so an object may only be shared with copies that are created and freed by the thread solving the
+ * owning SCIP instance.
+ * @param permutation The SCIP_PERMUTATION object.
+ */
+SCIP_EXPORT
+void SCIPcapturePermutation(
+   SCIP_PERMUTATION* permutation
+);
+
+
+/** Release a SCIP_PERMUTATION object. The last release frees the contents, including the field "perm", and the
+ * object itself, which must have been allocated in the block memory of the SCIP instance passed to SCIPgetPermutation.
+ * @param permutation Pointer to the SCIP_PERMUTATION object, which is set to NULL.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPreleasePermutation(
+   SCIP_PERMUTATION** permutation
+);
+
+
+/** Parse the arguments "[<vars>],[<perm>])" of a permutation based constraint from a string.
+ * The permutation is checked to be a bijection on 0..nvars-1.
+ * @param scip The SCIP instance.
+ * @param str The string, directly after the opening parenthesis of the constraint.
+ * @param vars Pointer to store the buffer array of variables in; only allocated if success is TRUE.
+ * @param perm Pointer to store the buffer array of the permutation in; only allocated if success is TRUE.
+ *    It has to be freed before vars.
+ * @param nvars Pointer to store the number of variables in.
+ * @param success Pointer to store whether the arguments could be parsed.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPparsePermutationArrays(
+   SCIP* scip,
+   const char* str,
+   SCIP_VAR*** vars,
+   int** perm,
+   int* nvars,
+   SCIP_Bool* success
+);
+
+
+/** Write the arguments "[<vars>],[<perm>]" of a permutation based constraint, such that SCIPparsePermutationArrays
+ * can read them back.
+ * @param scip The SCIP instance.
+ * @param file The output file, or NULL for standard output.
+ * @param vars The variables.
+ * @param perm The permutation on 0..nvars-1.
+ * @param nvars The number of variables, which is positive.
+ * @return SCIP_OKAY if successful.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPwritePermutationArrays(
+   SCIP* scip,
+   FILE* file,
+   SCIP_VAR** vars,
+   int* perm,
+   int nvars
+);
+
+
+/** Get the position of the lowest set bit of a nonzero word.
+ * @param word The word, which must be nonzero.
+ * @return The position of the lowest set bit.
+ */
+SCIP_EXPORT
+int getLowestBit(
+   uint64_t word
+);
+
+
+/** Pack a vector of binary values into words of PACKEDWORDBITS entries.
+ * @param vals The values, where each value larger than 0.5 is interpreted as 1 and all others as 0.
+ * @param nvals The number of values.
+ * @param packed The allocated array of PACKEDNWORDS(nvals) words to store the packed vector in.
+ *    Unused bits of the last word are set to 0.
+ */
+SCIP_EXPORT
+void packBinaryVector(
+   SCIP_Real* vals,
+   int nvals,
+   uint64_t* packed
+);
+
+
+/** Given a packed binary vector x and an index map, find the first entry i with x[i] != x[gather[i]].
+ * The comparison is done word-wise, i.e., PACKEDWORDBITS entries at a time.
+ * @param packed The packed binary vector x.
+ * @param gather The index map, e.g., the inverse of a permutation, with an entry for each of the nvals entries.
+ * @param nvals The number of entries of x.
+ * @return The first differing entry, or -1 if x and its image coincide.
+ */
+SCIP_EXPORT
+int findFirstPackedDifference(
+   uint64_t* packed,
+   int* gather,
+   int nvals
+);
+
+
+/** Given a packed binary vector x and a SCIP_PERMUTATION object, find the first entry i with x[i] != x[perm^pow(i)].
+ * The comparison is done word-wise, i.e., PACKEDWORDBITS entries at a time.
+ * @param perm The SCIP_PERMUTATION object.
+ * @param pow The power of the permutation.
+ * @param packed The packed binary vector x with perm->nvars entries.
+ * @return The first differing entry, or -1 if x and its image coincide.
+ */
+SCIP_EXPORT
+int permFindFirstPackedDifference(
+   SCIP_PERMUTATION* perm,
+   int pow,
+   uint64_t* packed
+);
+
+
 #ifdef __cplusplus
 }
 #endif
+
+#endif
@@ -149,6 +149,13 @@
 #include <scip/symmetry.h>
 
 #include <string.h>
+#ifdef _WIN32
+#include <process.h>
+#define SYMCACHEGETPID _getpid
+#else
+#include <unistd.h>
+#define SYMCACHEGETPID getpid
+#endif
 
 /* propagator properties */
 #define PROP_NAME            "symmetry"
@@ -166,6 +173,7 @@
 /* default parameter values for symmetry computation */
 #define DEFAULT_MAXGENERATORS        1500    /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
 #define DEFAULT_CHECKSYMMETRIES     FALSE    /**< Should all symmetries be checked after computation? */
+#define DEFAULT_CACHEFILE             "-"    /**< file in which generators are cached across runs ("-" = no cache) */
 #define DEFAULT_DISPLAYNORBITVARS   FALSE    /**< Should the number of variables affected by some symmetry be displayed? */
 #define DEFAULT_USECOLUMNSPARSITY   FALSE    /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
 #define DEFAULT_DOUBLEEQUATIONS     FALSE    /**< Double equations to positive/negative version? */
@@ -196,7 +204,7 @@
 /* default parameters for orbital fixing */
 #define DEFAULT_OFSYMCOMPTIMING         2    /**< timing of symmetry computation for orbital fixing (0 = before presolving, 1 = during presolving, 2 = at first call) */
 #define DEFAULT_PERFORMPRESOLVING   FALSE    /**< Run orbital fixing during presolving? */
-#define DEFAULT_RECOMPUTERESTART        0    /**< Recompute symmetries after a restart has occurred? (0 = never, 1 = always, 2 = if OF found reduction) */
+#define DEFAULT_RECOMPUTERESTART        0    /**< Recompute symmetries after a restart has occurred? (0 = never, 1 = always, 2 = if OF found reduction, 3 = incrementally) */
 
 /* default parameters for Schreier Sims constraints */
 #define DEFAULT_SSTTIEBREAKRULE   1          /**< index of tie break rule for selecting orbit for Schreier Sims constraints? */
@@ -222,6 +230,9 @@
 #define MAXGENNUMERATOR          64000000    /**< determine maximal number of generators by dividing this number by the number of variables */
 #define SCIP_SPECIALVAL 1.12345678912345e+19 /**< special floating point value for handling zeros in bound disjunctions */
 #define COMPRESSNVARSLB             25000    /**< lower bound on the number of variables above which compression could be performed */
+#define MAXORBITCACHEENTRIES           64    /**< maximal number of nodes on the current path whose orbits are cached for orbital fixing */
+#define SYMCACHEMAGIC 0x53594D4341434831ULL /**< magic number identifying symmetry cache files */
+#define SYM_RECOMPUTESYM_INCREMENTAL    3    /**< recompute symmetries after a restart by verifying the previous generators */
 
 /* macros for getting activeness of symmetry handling methods */
 #define ISSYMRETOPESACTIVE(x)      (((unsigned) x & SYM_HANDLETYPE_SYMBREAK) != 0)
@@ -234,6 +245,22 @@
 #define ISSSTCONTACTIVE(x)         (((unsigned) x & SCIP_SSTTYPE_CONTINUOUS) != 0)
 
 
+/** orbits of the binary variables w.r.t. the permutations that are active at a node, valid in the subtree of the node */
+struct SYM_OrbitCacheEntry
+{
+   SCIP_Longint          nodenumber;         /**< number of the node at which the orbits have been computed */
+   int                   depth;              /**< depth of the node */
+   int*                  inactiveperms;      /**< sorted list of the permutations that are inactive at the node */
+   int                   ninactiveperms;     /**< number of inactive permutations */
+   int*                  orbits;             /**< array of non-trivial orbits */
+   int                   orbitssize;         /**< size of orbits array */
+   int*                  orbitbegins;        /**< array containing begin positions of new orbits in orbits array */
+   int                   norbits;            /**< number of orbits */
+   SCIP_Shortbool*       orbitsettled;       /**< whether all variables of an orbit are fixed in the subtree of the node */
+};
+typedef struct SYM_OrbitCacheEntry SYM_ORBITCACHEENTRY;
+
+
 /** propagator data */
 struct SCIP_PropData
 {
@@ -276,6 +303,7 @@ struct SCIP_PropData
    /* for symmetry computation */
    int                   maxgenerators;      /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
    SCIP_Bool             checksymmetries;    /**< Should all symmetries be checked after computation? */
+   char*                 cachefile;          /**< file in which generators are cached across runs ("-" = no cache) */
    SCIP_Bool             displaynorbitvars;  /**< Whether the number of variables in non-trivial orbits shall be computed */
    SCIP_Bool             compresssymmetries; /**< Should non-affected variables be removed from permutation to save memory? */
    SCIP_Real             compressthreshold;  /**< Compression is used if percentage of moved vars is at most the threshold. */
@@ -329,8 +357,11 @@ struct SCIP_PropData
    int                   nbg1;               /**< number of variables in bg1 and bg1list */
    int*                  permvarsevents;     /**< stores events caught for permvars */
    SCIP_Shortbool*       inactiveperms;      /**< array to store whether permutations are inactive */
+   SYM_ORBITCACHEENTRY*  orbitcache;         /**< stack of the orbits at nodes on the current path, by increasing depth */
+   int                   norbitcache;        /**< number of entries in orbitcache */
+   int                   orbitcacherun;      /**< run in which the entries of orbitcache have been computed */
    SCIP_Bool             performpresolving;  /**< Run orbital fixing during presolving? */
-   int                   recomputerestart;   /**< Recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction) */
+   int                   recomputerestart;   /**< Recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction, 3 = incrementally) */
    int                   ofsymcomptiming;    /**< timing of orbital fixing (0 = before presolving, 1 = during presolving, 2 = at first call) */
    int                   lastrestart;        /**< last restart for which symmetries have been computed */
    int                   nfixedzero;         /**< number of variables fixed to 0 */
@@ -738,6 +769,25 @@ struct SYM_Sortgraphcompvars
 };
 typedef struct SYM_Sortgraphcompvars SYM_SORTGRAPHCOMPVARS;
 
+/** index of the 2-cycles of the generators of a symmetry component
+ *
+ *  For each generator, the smaller entries of its 2-cycles are listed in increasing order, such that routines handling
+ *  2-cycles do not have to scan all permutation variables for each generator. Optionally, the transposed index lists
+ *  for each variable the generators moving it.
+ */
+struct SYM_Twocycleindex
+{
+   int*                  cycles;             /**< smaller entries of the 2-cycles of all generators, generator by generator */
+   int*                  cyclebegins;        /**< begin positions of the 2-cycles of each generator in cycles */
+   int*                  ntwocycles;         /**< number of 2-cycles of each generator (0 if it is not an involution) */
+   int*                  nbincycles;         /**< number of 2-cycles of each generator on binary variables */
+   int*                  varperms;           /**< generators moving each variable, variable by variable (or NULL) */
+   int*                  varpermbegins;      /**< begin positions of the generators moving each variable in varperms (or NULL) */
+   int                   nperms;             /**< number of generators of the component */
+   int                   npermvars;          /**< number of permutation variables */
+};
+typedef struct SYM_Twocycleindex SYM_TWOCYCLEINDEX;
+
 /** sorts rhs types - first by sense, then by value
  *
  *  Due to numerical issues, we first sort by sense, then by value.
@@ -799,6 +849,29 @@ SCIP_DECL_SORTINDCOMP(SYMsortMatCoef)
 }
 
 
+/** sorts row indices by their signature
+ *
+ *  result:
+ *    < 0: ind1 comes before (is better than) ind2
+ *    = 0: both indices have the same value
+ *    > 0: ind2 comes after (is worse than) ind2
+ */
+static
+SCIP_DECL_SORTINDCOMP(SYMsortRowSignatures)
+{
+   uint64_t* signatures;
+
+   signatures = (uint64_t*) dataptr;
+
+   if ( signatures[ind1] < signatures[ind2] )
+      return -1;
+   else if ( signatures[ind1] > signatures[ind2] )
+      return 1;
+
+   return 0;
+}
+
+
 /** sorts variable indices according to their corresponding component in the graph
  *
  *  Variables are sorted first by the color of their component and then by the component index.
@@ -857,6 +930,7 @@ SCIP_Bool checkSymmetryDataFree(
    assert( propdata->permvars == NULL );
    assert( propdata->permvarsobj == NULL );
    assert( propdata->inactiveperms == NULL );
+   assert( propdata->norbitcache == 0 );
    assert( propdata->perms == NULL );
    assert( propdata->permstrans == NULL );
    assert( propdata->nonbinpermvarcaptured == NULL );
@@ -913,6 +987,161 @@ SCIP_Bool isLeadervartypeCompatible(
 }
 
 
+/** frees the entries of the orbit cache from position @p first on */
+static
+void freeOrbitCacheEntries(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry breaking propagator */
+   int                   first               /**< position of the first entry to free */
+   )
+{
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( 0 <= first );
+
+   while ( propdata->norbitcache > first )
+   {
+      SYM_ORBITCACHEENTRY* entry;
+
+      entry = &propdata->orbitcache[--propdata->norbitcache];
+      SCIPfreeBlockMemoryArrayNull(scip, &entry->orbitsettled, entry->norbits);
+      SCIPfreeBlockMemoryArrayNull(scip, &entry->orbitbegins, entry->norbits + 1);
+      SCIPfreeBlockMemoryArrayNull(scip, &entry->orbits, entry->orbitssize);
+      SCIPfreeBlockMemoryArrayNull(scip, &entry->inactiveperms, MAX(entry->ninactiveperms, 1));
+   }
+}
+
+
+/** removes the entries of the orbit cache that do not belong to a node on the path from @p node to the root
+ *
+ *  The entries are stacked in order of non-decreasing depth, so the path is walked upwards only once.
+ */
+static
+void popOrbitCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry breaking propagator */
+   SCIP_NODE*            node                /**< current node */
+   )
+{
+   assert( scip != NULL );
+   assert( propdata != NULL );
+
+   /* node numbers start anew in every run */
+   if ( propdata->orbitcacherun != SCIPgetNRuns(scip) )
+   {
+      freeOrbitCacheEntries(scip, propdata, 0);
+      propdata->orbitcacherun = SCIPgetNRuns(scip);
+   }
+
+   while ( propdata->norbitcache > 0 )
+   {
+      SYM_ORBITCACHEENTRY* entry;
+
+      entry = &propdata->orbitcache[propdata->norbitcache - 1];
+      while ( node != NULL && SCIPnodeGetDepth(node) > entry->depth )
+         node = SCIPnodeGetParent(node);
+
+      if ( node != NULL && SCIPnodeGetDepth(node) == entry->depth && SCIPnodeGetNumber(node) == entry->nodenumber )
+         break;
+
+      freeOrbitCacheEntries(scip, propdata, propdata->norbitcache - 1);
+   }
+}
+
+
+/** checks whether the inactive permutations of an orbit cache entry are exactly the currently inactive permutations */
+static
+SCIP_Bool orbitCacheEntryMatches(
+   SYM_ORBITCACHEENTRY*  entry,              /**< entry of the orbit cache */
+   SCIP_Shortbool*       inactiveperms,      /**< array marking the currently inactive permutations */
+   int                   ninactiveperms      /**< number of currently inactive permutations */
+   )
+{
+   int p;
+
+   assert( entry != NULL );
+   assert( inactiveperms != NULL );
+
+   if ( entry->ninactiveperms != ninactiveperms )
+      return FALSE;
+
+   for (p = 0; p < entry->ninactiveperms; ++p)
+   {
+      if ( ! inactiveperms[entry->inactiveperms[p]] )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+/** pushes the orbits of the current node to the orbit cache, if there is space left */
+static
+SCIP_RETCODE pushOrbitCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_PROPDATA*        propdata,           /**< data of symmetry breaking propagator */
+   SCIP_NODE*            node,               /**< current node */
+   SCIP_Shortbool*       inactiveperms,      /**< array marking the currently inactive permutations */
+   int                   ninactiveperms,     /**< number of currently inactive permutations */
+   int*                  orbits,             /**< array of non-trivial orbits */
+   int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
+   int                   norbits,            /**< number of orbits */
+   SYM_ORBITCACHEENTRY** entry               /**< pointer to store the new entry, or NULL if the cache is full */
+   )
+{
+   int p;
+   int k;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( node != NULL );
+   assert( entry != NULL );
+
+   *entry = NULL;
+
+   /* a previous entry of the same node is outdated, e.g., by new global fixings */
+   if ( propdata->norbitcache > 0
+      && propdata->orbitcache[propdata->norbitcache - 1].nodenumber == SCIPnodeGetNumber(node) )
+      freeOrbitCacheEntries(scip, propdata, propdata->norbitcache - 1);
+
+   if ( propdata->norbitcache >= MAXORBITCACHEENTRIES )
+      return SCIP_OKAY;
+
+   if ( propdata->orbitcache == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->orbitcache, MAXORBITCACHEENTRIES) );
+   }
+
+   *entry = &propdata->orbitcache[propdata->norbitcache++];
+   (*entry)->nodenumber = SCIPnodeGetNumber(node);
+   (*entry)->depth = SCIPnodeGetDepth(node);
+   (*entry)->ninactiveperms = ninactiveperms;
+   (*entry)->norbits = norbits;
+   (*entry)->orbitssize = norbits > 0 ? orbitbegins[norbits] : 0;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*entry)->inactiveperms, MAX(ninactiveperms, 1)) );
+   k = 0;
+   for (p = 0; p < propdata->nperms; ++p)
+   {
+      if ( inactiveperms[p] )
+         (*entry)->inactiveperms[k++] = p;
+   }
+   assert( k == ninactiveperms );
+
+   (*entry)->orbits = NULL;
+   (*entry)->orbitbegins = NULL;
+   (*entry)->orbitsettled = NULL;
+   if ( norbits > 0 )
+   {
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*entry)->orbits, orbits, (*entry)->orbitssize) );
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*entry)->orbitbegins, orbitbegins, norbits + 1) );
+      SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &(*entry)->orbitsettled, norbits) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
 /** frees symmetry data */
 static
 SCIP_RETCODE freeSymmetryData(
@@ -1000,6 +1229,8 @@ SCIP_RETCODE freeSymmetryData(
    }
 
    /* other data */
+   freeOrbitCacheEntries(scip, propdata, 0);
+   SCIPfreeBlockMemoryArrayNull(scip, &propdata->orbitcache, MAXORBITCACHEENTRIES);
    SCIPfreeBlockMemoryArrayNull(scip, &propdata->inactiveperms, propdata->nperms);
 
    /* free permstrans matrix*/
@@ -1516,10 +1747,54 @@ SCIP_RETCODE collectCoefficients(
 }
 
 
+/** computes a signature of a (permuted) row of the matrix
+ *
+ *  The signature depends on the sense of the row, its number of entries and the set of its variables, but not on the
+ *  order of the entries or the coefficients. Thus, a row and its image under a symmetry have the same signature.
+ */
+static
+uint64_t getRowSignature(
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
+   int*                  rhsmatbeg,          /**< map from rows to first entry in matcoef array */
+   int*                  perm,               /**< permutation applied to the variables of the row, or NULL */
+   int                   row                 /**< index of row */
+   )
+{
+   uint64_t signature = 0;
+   uint64_t h;
+   int j;
+
+   assert( matrixdata != NULL );
+   assert( rhsmatbeg != NULL );
+   assert( 0 <= row && row < matrixdata->nrhscoef );
+   assert( 0 <= rhsmatbeg[row] && rhsmatbeg[row] < matrixdata->nmatcoef ); /* note: row cannot be empty by construction */
+
+   for (j = rhsmatbeg[row]; j < matrixdata->nmatcoef && matrixdata->matrhsidx[j] == row; ++j)
+   {
+      int varidx;
+
+      varidx = perm == NULL ? matrixdata->matvaridx[j] : perm[matrixdata->matvaridx[j]];
+
+      /* mix the variable index, the entries are combined by a sum to be independent of their order */
+      h = ((uint64_t) varidx + 1) * 0x9E3779B97F4A7C15ULL;
+      h ^= h >> 29;
+      signature += h;
+   }
+
+   signature ^= ((uint64_t) (j - rhsmatbeg[row])) * 0xC2B2AE3D27D4EB4FULL;
+   signature ^= ((uint64_t) matrixdata->rhssense[row] + 1) * 0x165667B19E3779F9ULL;
+
+   return signature;
+}
+
+
 /** checks whether given permutations form a symmetry of a MIP
  *
  *  We need the matrix and rhs in the original order in order to speed up the comparison process. The matrix is needed
  *  in the right order to easily check rows. The rhs is used because of cache effects.
+ *
+ *  If @p issymmetry is NULL, a permutation that is not a symmetry is an error. Otherwise, the result of the check is
+ *  stored for each permutation.
  */
 static
 SCIP_RETCODE checkSymmetriesAreSymmetries(
@@ -1527,7 +1802,8 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
    SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
    int                   nperms,             /**< number of permutations */
-   int**                 perms               /**< permutations */
+   int**                 perms,              /**< permutations */
+   SCIP_Bool*            issymmetry          /**< array to store whether the permutations are symmetries, or NULL */
    )
 {
    SCIP_CONSHDLR* conshdlr;
@@ -1535,7 +1811,9 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    SCIP_VAR** occuringvars;
    SCIP_Real* permrow = 0;
    SCIP_Bool success;
+   uint64_t* rowsignatures;
    int* rhsmatbeg = 0;
+   int* sortedrows;
    int nconss;
    int noccuringvars;
    int oldrhs;
@@ -1576,6 +1854,14 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
       }
    }
 
+   /* index the rows by their signatures, such that the candidate images of a permuted row are found by binary search
+    * instead of by a scan over all rows */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &rowsignatures, matrixdata->nrhscoef) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &sortedrows, matrixdata->nrhscoef) );
+   for (j = 0; j < matrixdata->nrhscoef; ++j)
+      rowsignatures[j] = getRowSignature(matrixdata, rhsmatbeg, NULL, j);
+   SCIPsort(sortedrows, SYMsortRowSignatures, (void*) rowsignatures, matrixdata->nrhscoef);
+
    /* create row */
    for (j = 0; j < matrixdata->npermvars; ++j)
       permrow[j] = 0.0;
@@ -1583,6 +1869,7 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    /* check all generators */
    for (p = 0; p < nperms; ++p)
    {
+      SCIP_Bool valid = TRUE;
       int* P;
       int r1;
       int r2;
@@ -1591,21 +1878,35 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
       P = perms[p];
       assert( P != NULL );
 
-      for (j = 0; j < matrixdata->npermvars; ++j)
+      for (j = 0; j < matrixdata->npermvars && valid; ++j)
       {
          if ( SymmetryFixVar(fixedtype, matrixdata->permvars[j]) && P[j] != j )
          {
             SCIPdebugMsg(scip, "Permutation does not fix types %u, moving variable %d.\n", fixedtype, j);
-            return SCIP_ERROR;
+            valid = FALSE;
+         }
+         else if ( matrixdata->permvarcolors[j] != matrixdata->permvarcolors[P[j]] )
+         {
+            SCIPdebugMsg(scip, "Permutation maps variable %d to variable %d of different type.\n", j, P[j]);
+            valid = FALSE;
          }
       }
 
+      if ( ! valid )
+      {
+         if ( issymmetry == NULL )
+            return SCIP_ERROR;
+
+         issymmetry[p] = FALSE;
+         continue;
+      }
+
       /*
        *  linear part
        */
 
       /* check all linear constraints == rhs */
-      for (r1 = 0; r1 < matrixdata->nrhscoef; ++r1)
+      for (r1 = 0; r1 < matrixdata->nrhscoef && valid; ++r1)
       {
          int npermuted = 0;
 
@@ -1632,10 +1933,30 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
          /* if row is not affected by permutation, we do not have to check it */
          if ( npermuted > 0 )
          {
-            /* check other rows (sparse) */
+            /* check other rows with the same signature (sparse) */
             SCIP_Bool found = FALSE;
-            for (r2 = 0; r2 < matrixdata->nrhscoef; ++r2)
+            uint64_t signature;
+            int lb = 0;
+            int ub = matrixdata->nrhscoef;
+            int pos;
+
+            signature = getRowSignature(matrixdata, rhsmatbeg, P, r1);
+
+            /* find the first row whose signature is not smaller than the signature of the permuted row */
+            while ( lb < ub )
+            {
+               int mid = lb + (ub - lb) / 2;
+
+               if ( rowsignatures[sortedrows[mid]] < signature )
+                  lb = mid + 1;
+               else
+                  ub = mid;
+            }
+
+            for (pos = lb; pos < matrixdata->nrhscoef && rowsignatures[sortedrows[pos]] == signature; ++pos)
             {
+               r2 = sortedrows[pos];
+
                /* a permutation must map constraints of the same type and respect rhs coefficients */
                if ( matrixdata->rhssense[r1] == matrixdata->rhssense[r2] && SCIPisEQ(scip, matrixdata->rhscoef[r1], matrixdata->rhscoef[r2]) )
                {
@@ -1658,12 +1979,9 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
                }
             }
 
-            assert( found );
+            assert( found || issymmetry != NULL );
             if ( ! found ) /*lint !e774*/
-            {
-               SCIPerrorMessage("Found permutation that is not a symmetry.\n");
-               return SCIP_ERROR;
-            }
+               valid = FALSE;
          }
 
          /* reset permrow */
@@ -1681,6 +1999,18 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
        *  non-linear part
        */
 
+      if ( ! valid )
+      {
+         if ( issymmetry == NULL )
+         {
+            SCIPerrorMessage("Found permutation that is not a symmetry.\n");
+            return SCIP_ERROR;
+         }
+
+         issymmetry[p] = FALSE;
+         continue;
+      }
+
       SCIPdebugMsg(scip, "Verifying automorphism group generator #%d for non-linear part ...\n", p);
 
       /* fill hashmap according to permutation */
@@ -1690,7 +2020,7 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
       }
 
       /* check all non-linear constraints */
-      for (i = 0; i < nconss; ++i)
+      for (i = 0; i < nconss && valid; ++i)
       {
          SCIP_CONS* cons1;
          SCIP_Bool permuted = FALSE;
@@ -1756,21 +2086,29 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
             SCIP_CALL( SCIPreleaseExpr(scip, &permutedexpr) );
             SCIP_CALL( SCIPreleaseCons(scip, &permutedcons) );
 
-            assert( found );
+            assert( found || issymmetry != NULL );
             if( !found ) /*lint !e774*/
-            {
-               SCIPerrorMessage("Found permutation that is not a symmetry.\n");
-               return SCIP_ERROR;
-            }
+               valid = FALSE;
          }
       }
 
       /* reset varmap */
       SCIP_CALL( SCIPhashmapRemoveAll(varmap) );
+
+      if ( ! valid && issymmetry == NULL )
+      {
+         SCIPerrorMessage("Found permutation that is not a symmetry.\n");
+         return SCIP_ERROR;
+      }
+
+      if ( issymmetry != NULL )
+         issymmetry[p] = valid;
    }
 
    SCIPhashmapFree(&varmap);
    SCIPfreeBufferArray(scip, &occuringvars);
+   SCIPfreeBlockMemoryArray(scip, &sortedrows, matrixdata->nrhscoef);
+   SCIPfreeBlockMemoryArray(scip, &rowsignatures, matrixdata->nrhscoef);
    SCIPfreeBlockMemoryArray(scip, &rhsmatbeg, matrixdata->nrhscoef);
    SCIPfreeBlockMemoryArray(scip, &permrow, matrixdata->npermvars);
 
@@ -1881,27 +2219,34 @@ SCIP_RETCODE setSymmetryData(
 
       *nmovedvars = 0;
 
-      /* detect number of moved vars and label moved vars */
+      /* detect moved vars; the permutations are traversed row by row to access them sequentially */
       SCIP_CALL( SCIPallocBufferArray(scip, &labelmovedvars, nvars) );
       SCIP_CALL( SCIPallocBufferArray(scip, &labeltopermvaridx, nvars) );
       for (i = 0; i < nvars; ++i)
-      {
          labelmovedvars[i] = -1;
 
-         for (p = 0; p < nperms; ++p)
+      for (p = 0; p < nperms; ++p)
+      {
+         for (i = 0; i < nvars; ++i)
          {
             if ( perms[p][i] != i )
-            {
-               labeltopermvaridx[*nmovedvars] = i;
-               labelmovedvars[i] = (*nmovedvars)++;
-
-               if ( SCIPvarIsBinary(vars[i]) )
-                  ++nbinvarsaffected;
-               break;
-            }
+               labelmovedvars[i] = 0;
          }
       }
 
+      /* label moved vars */
+      for (i = 0; i < nvars; ++i)
+      {
+         if ( labelmovedvars[i] < 0 )
+            continue;
+
+         labeltopermvaridx[*nmovedvars] = i;
+         labelmovedvars[i] = (*nmovedvars)++;
+
+         if ( SCIPvarIsBinary(vars[i]) )
+            ++nbinvarsaffected;
+      }
+
       if ( nbinvarsaffected > 0 )
          *binvaraffected = TRUE;
 
@@ -1939,15 +2284,14 @@ SCIP_RETCODE setSymmetryData(
    }
    else
    {
-      /* detect whether binary variable is affected by symmetry and count number of binary permvars */
-      for (i = 0; i < nbinvars; ++i)
+      /* detect whether binary variable is affected by symmetry */
+      for (p = 0; p < nperms && ! *binvaraffected; ++p)
       {
-         for (p = 0; p < nperms && ! *binvaraffected; ++p)
+         for (i = 0; i < nbinvars; ++i)
          {
-            if ( perms[p][i] != i )
+            if ( perms[p][i] != i && SCIPvarIsBinary(vars[i]) )
             {
-               if ( SCIPvarIsBinary(vars[i]) )
-                  *binvaraffected = TRUE;
+               *binvaraffected = TRUE;
                break;
             }
          }
@@ -1958,81 +2302,292 @@ SCIP_RETCODE setSymmetryData(
 }
 
 
-/** computes symmetry group of a MIP */
+/** computes a hash of the colored matrix that determines the symmetry group
+ *
+ *  Only the structure of the matrix and the colors of variables, coefficients, and rows enter the hash, since the
+ *  symmetry graph does not depend on the actual values. Thus, changing objective coefficients or right-hand sides
+ *  keeps the hash as long as the same entries remain equal.
+ */
 static
-SCIP_RETCODE computeSymmetryGroup(
-   SCIP*                 scip,               /**< SCIP pointer */
-   SCIP_Bool             doubleequations,    /**< Double equations to positive/negative version? */
-   SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
-   SCIP_Real             compressthreshold,  /**< Compression is used if percentage of moved vars is at most the threshold. */
-   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
-   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
-   SCIP_Bool             local,              /**< Use local variable bounds? */
-   SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
-   SCIP_Bool             usecolumnsparsity,  /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
-   SCIP_CONSHDLR*        conshdlr_nonlinear, /**< Nonlinear constraint handler, if included */
-   int*                  npermvars,          /**< pointer to store number of variables for permutations */
-   int*                  nbinpermvars,       /**< pointer to store number of binary variables for permutations */
-   SCIP_VAR***           permvars,           /**< pointer to store variables on which permutations act */
-   int*                  nperms,             /**< pointer to store number of permutations */
-   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
-   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
-   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
-   int*                  nmovedvars,         /**< pointer to store number of moved vars */
-   SCIP_Bool**           isnonlinvar,        /**< pointer to store which variables appear nonlinearly */
-   SCIP_Bool*            binvaraffected,     /**< pointer to store wether a binary variable is affected by symmetry */
-   SCIP_Bool*            compressed,         /**< pointer to store whether compression has been performed */
-   SCIP_Bool*            success             /**< pointer to store whether symmetry computation was successful */
+uint64_t getSymmetryCacheKey(
+   SYM_MATRIXDATA*       matrixdata,         /**< matrix data */
+   int                   nvars,              /**< number of variables */
+   int                   maxgenerators       /**< maximal number of generators constructed (= 0 if unlimited) */
    )
 {
-   SCIP_CONSHDLR* conshdlr;
-   SYM_MATRIXDATA matrixdata;
-   SYM_EXPRDATA exprdata;
-   SCIP_HASHTABLE* vartypemap;
-   SCIP_VAR** consvars;
-   SCIP_Real* consvals;
-   SCIP_CONS** conss;
-   SCIP_VAR** vars;
-   SCIP_EXPRITER* it = NULL;
-   SCIP_HASHSET* auxvars = NULL;
-   SYM_VARTYPE* uniquevararray;
-   SYM_RHSSENSE oldsense = SYM_SENSE_UNKOWN;
-   SYM_SORTRHSTYPE sortrhstype;
-   SCIP_Real oldcoef = SCIP_INVALID;
-   SCIP_Real val;
-   int* nconssforvar = NULL;
-   int nuniquevararray = 0;
-   int nhandleconss;
-   int nactiveconss;
-   int nnlconss;
-   int nconss;
-   int nvars;
-   int nbinvars;
-   int nvarsorig;
-   int nallvars;
-   int c;
+   uint64_t hash = 0xCBF29CE484222325ULL;
    int j;
 
-   assert( scip != NULL );
-   assert( npermvars != NULL );
-   assert( nbinpermvars != NULL );
-   assert( permvars != NULL );
-   assert( nperms != NULL );
-   assert( nmaxperms != NULL );
-   assert( perms != NULL );
-   assert( log10groupsize != NULL );
-   assert( binvaraffected != NULL );
-   assert( compressed != NULL );
-   assert( success != NULL );
-   assert( isnonlinvar != NULL );
-   assert( SYMcanComputeSymmetry() );
+   assert( matrixdata != NULL );
 
-   /* init */
-   *npermvars = 0;
-   *nbinpermvars = 0;
-   *permvars = NULL;
-   *nperms = 0;
-   *nmaxperms = 0;
+#define SYMCACHEHASH(x) hash = (hash ^ (uint64_t) (unsigned int) (x)) * 0x100000001B3ULL
+
+   SYMCACHEHASH(nvars);
+   SYMCACHEHASH(maxgenerators);
+   SYMCACHEHASH(matrixdata->nrhscoef);
+   SYMCACHEHASH(matrixdata->nmatcoef);
+
+   for (j = 0; j < nvars; ++j)
+      SYMCACHEHASH(matrixdata->permvarcolors[j]);
+
+   for (j = 0; j < matrixdata->nrhscoef; ++j)
+   {
+      SYMCACHEHASH(matrixdata->rhssense[j]);
+      SYMCACHEHASH(matrixdata->rhscoefcolors[j]);
+   }
+
+   for (j = 0; j < matrixdata->nmatcoef; ++j)
+   {
+      SYMCACHEHASH(matrixdata->matrhsidx[j]);
+      SYMCACHEHASH(matrixdata->matvaridx[j]);
+      SYMCACHEHASH(matrixdata->matcoefcolors[j]);
+   }
+
+#undef SYMCACHEHASH
+
+   return hash;
+}
+
+
+/** reads generators from the symmetry cache file if they have been stored for the same key */
+static
+SCIP_RETCODE readSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   const char*           cachefile,          /**< name of cache file */
+   uint64_t              key,                /**< key of the colored matrix */
+   int                   nvars,              /**< number of variables */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x nvars) matrix */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   SCIP_Bool*            found               /**< pointer to store whether the generators have been found in the cache */
+   )
+{
+   FILE* file;
+   uint64_t header[2];
+   SCIP_Real groupsize;
+   SCIP_Bool* isimage;
+   int sizes[2];
+   int p;
+   int j;
+
+   assert( scip != NULL );
+   assert( cachefile != NULL );
+   assert( nperms != NULL );
+   assert( nmaxperms != NULL );
+   assert( perms != NULL );
+   assert( log10groupsize != NULL );
+   assert( found != NULL );
+
+   *found = FALSE;
+
+   file = fopen(cachefile, "rb");
+   if ( file == NULL )
+      return SCIP_OKAY;
+
+   /* check header: magic number, key, number of variables and number of generators */
+   if ( fread(header, sizeof(uint64_t), 2, file) != 2 || header[0] != SYMCACHEMAGIC || header[1] != key
+      || fread(sizes, sizeof(int), 2, file) != 2 || sizes[0] != nvars || sizes[1] <= 0
+      || fread(&groupsize, sizeof(SCIP_Real), 1, file) != 1 )
+   {
+      (void) fclose(file);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &isimage, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, perms, sizes[1]) );
+   for (p = 0; p < sizes[1]; ++p)
+   {
+      SCIP_Bool valid;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*perms)[p], nvars) );
+
+      valid = fread((*perms)[p], sizeof(int), (size_t) nvars, file) == (size_t) nvars;
+
+      /* each generator has to be a bijection on 0..nvars-1 */
+      for (j = 0; j < nvars; ++j)
+         isimage[j] = FALSE;
+      for (j = 0; j < nvars && valid; ++j)
+      {
+         int img;
+
+         img = (*perms)[p][j];
+         valid = 0 <= img && img < nvars && ! isimage[img];
+         if ( valid )
+            isimage[img] = TRUE;
+      }
+
+      /* discard a truncated or corrupted cache */
+      if ( ! valid )
+      {
+         for (j = p; j >= 0; --j)
+            SCIPfreeBlockMemoryArray(scip, &(*perms)[j], nvars);
+         SCIPfreeBlockMemoryArray(scip, perms, sizes[1]);
+         SCIPfreeBufferArray(scip, &isimage);
+         (void) fclose(file);
+
+         SCIPwarningMessage(scip, "Ignoring corrupted symmetry cache <%s>.\n", cachefile);
+         return SCIP_OKAY;
+      }
+   }
+   SCIPfreeBufferArray(scip, &isimage);
+   (void) fclose(file);
+
+   *nperms = sizes[1];
+   *nmaxperms = sizes[1];
+   *log10groupsize = groupsize;
+   *found = TRUE;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   read %d generators from symmetry cache <%s>\n", *nperms, cachefile);
+
+   return SCIP_OKAY;
+}
+
+
+/** writes generators to the symmetry cache file
+ *
+ *  The generators are written to a temporary file in the same directory, which then replaces the cache file. Thus,
+ *  a crash or a concurrent writer never leaves a partially written cache file behind.
+ */
+static
+SCIP_RETCODE writeSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   const char*           cachefile,          /**< name of cache file */
+   uint64_t              key,                /**< key of the colored matrix */
+   int                   nvars,              /**< number of variables */
+   int                   nperms,             /**< number of permutations */
+   int**                 perms,              /**< permutation generators as (nperms x nvars) matrix */
+   SCIP_Real             log10groupsize      /**< log10 of size of group */
+   )
+{
+   FILE* file;
+   char tmpfile[SCIP_MAXSTRLEN];
+   uint64_t header[2];
+   int sizes[2];
+   SCIP_Bool success;
+   int p;
+
+   assert( scip != NULL );
+   assert( cachefile != NULL );
+   assert( nperms > 0 );
+   assert( perms != NULL );
+
+   /* the process id and the SCIP instance make the name unique among processes and among threads */
+   if ( SCIPsnprintf(tmpfile, SCIP_MAXSTRLEN, "%s.%d.%p.tmp", cachefile, (int) SYMCACHEGETPID(), (void*) scip)
+      >= SCIP_MAXSTRLEN - 1 )
+   {
+      SCIPwarningMessage(scip, "Name of symmetry cache <%s> is too long.\n", cachefile);
+      return SCIP_OKAY;
+   }
+
+   file = fopen(tmpfile, "wb");
+   if ( file == NULL )
+   {
+      SCIPwarningMessage(scip, "Could not open symmetry cache <%s> for writing.\n", tmpfile);
+      return SCIP_OKAY;
+   }
+
+   header[0] = SYMCACHEMAGIC;
+   header[1] = key;
+   sizes[0] = nvars;
+   sizes[1] = nperms;
+
+   success = fwrite(header, sizeof(uint64_t), 2, file) == 2 && fwrite(sizes, sizeof(int), 2, file) == 2
+      && fwrite(&log10groupsize, sizeof(SCIP_Real), 1, file) == 1;
+   for (p = 0; p < nperms && success; ++p)
+      success = fwrite(perms[p], sizeof(int), (size_t) nvars, file) == (size_t) nvars;
+
+   if ( fclose(file) != 0 || ! success || rename(tmpfile, cachefile) != 0 )
+   {
+      /* do not leave a truncated cache behind */
+      (void) remove(tmpfile);
+      SCIPwarningMessage(scip, "Could not write symmetry cache <%s>.\n", cachefile);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** computes symmetry group of a MIP */
+static
+SCIP_RETCODE computeSymmetryGroup(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_Bool             doubleequations,    /**< Double equations to positive/negative version? */
+   SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
+   SCIP_Real             compressthreshold,  /**< Compression is used if percentage of moved vars is at most the threshold. */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   SCIP_Bool             local,              /**< Use local variable bounds? */
+   SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
+   const char*           cachefile,          /**< file in which generators are cached across runs ("-" = no cache) */
+   SCIP_Bool             usecolumnsparsity,  /**< Should the number of conss a variable is contained in be exploited in symmetry detection? */
+   SCIP_CONSHDLR*        conshdlr_nonlinear, /**< Nonlinear constraint handler, if included */
+   int**                 prevperms,          /**< generators of a previous run to verify instead of computing symmetries, or NULL;
+                                              *   the generators that are kept are moved to perms and set to NULL */
+   int                   nprevperms,         /**< number of generators of a previous run */
+   SCIP_Real             prevlog10groupsize, /**< log10 of size of group generated by the generators of a previous run */
+   int*                  npermvars,          /**< pointer to store number of variables for permutations */
+   int*                  nbinpermvars,       /**< pointer to store number of binary variables for permutations */
+   SCIP_VAR***           permvars,           /**< pointer to store variables on which permutations act */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations (needed for freeing storage) */
+   int***                perms,              /**< pointer to store permutation generators as (nperms x npermvars) matrix */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   int*                  nmovedvars,         /**< pointer to store number of moved vars */
+   SCIP_Bool**           isnonlinvar,        /**< pointer to store which variables appear nonlinearly */
+   SCIP_Bool*            binvaraffected,     /**< pointer to store wether a binary variable is affected by symmetry */
+   SCIP_Bool*            compressed,         /**< pointer to store whether compression has been performed */
+   SCIP_Bool*            success             /**< pointer to store whether symmetry computation was successful */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   SYM_MATRIXDATA matrixdata;
+   SYM_EXPRDATA exprdata;
+   SCIP_HASHTABLE* vartypemap;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   SCIP_EXPRITER* it = NULL;
+   SCIP_HASHSET* auxvars = NULL;
+   SYM_VARTYPE* uniquevararray;
+   SYM_RHSSENSE oldsense = SYM_SENSE_UNKOWN;
+   SYM_SORTRHSTYPE sortrhstype;
+   SCIP_Real oldcoef = SCIP_INVALID;
+   SCIP_Real val;
+   int* nconssforvar = NULL;
+   int nuniquevararray = 0;
+   int nhandleconss;
+   int nactiveconss;
+   int nnlconss;
+   int nconss;
+   int nvars;
+   int nbinvars;
+   int nvarsorig;
+   int nallvars;
+   int c;
+   int j;
+
+   assert( scip != NULL );
+   assert( npermvars != NULL );
+   assert( nbinpermvars != NULL );
+   assert( permvars != NULL );
+   assert( nperms != NULL );
+   assert( nmaxperms != NULL );
+   assert( perms != NULL );
+   assert( log10groupsize != NULL );
+   assert( binvaraffected != NULL );
+   assert( compressed != NULL );
+   assert( success != NULL );
+   assert( isnonlinvar != NULL );
+   assert( SYMcanComputeSymmetry() );
+
+   /* init */
+   *npermvars = 0;
+   *nbinpermvars = 0;
+   *permvars = NULL;
+   *nperms = 0;
+   *nmaxperms = 0;
    *perms = NULL;
    *log10groupsize = 0;
    *nmovedvars = -1;
@@ -2711,15 +3266,100 @@ SCIP_RETCODE computeSymmetryGroup(
    /* do not compute symmetry if all variables are non-equivalent (unique) or if all matrix coefficients are different */
    if ( matrixdata.nuniquevars < nvars && (matrixdata.nuniquemat == 0 || matrixdata.nuniquemat < matrixdata.nmatcoef) )
    {
+      SCIP_Bool usecache;
+      SCIP_Bool cached = FALSE;
+      uint64_t cachekey = 0;
+
+      /* the cache only covers the linear part, since expressions do not enter the key */
+      usecache = prevperms == NULL && cachefile != NULL && strcmp(cachefile, "-") != 0 && nnlconss == 0;
+      if ( usecache )
+      {
+         cachekey = getSymmetryCacheKey(&matrixdata, nvars, maxgenerators);
+         SCIP_CALL( readSymmetryCache(scip, cachefile, cachekey, nvars, nperms, nmaxperms, perms, log10groupsize, &cached) );
+      }
+
+      /* the key might collide or the cache might be stale, so the cached generators are always checked */
+      if ( cached )
+      {
+         SCIP_Bool* issymmetry;
+         SCIP_Bool allsymmetries = TRUE;
+         int p;
+
+         SCIP_CALL( SCIPallocBufferArray(scip, &issymmetry, *nperms) );
+         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, *nperms, *perms, issymmetry) );
+         for (p = 0; p < *nperms && allsymmetries; ++p)
+            allsymmetries = issymmetry[p];
+         SCIPfreeBufferArray(scip, &issymmetry);
+
+         if ( ! allsymmetries )
+         {
+            for (p = *nperms - 1; p >= 0; --p)
+            {
+               SCIPfreeBlockMemoryArray(scip, &(*perms)[p], nvars);
+            }
+            SCIPfreeBlockMemoryArray(scip, perms, *nmaxperms);
+            *nperms = 0;
+            *nmaxperms = 0;
+            *log10groupsize = 0.0;
+            cached = FALSE;
+
+            SCIPwarningMessage(scip, "Ignoring symmetry cache <%s>, since it does not match the problem.\n", cachefile);
+         }
+      }
+
+      /* keep the generators of a previous run that are still symmetries */
+      if ( prevperms != NULL )
+      {
+         SCIP_Bool* issymmetry;
+         int p;
+
+         assert( nprevperms > 0 );
+
+         SCIP_CALL( SCIPallocBufferArray(scip, &issymmetry, nprevperms) );
+         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, nprevperms, prevperms, issymmetry) );
+
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, perms, nprevperms) );
+         *nmaxperms = nprevperms;
+         *nperms = 0;
+         for (p = 0; p < nprevperms; ++p)
+         {
+            if ( issymmetry[p] )
+            {
+               (*perms)[(*nperms)++] = prevperms[p];
+               prevperms[p] = NULL;
+            }
+         }
+         SCIPfreeBufferArray(scip, &issymmetry);
+
+         if ( *nperms == 0 )
+         {
+            SCIPfreeBlockMemoryArray(scip, perms, nprevperms);
+            *nmaxperms = 0;
+         }
+
+         /* the size of the group is only known if no generator has been dropped */
+         *log10groupsize = *nperms == nprevperms ? prevlog10groupsize : -1.0;
+
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) kept %d of %d generators of the previous run\n",
+            SCIPgetSolvingTime(scip), *nperms, nprevperms);
+      }
       /* determine generators */
-      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, &matrixdata, &exprdata, nperms, nmaxperms,
-            perms, log10groupsize) );
+      else if ( ! cached )
+      {
+         SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, &matrixdata, &exprdata, nperms, nmaxperms,
+               perms, log10groupsize) );
+
+         if ( usecache && *nperms > 0 )
+         {
+            SCIP_CALL( writeSymmetryCache(scip, cachefile, cachekey, nvars, *nperms, *perms, *log10groupsize) );
+         }
+      }
       assert( *nperms <= *nmaxperms );
 
       /* SCIPisStopped() might call SCIPgetGap() which is only available after initpresolve */
-      if ( checksymmetries && SCIPgetStage(scip) > SCIP_STAGE_INITPRESOLVE && ! SCIPisStopped(scip) )
+      if ( checksymmetries && prevperms == NULL && SCIPgetStage(scip) > SCIP_STAGE_INITPRESOLVE && ! SCIPisStopped(scip) )
       {
-         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, *nperms, *perms) );
+         SCIP_CALL( checkSymmetriesAreSymmetries(scip, fixedtype, &matrixdata, *nperms, *perms, NULL) );
       }
 
       if ( *nperms > 0 )
@@ -2773,6 +3413,129 @@ SCIP_RETCODE computeSymmetryGroup(
 }
 
 
+/** maps the generators of the previous run to the active variables after a restart
+ *
+ *  Generators that move a variable that is not active anymore, e.g., because it has been fixed or aggregated in
+ *  presolving, are dropped. The remaining generators are returned as permutations of the active variables. Variables
+ *  are only compared by their addresses, since inactive variables might have been freed already.
+ */
+static
+SCIP_RETCODE getRestartGenerators(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int***                prevperms,          /**< pointer to store generators as (nprevperms x nvars) matrix, or NULL */
+   int*                  nprevperms          /**< pointer to store number of generators */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** vars;
+   int* permvaridx;
+   int nvars;
+   int p;
+   int i;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( prevperms != NULL );
+   assert( nprevperms != NULL );
+
+   *prevperms = NULL;
+   *nprevperms = 0;
+
+   /* the generators are only available if symmetry handling constraints have been used */
+   if ( propdata->nperms <= 0 || propdata->perms == NULL )
+      return SCIP_OKAY;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   if ( nvars <= 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nvars) );
+   for (i = 0; i < nvars; ++i)
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*) vars[i], i) );
+   }
+
+   /* map previous variables to active variables (-1 if not active anymore) */
+   SCIP_CALL( SCIPallocBufferArray(scip, &permvaridx, propdata->npermvars) );
+   for (i = 0; i < propdata->npermvars; ++i)
+   {
+      if ( SCIPhashmapExists(varmap, (void*) propdata->permvars[i]) )
+         permvaridx[i] = SCIPhashmapGetImageInt(varmap, (void*) propdata->permvars[i]);
+      else
+         permvaridx[i] = -1;
+   }
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, prevperms, propdata->nperms) );
+   for (p = 0; p < propdata->nperms; ++p)
+   {
+      int* perm;
+
+      perm = propdata->perms[p];
+      for (i = 0; i < propdata->npermvars; ++i)
+      {
+         if ( perm[i] != i && (permvaridx[i] < 0 || permvaridx[perm[i]] < 0) )
+            break;
+      }
+
+      /* skip generators that move removed variables */
+      if ( i < propdata->npermvars )
+         continue;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*prevperms)[*nprevperms], nvars) );
+      for (i = 0; i < nvars; ++i)
+         (*prevperms)[*nprevperms][i] = i;
+      for (i = 0; i < propdata->npermvars; ++i)
+      {
+         if ( permvaridx[i] >= 0 )
+            (*prevperms)[*nprevperms][permvaridx[i]] = permvaridx[perm[i]];
+      }
+      ++(*nprevperms);
+   }
+
+   SCIPfreeBufferArray(scip, &permvaridx);
+   SCIPhashmapFree(&varmap);
+
+   /* shrink to the kept generators */
+   if ( *nprevperms == 0 )
+   {
+      SCIPfreeBlockMemoryArray(scip, prevperms, propdata->nperms);
+   }
+   else
+   {
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, prevperms, propdata->nperms, *nprevperms) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** frees generators of the previous run that have not been reused */
+static
+void freeRestartGenerators(
+   SCIP*                 scip,               /**< SCIP instance */
+   int***                prevperms,          /**< pointer to generators of the previous run */
+   int                   nprevperms,         /**< number of generators of the previous run */
+   int                   nvars               /**< number of variables the generators act on */
+   )
+{
+   int p;
+
+   assert( scip != NULL );
+   assert( prevperms != NULL );
+
+   if ( *prevperms == NULL )
+      return;
+
+   for (p = 0; p < nprevperms; ++p)
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &(*prevperms)[p], nvars);
+   }
+   SCIPfreeBlockMemoryArray(scip, prevperms, nprevperms);
+}
+
+
 /** determines symmetry */
 static
 SCIP_RETCODE determineSymmetry(
@@ -2783,6 +3546,9 @@ SCIP_RETCODE determineSymmetry(
    )
 { /*lint --e{641}*/
    SCIP_Bool successful;
+   SCIP_Real prevlog10groupsize = -1.0;
+   int** prevperms = NULL;
+   int nprevperms = 0;
    int maxgenerators;
    int nhandleconss;
    int nconss;
@@ -2905,8 +3671,16 @@ SCIP_RETCODE determineSymmetry(
 
    /* if a restart occured, possibly prepare symmetry data to be recomputed */
    if ( SCIPgetNRuns(scip) > propdata->lastrestart && (propdata->recomputerestart == SCIP_RECOMPUTESYM_ALWAYS ||
-         (propdata->recomputerestart == SCIP_RECOMPUTESYM_OFFOUNDRED && propdata->offoundreduction)) )
+         (propdata->recomputerestart == SCIP_RECOMPUTESYM_OFFOUNDRED && propdata->offoundreduction) ||
+         propdata->recomputerestart == SYM_RECOMPUTESYM_INCREMENTAL) )
    {
+      /* keep the previous generators to only verify them instead of calling the symmetry detector again */
+      if ( propdata->recomputerestart == SYM_RECOMPUTESYM_INCREMENTAL )
+      {
+         SCIP_CALL( getRestartGenerators(scip, propdata, &prevperms, &nprevperms) );
+         prevlog10groupsize = propdata->log10groupsize;
+      }
+
       /* reset symmetry information */
       SCIP_CALL( delSymConss(scip, propdata) );
       SCIP_CALL( freeSymmetryData(scip, propdata) );
@@ -2928,6 +3702,8 @@ SCIP_RETCODE determineSymmetry(
          "   (%.1fs) symmetry computation skipped: there exist constraints that cannot be handled by symmetry methods.\n",
          SCIPgetSolvingTime(scip));
 
+      freeRestartGenerators(scip, &prevperms, nprevperms, nvars);
+
       propdata->ofenabled = FALSE;
       propdata->symconsenabled = FALSE;
       propdata->sstenabled = FALSE;
@@ -2965,11 +3741,14 @@ SCIP_RETCODE determineSymmetry(
 
    /* actually compute (global) symmetry */
    SCIP_CALL( computeSymmetryGroup(scip, propdata->doubleequations, propdata->compresssymmetries, propdata->compressthreshold,
-	 maxgenerators, symspecrequirefixed, FALSE, propdata->checksymmetries, propdata->usecolumnsparsity, propdata->conshdlr_nonlinear,
+	 maxgenerators, symspecrequirefixed, FALSE, propdata->checksymmetries, propdata->cachefile, propdata->usecolumnsparsity, propdata->conshdlr_nonlinear,
+         prevperms, nprevperms, prevlog10groupsize,
          &propdata->npermvars, &propdata->nbinpermvars, &propdata->permvars, &propdata->nperms, &propdata->nmaxperms,
          &propdata->perms, &propdata->log10groupsize, &propdata->nmovedvars, &propdata->isnonlinvar,
          &propdata->binvaraffected, &propdata->compressed, &successful) );
 
+   freeRestartGenerators(scip, &prevperms, nprevperms, nvars);
+
    /* mark that we have computed the symmetry group */
    propdata->computedsymmetry = TRUE;
 
@@ -3013,7 +3792,10 @@ SCIP_RETCODE determineSymmetry(
       SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "%d", maxgenerators);
 
    /* display statistics: log10 group size, number of affected vars*/
-   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, ", log10 of symmetry group size: %.1f", propdata->log10groupsize);
+   if ( propdata->log10groupsize < 0.0 )
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, ", log10 of symmetry group size: unknown");
+   else
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, ", log10 of symmetry group size: %.1f", propdata->log10groupsize);
 
    if ( propdata->displaynorbitvars )
    {
@@ -3246,23 +4028,351 @@ SCIP_RETCODE determineSymmetry(
       }
    }
 
-   /* free original perms matrix if no symmetry constraints are added */
-   if ( ! propdata->symconsenabled && ! propdata->sstenabled )
+   /* free original perms matrix if no symmetry constraints are added */
+   if ( ! propdata->symconsenabled && ! propdata->sstenabled )
+   {
+      for (p = 0; p < propdata->nperms; ++p)
+      {
+         SCIPfreeBlockMemoryArray(scip, &(propdata->perms)[p], propdata->npermvars);
+      }
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->perms, propdata->nmaxperms);
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Functions for symmetry constraints
+ */
+
+
+/** creates the 2-cycle index of the generators of a symmetry component
+ *
+ *  A generator that is not an involution gets no 2-cycles, i.e., it is treated in the same way as by
+ *  SCIPisInvolutionPerm().
+ */
+static
+SCIP_RETCODE createTwoCycleIndex(
+   SCIP*                 scip,               /**< SCIP instance */
+   int**                 perms,              /**< array of all permutations of the symmetry group */
+   SCIP_VAR**            permvars,           /**< array of all permutation variables */
+   int                   npermvars,          /**< number of permutation variables */
+   int*                  compperms,          /**< indices of the generators of the component in perms */
+   int                   ncompperms,         /**< number of generators of the component */
+   SCIP_Bool             buildvarperms,      /**< whether the generators moving each variable should be listed */
+   SYM_TWOCYCLEINDEX*    twocycleindex       /**< index to initialize */
+   )
+{
+   int maxncycles;
+   int ncycles = 0;
+   int p;
+   int k;
+
+   assert( scip != NULL );
+   assert( perms != NULL );
+   assert( permvars != NULL );
+   assert( npermvars > 0 );
+   assert( compperms != NULL );
+   assert( ncompperms > 0 );
+   assert( twocycleindex != NULL );
+
+   twocycleindex->nperms = ncompperms;
+   twocycleindex->npermvars = npermvars;
+   twocycleindex->varperms = NULL;
+   twocycleindex->varpermbegins = NULL;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &twocycleindex->cyclebegins, ncompperms + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &twocycleindex->ntwocycles, ncompperms) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &twocycleindex->nbincycles, ncompperms) );
+
+   maxncycles = npermvars / 2 + 1;
+   SCIP_CALL( SCIPallocBufferArray(scip, &twocycleindex->cycles, maxncycles) );
+
+   for (p = 0; p < ncompperms; ++p)
+   {
+      int* perm;
+      int nbincycles = 0;
+
+      perm = perms[compperms[p]];
+      twocycleindex->cyclebegins[p] = ncycles;
+
+      for (k = 0; k < npermvars; ++k)
+      {
+         int img;
+
+         img = perm[k];
+
+         /* skip fixed points and treat each 2-cycle only once */
+         if ( img <= k )
+            continue;
+
+         /* drop the 2-cycles of generators that are no involutions */
+         if ( perm[img] != k )
+         {
+            ncycles = twocycleindex->cyclebegins[p];
+            nbincycles = 0;
+            break;
+         }
+
+         if ( ncycles >= maxncycles )
+         {
+            maxncycles = SCIPcalcMemGrowSize(scip, ncycles + 1);
+            SCIP_CALL( SCIPreallocBufferArray(scip, &twocycleindex->cycles, maxncycles) );
+         }
+         twocycleindex->cycles[ncycles++] = k;
+
+         if ( SCIPvarIsBinary(permvars[k]) )
+            ++nbincycles;
+      }
+
+      twocycleindex->ntwocycles[p] = ncycles - twocycleindex->cyclebegins[p];
+      twocycleindex->nbincycles[p] = nbincycles;
+   }
+   twocycleindex->cyclebegins[ncompperms] = ncycles;
+
+   if ( ! buildvarperms )
+      return SCIP_OKAY;
+
+   /* list the generators moving each variable by counting sort */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &twocycleindex->varpermbegins, npermvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &twocycleindex->varperms, MAX(2 * ncycles, 1)) );
+
+   for (p = 0; p < ncompperms; ++p)
+   {
+      for (k = twocycleindex->cyclebegins[p]; k < twocycleindex->cyclebegins[p + 1]; ++k)
+      {
+         ++twocycleindex->varpermbegins[twocycleindex->cycles[k] + 1];
+         ++twocycleindex->varpermbegins[perms[compperms[p]][twocycleindex->cycles[k]] + 1];
+      }
+   }
+   for (k = 0; k < npermvars; ++k)
+      twocycleindex->varpermbegins[k + 1] += twocycleindex->varpermbegins[k];
+   assert( twocycleindex->varpermbegins[npermvars] == 2 * ncycles );
+
+   /* fill the list, temporarily using varpermbegins[v] as the next free position of variable v - 1 */
+   for (p = 0; p < ncompperms; ++p)
+   {
+      for (k = twocycleindex->cyclebegins[p]; k < twocycleindex->cyclebegins[p + 1]; ++k)
+      {
+         int var;
+
+         var = twocycleindex->cycles[k];
+         twocycleindex->varperms[twocycleindex->varpermbegins[var]++] = p;
+         var = perms[compperms[p]][var];
+         twocycleindex->varperms[twocycleindex->varpermbegins[var]++] = p;
+      }
+   }
+
+   /* restore the begin positions */
+   for (k = npermvars; k > 0; --k)
+      twocycleindex->varpermbegins[k] = twocycleindex->varpermbegins[k - 1];
+   twocycleindex->varpermbegins[0] = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the 2-cycle index of the generators of a symmetry component */
+static
+void freeTwoCycleIndex(
+   SCIP*                 scip,               /**< SCIP instance */
+   SYM_TWOCYCLEINDEX*    twocycleindex       /**< index to free */
+   )
+{
+   assert( scip != NULL );
+   assert( twocycleindex != NULL );
+
+   SCIPfreeBufferArrayNull(scip, &twocycleindex->varperms);
+   SCIPfreeBufferArrayNull(scip, &twocycleindex->varpermbegins);
+   SCIPfreeBufferArray(scip, &twocycleindex->cycles);
+   SCIPfreeBufferArray(scip, &twocycleindex->nbincycles);
+   SCIPfreeBufferArray(scip, &twocycleindex->ntwocycles);
+   SCIPfreeBufferArray(scip, &twocycleindex->cyclebegins);
+}
+
+
+/** checks whether the generators of a component form an orbitope and if so, builds its sorted variable matrix
+ *
+ *  All generators of the component have to consist of @p nrows 2-cycles. The first generator defines the rows and the
+ *  first two columns. Each further column is found by a generator that moves a variable of an already known column:
+ *  it has to map this column, row by row, to variables that are not part of the orbitope so far. Since every
+ *  generator is reached once via the index of the generators moving each variable, the matrix is built in time
+ *  linear in the size of the 2-cycles. The generators thus have the shape of a tree of column transpositions, which
+ *  generates the symmetric group on the columns.
+ *
+ *  The binary rows are sorted increasingly w.r.t. their minimum variable index and the columns are sorted such that
+ *  the first row is sorted increasingly w.r.t. variable indices, to ensure that the same orbitope is found for
+ *  different sets of generators.
+ *
+ *  @pre @p vars has to be an initialized matrix of size @p nbinrows x (number of generators + 1)
+ */
+static
+SCIP_RETCODE buildComponentOrbitope(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_VAR**            permvars,           /**< array of all permutation variables */
+   int                   npermvars,          /**< number of permutation variables */
+   int**                 perms,              /**< array of all permutations of the symmetry group */
+   int*                  compperms,          /**< indices of the generators of the component in perms */
+   SYM_TWOCYCLEINDEX*    twocycleindex,      /**< 2-cycle index of the component, including the generators per variable */
+   int                   nrows,              /**< number of 2-cycles of each generator */
+   int                   nbinrows,           /**< number of 2-cycles on binary variables of each generator */
+   SCIP_VAR***           vars,               /**< matrix to store the sorted binary rows of the orbitope */
+   SCIP_Bool*            isorbitope          /**< pointer to store whether the generators form an orbitope */
+   )
+{
+   SCIP_Shortbool* permdone;
+   SCIP_Shortbool* isplaced;
+   int* matrix;
+   int* binrows;
+   int* rowmin;
+   int* colorder;
+   int* firstrow;
+   int* perm;
+   int nperms;
+   int ncols;
+   int nfilledcols;
+   int ndoneperms;
+   int col;
+   int r;
+   int c;
+
+   assert( scip != NULL );
+   assert( permvars != NULL );
+   assert( perms != NULL );
+   assert( compperms != NULL );
+   assert( twocycleindex != NULL );
+   assert( twocycleindex->varperms != NULL );
+   assert( nrows > 0 );
+   assert( 0 < nbinrows && nbinrows <= nrows );
+   assert( vars != NULL );
+   assert( isorbitope != NULL );
+
+   *isorbitope = FALSE;
+
+   nperms = twocycleindex->nperms;
+   ncols = nperms + 1;
+   assert( twocycleindex->ntwocycles[0] == nrows );
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &isplaced, npermvars) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &permdone, nperms) );
+
+   /* variable matrix, stored column by column */
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, nrows * ncols) );
+
+   /* the first generator defines the rows and the first two columns */
+   perm = perms[compperms[0]];
+   for (r = 0; r < nrows; ++r)
+   {
+      int var;
+
+      var = twocycleindex->cycles[twocycleindex->cyclebegins[0] + r];
+      matrix[r] = var;
+      matrix[nrows + r] = perm[var];
+      isplaced[var] = TRUE;
+      isplaced[perm[var]] = TRUE;
+   }
+   permdone[0] = TRUE;
+   ndoneperms = 1;
+   nfilledcols = 2;
+
+   /* attach the remaining generators via the variables of the columns found so far */
+   for (col = 0; col < nfilledcols && ndoneperms < nperms; ++col)
+   {
+      for (r = 0; r < nrows; ++r)
+      {
+         int var;
+         int v;
+
+         var = matrix[col * nrows + r];
+
+         for (v = twocycleindex->varpermbegins[var]; v < twocycleindex->varpermbegins[var + 1]; ++v)
+         {
+            int p;
+            int i;
+
+            p = twocycleindex->varperms[v];
+            if ( permdone[p] )
+               continue;
+
+            permdone[p] = TRUE;
+            ++ndoneperms;
+            assert( nfilledcols < ncols );
+
+            /* the generator has nrows 2-cycles, so it is a column transposition iff it maps column col to new variables */
+            perm = perms[compperms[p]];
+            for (i = 0; i < nrows; ++i)
+            {
+               int img;
+
+               img = perm[matrix[col * nrows + i]];
+               if ( isplaced[img] )
+                  goto FREEDATASTRUCTURES;
+
+               matrix[nfilledcols * nrows + i] = img;
+               isplaced[img] = TRUE;
+            }
+            ++nfilledcols;
+         }
+      }
+   }
+
+   /* every generator has to contribute a column */
+   if ( ndoneperms < nperms )
+      goto FREEDATASTRUCTURES;
+   assert( nfilledcols == ncols );
+
+   *isorbitope = TRUE;
+
+   /* sort the binary rows increasingly w.r.t. their minimum variable index */
+   SCIP_CALL( SCIPallocBufferArray(scip, &binrows, nbinrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowmin, nbinrows) );
+   c = 0;
+   for (r = 0; r < nrows; ++r)
+   {
+      if ( ! SCIPvarIsBinary(permvars[matrix[r]]) )
+         continue;
+
+      assert( c < nbinrows );
+      binrows[c] = r;
+      rowmin[c] = INT_MAX;
+      for (col = 0; col < ncols; ++col)
+      {
+         if ( matrix[col * nrows + r] < rowmin[c] )
+            rowmin[c] = matrix[col * nrows + r];
+      }
+      ++c;
+   }
+   assert( c == nbinrows );
+   SCIPsortIntInt(rowmin, binrows, nbinrows);
+
+   /* sort the columns increasingly w.r.t. the variable indices of the first row */
+   SCIP_CALL( SCIPallocBufferArray(scip, &colorder, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &firstrow, ncols) );
+   for (col = 0; col < ncols; ++col)
+   {
+      firstrow[col] = matrix[col * nrows + binrows[0]];
+      colorder[col] = col;
+   }
+   SCIPsortIntInt(firstrow, colorder, ncols);
+
+   for (r = 0; r < nbinrows; ++r)
    {
-      for (p = 0; p < propdata->nperms; ++p)
-      {
-         SCIPfreeBlockMemoryArray(scip, &(propdata->perms)[p], propdata->npermvars);
-      }
-      SCIPfreeBlockMemoryArrayNull(scip, &propdata->perms, propdata->nmaxperms);
+      for (col = 0; col < ncols; ++col)
+         vars[r][col] = permvars[matrix[colorder[col] * nrows + binrows[r]]];
    }
 
-   return SCIP_OKAY;
-}
+   SCIPfreeBufferArray(scip, &firstrow);
+   SCIPfreeBufferArray(scip, &colorder);
+   SCIPfreeBufferArray(scip, &rowmin);
+   SCIPfreeBufferArray(scip, &binrows);
 
+   FREEDATASTRUCTURES:
+   SCIPfreeBufferArray(scip, &matrix);
+   SCIPfreeBufferArray(scip, &permdone);
+   SCIPfreeBufferArray(scip, &isplaced);
 
-/*
- * Functions for symmetry constraints
- */
+   return SCIP_OKAY;
+}
 
 
 /** Checks whether given set of 2-cycle permutations forms an orbitope and if so, builds the variable index matrix.
@@ -3468,12 +4578,11 @@ SCIP_RETCODE chooseOrderOfGenerators(
    SCIP*                 scip,               /**< SCIP instance */
    SCIP_PROPDATA*        propdata,           /**< pointer to data of symmetry propagator */
    int                   compidx,            /**< index of component */
+   SYM_TWOCYCLEINDEX*    twocycleindex,      /**< 2-cycle index of the component */
    int**                 genorder,           /**< (initialized) buffer to store the resulting order of generator */
    int*                  ntwocycleperms      /**< pointer to store the number of 2-cycle permutations in component compidx */
    )
 {
-   int** perms;
-   int* components;
    int* componentbegins;
    int* ntwocycles;
    int npermvars;
@@ -3484,6 +4593,7 @@ SCIP_RETCODE chooseOrderOfGenerators(
    assert( propdata != NULL );
    assert( compidx >= 0 );
    assert( compidx < propdata->ncomponents );
+   assert( twocycleindex != NULL );
    assert( genorder != NULL );
    assert( *genorder != NULL );
    assert( ntwocycleperms != NULL );
@@ -3495,23 +4605,17 @@ SCIP_RETCODE chooseOrderOfGenerators(
    assert( propdata->components != NULL );
    assert( propdata->componentbegins != NULL );
 
-   perms = propdata->perms;
    npermvars = propdata->npermvars;
-   components = propdata->components;
    componentbegins = propdata->componentbegins;
    npermsincomp = componentbegins[compidx + 1] - componentbegins[compidx];
    *ntwocycleperms = npermsincomp;
+   assert( twocycleindex->nperms == npermsincomp );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &ntwocycles, npermsincomp) );
 
    for (i = 0; i < npermsincomp; ++i)
    {
-      int* perm;
-      int nbincycles;
-
-      perm = perms[components[componentbegins[compidx] + i]];
-
-      SCIP_CALL( SCIPisInvolutionPerm(perm, propdata->permvars, npermvars, &(ntwocycles[i]), &nbincycles, FALSE) );
+      ntwocycles[i] = twocycleindex->ntwocycles[i];
 
       /* we skip permutations which do not purely consist of 2-cycles */
       if ( ntwocycles[i] == 0 )
@@ -3548,6 +4652,7 @@ SCIP_RETCODE buildSubgroupGraph(
    int*                  genorder,           /**< order in which the generators should be considered */
    int                   ntwocycleperms,     /**< number of 2-cycle permutations in this component */
    int                   compidx,            /**< index of the component */
+   SYM_TWOCYCLEINDEX*    twocycleindex,      /**< 2-cycle index of the component */
    int**                 graphcomponents,    /**< buffer to store the components of the graph (ordered var indices) */
    int**                 graphcompbegins,    /**< buffer to store the indices of each new graph component */
    int**                 compcolorbegins,    /**< buffer to store at which indices a new color begins */
@@ -3572,6 +4677,7 @@ SCIP_RETCODE buildSubgroupGraph(
    int nextcomp;
    int j;
    int k;
+   int c;
 
    assert( scip != NULL );
    assert( propdata != NULL );
@@ -3581,6 +4687,7 @@ SCIP_RETCODE buildSubgroupGraph(
    assert( ngraphcomponents != NULL );
    assert( ncompcolors != NULL );
    assert( genorder != NULL );
+   assert( twocycleindex != NULL );
    assert( usedperms != NULL );
    assert( nusedperms != NULL );
    assert( usedpermssize > 0 );
@@ -3616,13 +4723,17 @@ SCIP_RETCODE buildSubgroupGraph(
    {
       int* perm;
       int firstcolor = -1;
+      int cyclesbegin;
+      int cyclesend;
 
       /* use given order of generators */
       perm = perms[components[componentbegins[compidx] + genorder[j]]];
       assert( perm != NULL );
+      cyclesbegin = twocycleindex->cyclebegins[genorder[j]];
+      cyclesend = twocycleindex->cyclebegins[genorder[j] + 1];
 
       /* iteratively handle each swap of perm until an invalid one is found or all edges have been added */
-      for (k = 0; k < npermvars; ++k)
+      for (c = cyclesbegin; c < cyclesend; ++c)
       {
          int comp1;
          int comp2;
@@ -3630,12 +4741,11 @@ SCIP_RETCODE buildSubgroupGraph(
          int color2;
          int img;
 
+         k = twocycleindex->cycles[c];
          img = perm[k];
+         assert( img > k );
          assert( perm[img] == k );
 
-         if ( img <= k )
-            continue;
-
          comp1 = SCIPdisjointsetFind(vartocomponent, k);
          comp2 = SCIPdisjointsetFind(vartocomponent, img);
 
@@ -3672,7 +4782,7 @@ SCIP_RETCODE buildSubgroupGraph(
       }
 
       /* if the generator is invalid, delete the newly added edges, go to next generator */
-      if ( k < npermvars )
+      if ( c < cyclesend )
          continue;
 
       /* if the generator only acts on already existing components, we don't have to store it */
@@ -3696,7 +4806,7 @@ SCIP_RETCODE buildSubgroupGraph(
       permused[genorder[j]] = TRUE;
 
       /* if the generator can be added, update the datastructures for graph components and colors */
-      for (k = 0; k < npermvars; ++k)
+      for (c = cyclesbegin; c < cyclesend; ++c)
       {
          int comp1;
          int comp2;
@@ -3704,11 +4814,8 @@ SCIP_RETCODE buildSubgroupGraph(
          int color2;
          int img;
 
+         k = twocycleindex->cycles[c];
          img = perm[k];
-         assert( perm[img] == k );
-
-         if ( img <= k )
-            continue;
 
          comp1 = SCIPdisjointsetFind(vartocomponent, k);
          comp2 = SCIPdisjointsetFind(vartocomponent, img);
@@ -4444,72 +5551,241 @@ SCIP_RETCODE adaptSymmetryDataSST(
    return SCIP_OKAY;
 }
 
-/* Sorting function for symretope sorting */
-struct symretopeSortPermutationsData
-{
-   int* permsmaxcyclesize;
-   int* permsorder;
-};
-
+/** sorts indices stably by non-increasing non-negative integer keys, using a radix sort on bytes
+ *
+ *  The key of index @p indices[i] is @p keys[indices[i]]. Since the keys are cycle lengths and group orders, both
+ *  bounded by the number of variables in practice, usually only one or two counting passes are needed.
+ */
 static
-SCIP_DECL_SORTINDCOMP(symretopeSortPermutations)
+SCIP_RETCODE sortIndicesDownRadix(
+   SCIP*                 scip,               /**< SCIP instance */
+   const int*            keys,               /**< keys of the indices */
+   int*                  indices,            /**< indices to be sorted */
+   int                   nindices            /**< number of indices */
+)
 {
-   struct symretopeSortPermutationsData* data;
-   data = dataptr;
+   int counts[256];
+   int* tmpindices;
+   int* source;
+   int* target;
+   int* swap;
+   int maxkey = 0;
+   int shift;
+   int i;
+   int b;
 
-   if ( data->permsmaxcyclesize[ind1] < data->permsmaxcyclesize[ind2] )
-      return 1;
-   else if ( data->permsmaxcyclesize[ind1] > data->permsmaxcyclesize[ind2] )
-      return -1;
-   else
+   assert( scip != NULL );
+   assert( keys != NULL );
+   assert( indices != NULL || nindices == 0 );
+
+   for (i = 0; i < nindices; ++i)
    {
-      if ( data->permsorder[ind1] < data->permsorder[ind2] )
-         return 1;
-      else if ( data->permsorder[ind1] > data->permsorder[ind2] )
-         return -1;
+      assert( keys[indices[i]] >= 0 );
+      maxkey = MAX(maxkey, keys[indices[i]]);
    }
-   return 0;
+
+   if ( maxkey == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &tmpindices, nindices) );
+   source = indices;
+   target = tmpindices;
+
+   for (shift = 0; shift < 32 && (maxkey >> shift) > 0; shift += 8)
+   {
+      int pos = 0;
+
+      /* count the keys per byte, in reversed byte order to sort non-increasingly */
+      BMSclearMemoryArray(counts, 256);
+      for (i = 0; i < nindices; ++i)
+         ++counts[255 - ((keys[source[i]] >> shift) & 255)];
+
+      for (b = 0; b < 256; ++b)
+      {
+         int cnt = counts[b];
+
+         counts[b] = pos;
+         pos += cnt;
+      }
+
+      for (i = 0; i < nindices; ++i)
+         target[counts[255 - ((keys[source[i]] >> shift) & 255)]++] = source[i];
+
+      swap = source;
+      source = target;
+      target = swap;
+   }
+
+   if ( source != indices )
+   {
+      BMScopyMemoryArray(indices, source, nindices);
+   }
+
+   SCIPfreeBufferArray(scip, &tmpindices);
+
+   return SCIP_OKAY;
 }
 
+/** group elements of a symmetry component, as a sequence of the generators followed by products of generators
+ *
+ *  Only the generators are stored as permutation arrays. A product is stored as the pair of generators it is
+ *  composed of, and it is only materialized by getGroupElement() when it is needed.
+ */
+struct SYM_Groupelements
+{
+   int**                 generators;         /**< generators w.r.t. original variable ordering (not owned) */
+   int                   ngenerators;        /**< number of generators */
+   int                   npermvars;          /**< number of variables in the permutations */
+   int*                  factors;            /**< for the j-th product the generators (2j, 2j+1), i.e., perm = factors[2j] * factors[2j+1] */
+   int                   nelements;          /**< number of group elements, i.e., generators and products */
+};
+typedef struct SYM_Groupelements SYM_GROUPELEMENTS;
+
+
+/** create the group elements of a set of generators
+ *
+ *  If @p maxnelements exceeds the number of generators, then products of pairs of overlapping generators are added,
+ *  until the total number of elements reaches @p maxnelements.
+ */
 static
-SCIP_DECL_SORTINDCOMP(symretopeSortPermutationDecreasingCycleSize)
+SCIP_RETCODE createGroupElements(
+   SCIP*                 scip,               /**< SCIP instance */
+   int**                 generators,         /**< generators w.r.t. original variable ordering */
+   int                   ngenerators,        /**< number of generators */
+   int                   npermvars,          /**< number of variables in the permutations */
+   int                   maxnelements,       /**< maximal number of group elements */
+   SYM_GROUPELEMENTS**   gelems              /**< pointer to store the group elements */
+)
 {
-   int* data;
-   data = dataptr;
+   int* supports;
+   int* thissupport;
+   int factorssize;
+   int i;
+   int j;
+   int k;
 
-   if ( data[ind1] < data[ind2] )
-      return 1;
-   else if ( data[ind1] > data[ind2] )
-      return -1;
-   return 0;
+   assert( scip != NULL );
+   assert( generators != NULL || ngenerators == 0 );
+   assert( gelems != NULL );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, gelems) );
+   (*gelems)->generators = generators;
+   (*gelems)->ngenerators = ngenerators;
+   (*gelems)->npermvars = npermvars;
+   (*gelems)->factors = NULL;
+   (*gelems)->nelements = ngenerators;
+
+   if ( ngenerators <= 1 || maxnelements <= ngenerators )
+      return SCIP_OKAY;
+
+   /* for each generator, get the (sorted) indices in the support, terminated by -1 */
+   SCIP_CALL( SCIPallocBufferArray(scip, &supports, ngenerators * npermvars) );
+   for (k = 0; k < ngenerators; ++k)
+   {
+      thissupport = &supports[k * npermvars];
+
+      j = 0;
+      for (i = 0; i < npermvars; ++i)
+      {
+         if ( generators[k][i] != i )
+            thissupport[j++] = i;
+      }
+      for (; j < npermvars; ++j)
+         thissupport[j] = -1;
+   }
+
+   /* for each pair of overlapping generators, add their product */
+   factorssize = 0;
+   for (i = 0; i < ngenerators && (*gelems)->nelements < maxnelements; ++i)
+   {
+      for (j = i + 1; j < ngenerators && (*gelems)->nelements < maxnelements; ++j)
+      {
+         int nproducts;
+
+         if ( ! checkSortedArraysIntHaveOverlappingEntryNulTermSymbol(&supports[i * npermvars], npermvars,
+               &supports[j * npermvars], npermvars, -1, sortByIntValue) )
+            continue;
+
+         nproducts = (*gelems)->nelements - ngenerators;
+         if ( 2 * nproducts + 2 > factorssize )
+         {
+            int newsize;
+
+            newsize = SCIPcalcMemGrowSize(scip, 2 * nproducts + 2);
+            assert( newsize >= 2 * nproducts + 2 );
+
+            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*gelems)->factors, factorssize, newsize) );
+            factorssize = newsize;
+         }
+
+         (*gelems)->factors[2 * nproducts] = i;
+         (*gelems)->factors[2 * nproducts + 1] = j;
+         ++(*gelems)->nelements;
+      }
+   }
+
+   /* shrink the array of factors to its actual size */
+   if ( factorssize != 2 * ((*gelems)->nelements - ngenerators) )
+   {
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*gelems)->factors, factorssize,
+            2 * ((*gelems)->nelements - ngenerators)) );
+   }
+
+   SCIPfreeBufferArray(scip, &supports);
+
+   return SCIP_OKAY;
 }
 
+
+/** free the group elements */
 static
-SCIP_DECL_SORTINDCOMP(symretopeSortPermutationIncreasingCycleSize)
+void freeGroupElements(
+   SCIP*                 scip,               /**< SCIP instance */
+   SYM_GROUPELEMENTS**   gelems              /**< pointer to the group elements */
+)
 {
-   int* data;
-   data = dataptr;
+   assert( scip != NULL );
+   assert( gelems != NULL );
+   assert( *gelems != NULL );
 
-   if ( data[ind1] < data[ind2] )
-      return -1;
-   else if ( data[ind1] > data[ind2] )
-      return 1;
-   return 0;
+   SCIPfreeBlockMemoryArrayNull(scip, &(*gelems)->factors, 2 * ((*gelems)->nelements - (*gelems)->ngenerators));
+   SCIPfreeBlockMemory(scip, gelems);
 }
 
+
+/** get a group element as permutation array w.r.t. original variable ordering
+ *
+ *  Generators are returned directly, products are materialized in @p buffer.
+ */
 static
-SCIP_DECL_SORTINDCOMP(symretopeSortPermutationIncreasingSubcycleMinIndex)
+int* getGroupElement(
+   SYM_GROUPELEMENTS*    gelems,             /**< the group elements */
+   int                   e,                  /**< index of the group element */
+   int*                  buffer              /**< memory of length npermvars to materialize products in */
+)
 {
-   int** cycles;
-   cycles = dataptr;
+   int* gamma;
+   int* delta;
+   int k;
 
-   if ( cycles[ind1][0] > cycles[ind2][0] )
-      return 1;
-   else if ( cycles[ind1][0] < cycles[ind2][0] )
-      return -1;
-   return 0;
+   assert( gelems != NULL );
+   assert( 0 <= e && e < gelems->nelements );
+   assert( buffer != NULL );
+
+   if ( e < gelems->ngenerators )
+      return gelems->generators[e];
+
+   /* compute image of k on gamma * delta */
+   e -= gelems->ngenerators;
+   gamma = gelems->generators[gelems->factors[2 * e]];
+   delta = gelems->generators[gelems->factors[2 * e + 1]];
+   for (k = 0; k < gelems->npermvars; ++k)
+      buffer[k] = gamma[delta[k]];
+
+   return buffer;
 }
 
+
 /* The symretope propagator can compute the complete set of fixings for cyclic groups that are monotone and ordered.
  * I.e. the generating permutation is monotone (having exactly 1 descend point per disjoint cycle),
  * and the generating permutation is ordered (the disjoint cycles of this permutation are ordered).
@@ -4524,6 +5800,11 @@ SCIP_DECL_SORTINDCOMP(symretopeSortPermutationIncreasingSubcycleMinIndex)
  * 2. Maintain partial ordering of indices (initialized empty). This is a dense graph with an arc (i, j) if i < j.
  *    Iteratively: Try to add permutation as monotone and ordered, respecting the partial ordering.
  *
+ * Only the keys of the sorting (maximal cycle length and order) are stored per permutation. The cycles of a
+ * permutation are walked again, into scratch arrays of size O(nvars), when the permutation is considered for the
+ * ordering, such that the memory does not depend on the number of group elements. All sorting is done by radix sorts
+ * on the integer keys.
+ *
  * Note: We do this in an heuristic manner, and the relabeling that we find is highly dependent on the order in which
  * the permutations are processed.
  */
@@ -4531,12 +5812,13 @@ static
 SCIP_RETCODE adaptSymmetryDataSymretope(
    SCIP*                 scip,               /**< SCIP instance */
    int                   relabelsymretopes,  /**< variant of variable relabeling should be applied, from SCIP_RELABEL */
-   int**                 perms,              /**< permutation matrix w.r.t. original variable ordering */
-   int                   nperms,             /**< number of permutations */
+   SYM_GROUPELEMENTS*    gelems,             /**< group elements, w.r.t. original variable ordering */
    int                   nvars,              /**< length or modifiedpermvars array */
    int*                  topoorder           /**< where to store the new ordering. */
 )
 {
+   int* permbuffer;
+   int nperms;
    int i;
    int j;
    int k;
@@ -4548,20 +5830,22 @@ SCIP_RETCODE adaptSymmetryDataSymretope(
    #ifndef NDEBUG
    int npermsorderedmonotone = 0;
    #endif
-   int ind;
    int* perm;
    int* permsmaxcyclesize;
    int* permsorder;
-   struct symretopeSortPermutationsData* sortingdata;
    int* sortedpermsindices;
-   int* checked;
-   int order;
+   SCIP_Bool* checked;
+   SCIP_Longint order;
    int maxcyclesize;
    int thiscyclesize;
-   SCIP_PERMUTATION* permutation;
-   int cyclen;
+   int* cyclebegins;
+   int* cycleentries;
+   int ncycles;
+   int nentries;
+   int* cyclekeys;
    int* sortedcycles;
    int* cycle;
+   int cyclen;
    SCIP_Bool* iscontainedinpartialorder;
    SCIP_Bool orderingpossible;
    int* partialorder;
@@ -4575,27 +5859,34 @@ SCIP_RETCODE adaptSymmetryDataSymretope(
    }
 
    /* Relabeling should be applied. */
-   SCIP_CALL( SCIPallocBufferArray(scip, &sortedpermsindices, nperms) );
-   SCIP_CALL( SCIPallocBuffer(scip, &permutation) );
+   assert( gelems != NULL );
+   nperms = gelems->nelements;
+   SCIP_CALL( SCIPallocBufferArray(scip, &permbuffer, nvars) );
 
-   /* Allocation for sorting permutations */
    SCIP_CALL( SCIPallocBufferArray(scip, &permsmaxcyclesize, nperms) );
    SCIP_CALL( SCIPallocBufferArray(scip, &permsorder, nperms) );
-   SCIP_CALL( SCIPallocBuffer(scip, &sortingdata) );
 
-   /* For every permutation: compute the order and maximal cycle length */
+   /* Scratch arrays for the cycles of a single permutation: the entries of cycle c are
+    * cycleentries[cyclebegins[c]], ..., cycleentries[cyclebegins[c+1] - 1]. As every non-trivial cycle has at least
+    * two entries, there are at most nvars / 2 cycles.
+    */
+   SCIP_CALL( SCIPallocBufferArray(scip, &cyclebegins, nvars / 2 + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cycleentries, nvars) );
    SCIP_CALL( SCIPallocCleanBufferArray(scip, &checked, nvars) );
+
+   /* For every permutation: compute the order and maximal cycle length in a single walk */
    for (k = 0; k < nperms; ++k)
    {
       order = 1;
       maxcyclesize = 0;
+      nentries = 0;
 
-      perm = perms[k];
+      perm = getGroupElement(gelems, k, permbuffer);
 
       for (i = 0; i < nvars; ++i)
       {
-         /* If this index is already processed, don't process. */
-         if( checked[i] )
+         /* If this index is already processed or fixed, don't process. */
+         if ( checked[i] || perm[i] == i )
             continue;
 
          j = i;
@@ -4603,129 +5894,142 @@ SCIP_RETCODE adaptSymmetryDataSymretope(
          do
          {
             checked[j] = TRUE;
+            cycleentries[nentries++] = j;
             j = perm[j];
             ++thiscyclesize;
          } while (j != i);
          assert( j == i );
 
-         order = lcm(order, thiscyclesize);
+         order = lcm(order, (SCIP_Longint) thiscyclesize);
+         if ( order > INT_MAX )
+            order = INT_MAX;
          maxcyclesize = MAX(maxcyclesize, thiscyclesize);
       }
 
       /* Store the maximal cycle length and the permutation order */
       permsmaxcyclesize[k] = maxcyclesize;
-      permsorder[k] = order;
+      permsorder[k] = (int) order;
 
-      /* Reset the checked-array. */
-      for (i = 0; i < nvars; ++i)
-      {
-         assert( checked[i] );
-         checked[i] = FALSE;
-      }
+      /* Reset the checked-array on the support only. */
+      for (j = 0; j < nentries; ++j)
+         checked[cycleentries[j]] = FALSE;
    }
-   SCIPfreeCleanBufferArray(scip, &checked);
 
-   /* Sort the permutations (1) by decreasing maximal cycle-length, and (2, tie-breaking) by generator order. */
+   /* Sort the permutations (1) by decreasing maximal cycle-length, and (2, tie-breaking) by generator order.
+    * As the radix sort is stable, we sort by the secondary key first.
+    */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortedpermsindices, nperms) );
    for (k = 0; k < nperms; ++k)
       sortedpermsindices[k] = k;
-   sortingdata->permsmaxcyclesize = permsmaxcyclesize;
-   sortingdata->permsorder = permsorder;
-   SCIPsort(sortedpermsindices, symretopeSortPermutations, (void*) sortingdata, nperms);
-   SCIPfreeBuffer(scip, &sortingdata);
-   SCIPfreeBufferArray(scip, &permsorder);
-   SCIPfreeBufferArray(scip, &permsmaxcyclesize);
+   SCIP_CALL( sortIndicesDownRadix(scip, permsorder, sortedpermsindices, nperms) );
+   SCIP_CALL( sortIndicesDownRadix(scip, permsmaxcyclesize, sortedpermsindices, nperms) );
 
    /* Make the partial ordering. */
    SCIP_CALL( SCIPallocBufferArray(scip, &partialorder, nvars) );
    SCIP_CALL( SCIPallocClearBufferArray(scip, &iscontainedinpartialorder, nvars) );
 
-   /* An array in which we sort the cycle indices.
-    * This array needs at most the number of cycles of a permutation. We allocate nvars, which is plenty of space. */
-   SCIP_CALL( SCIPallocBufferArray(scip, &sortedcycles, nvars) );
+   /* Arrays in which we sort the cycle indices of a permutation, which has at most nvars / 2 non-trivial cycles. */
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortedcycles, nvars / 2 + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cyclekeys, nvars / 2 + 1) );
 
    n = 0;
    for (k_ = 0; k_ < nperms; ++k_)
    {
-      k = sortedpermsindices[0];
-      perm = perms[k];
-      SCIP_CALL( SCIPgetPermutation(scip, perm, nvars, permutation) );
+      int npermcycles;
+
+      k = sortedpermsindices[k_];
+
+      /* Walk the non-trivial cycles of the permutation into the scratch arrays, in increasing order of their smallest
+       * index, since the smallest index of a cycle is the first one that is reached.
+       */
+      perm = getGroupElement(gelems, k, permbuffer);
+      ncycles = 0;
+      nentries = 0;
+      for (i = 0; i < nvars; ++i)
+      {
+         if ( checked[i] || perm[i] == i )
+            continue;
 
-      /* Make sure we can fit the cycle indices in sortedcycles, which has length nvars. */
-      assert(permutation->ncycles <= nvars);
+         cyclebegins[ncycles++] = nentries;
+         j = i;
+         do
+         {
+            checked[j] = TRUE;
+            cycleentries[nentries++] = j;
+            j = perm[j];
+         } while (j != i);
+      }
+      cyclebegins[ncycles] = nentries;
+      npermcycles = ncycles;
+      assert( npermcycles <= nvars / 2 );
+
+      for (j = 0; j < nentries; ++j)
+         checked[cycleentries[j]] = FALSE;
+
+      /* If there is a non-fixed entry that is already ordered, then we ignore this permutation.
+       *
+       * As part of the heuristic: We are interested in a set of disjoint permutations in the component.
+       * So, even though the labeling of two overlapping permutations may be compatable, we only relabel at most
+       * one of two overlapping permutations.
+       * A previous implementation encoded the partial ordering with a transitively closed graph representing the
+       * partial ordering, and added permutations one-by-one. This ensured that compatable permutations are both
+       * added. However, this is too computationally intensive, so we settle at adding non-overlapping
+       * permutations.
+       */
+      orderingpossible = TRUE;
+      for (j = 0; j < nentries; ++j)
+      {
+         if ( iscontainedinpartialorder[cycleentries[j]] )
+         {
+            orderingpossible = FALSE;
+            break;
+         }
+      }
+
+      /* If this permutation is not possible, then try the next permutation. */
+      if ( !orderingpossible )
+         continue;
 
       /* Sort the cycles by the specified sorted order */
+      for (c_ = 0; c_ < npermcycles; ++c_)
+         sortedcycles[c_] = c_;
+
       switch (relabelsymretopes)
       {
          case SCIP_RELABEL_DECREASINGCYCLESIZE:
             /* Sort cycles to be decreasing in cycle size. */
-            SCIPsort(sortedcycles, symretopeSortPermutationDecreasingCycleSize,
-               (void*) permutation->cyclelengths, permutation->ncycles);
+            for (c_ = 0; c_ < npermcycles; ++c_)
+               cyclekeys[c_] = cyclebegins[c_ + 1] - cyclebegins[c_];
+            SCIP_CALL( sortIndicesDownRadix(scip, cyclekeys, sortedcycles, npermcycles) );
             break;
          case SCIP_RELABEL_INCREASINGCYCLESIZE:
             /* Sort cycles to be increasing in cycle size. */
-            SCIPsort(sortedcycles, symretopeSortPermutationIncreasingCycleSize,
-               (void*) permutation->cyclelengths, permutation->ncycles);
+            for (c_ = 0; c_ < npermcycles; ++c_)
+               cyclekeys[c_] = permsmaxcyclesize[k] - (cyclebegins[c_ + 1] - cyclebegins[c_]);
+            SCIP_CALL( sortIndicesDownRadix(scip, cyclekeys, sortedcycles, npermcycles) );
             break;
          case SCIP_RELABEL_INCREASINGSUBCYCLEMININDEX:
             /* Sort subcycles by smallest original index in the subcycles.
-             * Note: The smallest original index of a cycle is always at the first position of the cycle,
-             * by the way the permutations are constructed.
+             * Note: The cycles are walked in increasing order of their smallest index already.
              */
-            SCIPsort(sortedcycles, symretopeSortPermutationIncreasingSubcycleMinIndex,
-               (void*) permutation->cycles, permutation->ncycles);
             break;
          default:
             /* This variant is not implemented. */
             assert( FALSE );
       }
 
-      /* Check if it is possible to add this permutation to the ordering. */
-      orderingpossible = TRUE;
-      for (c_ = 0; c_ < permutation->ncycles; ++c_)
-      {
-         c = sortedcycles[c_];
-         cycle = permutation->cycles[c];
-         cyclen = permutation->cyclelengths[c];
-         if ( cyclen <= 1 )
-            continue;
-
-         /* If there is a non-fixed entry that is already ordered, then we ignore this permutation. */
-         for (i = 0; i < cyclen; ++i)
-         {
-            /* As part of the heuristic: We are interested in a set of disjoint permutations in the component.
-             * So, even though the labeling of two overlapping permutations may be compatable, we only relabel at most
-             * one of two overlapping permutations.
-             * A previous implementation encoded the partial ordering with a transitively closed graph representing the
-             * partial ordering, and added permutations one-by-one. This ensured that compatable permutations are both
-             * added. However, this is too computationally intensive, so we settle at adding non-overlapping
-             * permutations.
-             */
-            if ( iscontainedinpartialorder[cycle[i]] )
-            {
-               orderingpossible = FALSE;
-               break;
-            }
-         }
-      }
-
-      /* If this permutation is not possible, then try the next permutation. */
-      if ( !orderingpossible )
-         goto CleanIteration;
-
-      for (c_ = 0; c_ < permutation->ncycles; ++c_)
+      for (c_ = 0; c_ < npermcycles; ++c_)
       {
          c = sortedcycles[c_];
-         cycle = permutation->cycles[c];
-         cyclen = permutation->cyclelengths[c];
-         if ( cyclen <= 1 )
-            continue;
+         cycle = &cycleentries[cyclebegins[c]];
+         cyclen = cyclebegins[c + 1] - cyclebegins[c];
+         assert( cyclen > 1 );
 
          for (i = 0; i < cyclen; ++i)
          {
-            ind = cycle[i];
-            partialorder[n++] = ind;
-            assert( !iscontainedinpartialorder[ind] );
-            iscontainedinpartialorder[ind] = TRUE;
+            partialorder[n++] = cycle[i];
+            assert( !iscontainedinpartialorder[cycle[i]] );
+            iscontainedinpartialorder[cycle[i]] = TRUE;
          }
       }
       assert( n <= nvars );
@@ -4733,10 +6037,8 @@ SCIP_RETCODE adaptSymmetryDataSymretope(
       #ifndef NDEBUG
       ++npermsorderedmonotone;
       #endif
-
-      CleanIteration:
-      SCIP_CALL( SCIPfreePermutationContents(scip, permutation, FALSE) );
    }
+   SCIPfreeBufferArray(scip, &cyclekeys);
    SCIPfreeBufferArray(scip, &sortedcycles);
    assert( n <= nvars );
 
@@ -4757,134 +6059,17 @@ SCIP_RETCODE adaptSymmetryDataSymretope(
    /* Free memory */
    SCIPfreeBufferArray(scip, &iscontainedinpartialorder);
    SCIPfreeBufferArray(scip, &partialorder);
-   SCIPfreeBuffer(scip, &permutation);
    SCIPfreeBufferArray(scip, &sortedpermsindices);
+   SCIPfreeCleanBufferArray(scip, &checked);
+   SCIPfreeBufferArray(scip, &cycleentries);
+   SCIPfreeBufferArray(scip, &cyclebegins);
+   SCIPfreeBufferArray(scip, &permsorder);
+   SCIPfreeBufferArray(scip, &permsmaxcyclesize);
+   SCIPfreeBufferArray(scip, &permbuffer);
 
    return SCIP_OKAY;
 }
 
-
-/* given a set of permutations and the number hereof (as a pointer value),
- * update this set of permutations with additional permutations.
- */
-static
-SCIP_RETCODE adaptSymmetryExtendGenerators(
-   SCIP*                 scip,               /**< SCIP instance */
-   int***                perms,              /**< pointer to permutation matrix w.r.t. original variable ordering */
-   int*                  nperms,             /**< pointer to number of permutations */
-   int                   npermvars,          /**< number of variables in the permutations */
-   int                   maxnperms           /**< maximal number of elements in 'perms' */
-)
-{
-   int i;
-   int j;
-   int k;
-   SCIP_PERMUTATION* initperms;
-   int ninitperms;
-   int* initpermsupports;
-   int permsmaxarraysize;
-
-   int* thisinitpermsupport;
-   SCIP_PERMUTATION* perm;
-   int* permarr;
-
-   if ( *nperms <= 1 )
-      return SCIP_OKAY;
-
-   /* get the initial permutations as a permutation-object. */
-   ninitperms = *nperms;
-   SCIP_CALL( SCIPallocBufferArray(scip, &initperms, ninitperms) );
-   for (k = 0; k < ninitperms; ++k)
-      SCIP_CALL( SCIPgetPermutation(scip, (*perms)[k], npermvars, &initperms[k]) );
-
-   /* for each permutation, get the indices in the support */
-   SCIP_CALL( SCIPallocBufferArray(scip, &initpermsupports, ninitperms * npermvars) );
-   for (k = 0; k < ninitperms; ++k)
-   {
-      perm = &initperms[k];
-      thisinitpermsupport = &initpermsupports[k * npermvars];
-
-      j = 0; /* the index of thisinitpermsupport */
-      /* if the cyclelength containing index i is at least 1, then it's in the support of the permutation perm */
-      for (i = 0; i < npermvars; ++i)
-      {
-         if ( perm->cyclelengths[perm->varcycle[i]] > 1 )
-            thisinitpermsupport[j++] = i;
-      }
-      /* mark remaining entries of support as -1 */
-      for (; j < npermvars; ++j)
-         thisinitpermsupport[j] = -1;
-   }
-
-   /* we re-allocate the perms array regularly, so keep track of the maximal size */
-   permsmaxarraysize = *nperms;
-
-   /* for each pair of non-overlapping indices, compute the product, and add to the list perms of permutations */
-   for (i = 0; i < ninitperms; ++i)
-   {
-      /* stop if we've reached the maximally desired number of permutations */
-      if ( *nperms >= maxnperms )
-         break;
-
-      for (j = i + 1; j < ninitperms; ++j)
-      {
-         /* stop if we've reached the maximally desired number of permutations */
-         if ( *nperms >= maxnperms )
-            break;
-
-         /* only compute the product if permutations i and j overlap */
-         if ( ! checkSortedArraysIntHaveOverlappingEntryNulTermSymbol(
-            &initpermsupports[i * npermvars], npermvars,
-            &initpermsupports[j * npermvars], npermvars, -1, sortByIntValue)
-         )
-            continue;
-
-         /* compute product, and insert to perms array. */
-         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &permarr, npermvars) );  /* Make sure that this gets freed!! */
-
-         for (k = 0; k < npermvars; ++k)
-         {
-            /* compute image of k on gamma * delta, where gamma is (*perms)[i] and delta is (*perms)[j] */
-            permarr[k] = ((*perms)[i])[((*perms)[j])[k]];
-         }
-
-         /* check whether we need to resize */
-         if ( *nperms >= permsmaxarraysize )
-         {
-            int newsize;
-
-            newsize = SCIPcalcMemGrowSize(scip, *nperms + 1);
-            assert( newsize > *nperms );
-
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, perms, permsmaxarraysize, newsize) );
-
-            permsmaxarraysize = newsize;
-         }
-
-         /* Insert permarr to perms array */
-         (*perms)[(*nperms)++] = permarr;
-      }
-   }
-
-   /* make sure that the array sizes match, so shrink the array */
-   if ( permsmaxarraysize != *nperms )
-   {
-      assert( permsmaxarraysize > *nperms );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, perms, permsmaxarraysize, *nperms) );
-      permsmaxarraysize = *nperms;
-   }
-
-   /* remove everything we need */
-   SCIPfreeBufferArray(scip, &initpermsupports);
-   for (k = ninitperms - 1; k >= 0; --k)
-      SCIP_CALL( SCIPfreePermutationContents(scip, &initperms[k], FALSE) );
-   assert( k == -1 );
-   SCIPfreeBufferArray(scip, &initperms);
-
-   return SCIP_OKAY;
-}
-
-
 /* returns the number of found orbitopes with at least three columns per graph component or 0
  * if the found orbitopes do not satisfor each pair of permutations, store the y certain criteria for being used
  */
@@ -5132,6 +6317,40 @@ SCIP_RETCODE addSymmetryBreakingConstraintSymretopeOrSymresack(
 
 
 
+/** allocates the memory for the permutations w.r.t. a new variable ordering, if this has not been done yet
+ *
+ *  The memory is only needed if the lexicographic order is adapted for some component, so it is not allocated upfront.
+ */
+static
+SCIP_RETCODE ensureModifiedPermsMemory(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_PROPDATA*        propdata,           /**< pointer to data of symmetry propagator */
+   int***                modifiedperms,      /**< pointer to the permutation matrix w.r.t. new variable ordering (or NULL) */
+   SCIP_VAR***           modifiedpermvars    /**< pointer to the permutation vars w.r.t. new variable ordering (or NULL) */
+   )
+{
+   int i;
+
+   assert( scip != NULL );
+   assert( propdata != NULL );
+   assert( modifiedperms != NULL );
+   assert( modifiedpermvars != NULL );
+   assert( (*modifiedperms == NULL) == (*modifiedpermvars == NULL) );
+
+   if ( *modifiedperms != NULL )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, modifiedperms, propdata->nperms) );
+   for (i = 0; i < propdata->nperms; ++i)
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*modifiedperms)[i], propdata->npermvars) );
+   }
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, modifiedpermvars, propdata->npermvars) );
+
+   return SCIP_OKAY;
+}
+
+
 /** checks whether subgroups of the components are symmetric groups and adds SBCs for them */
 static
 SCIP_RETCODE detectAndHandleSubgroups(
@@ -5146,8 +6365,8 @@ SCIP_RETCODE detectAndHandleSubgroups(
    int nstrongsbcs = 0;
    int nweaksbcs = 0;
 #endif
-   int** modifiedperms;
-   SCIP_VAR** modifiedpermvars;
+   int** modifiedperms = NULL;
+   SCIP_VAR** modifiedpermvars = NULL;
    int* nvarsincomponent;
 
    assert( scip != NULL );
@@ -5174,14 +6393,6 @@ SCIP_RETCODE detectAndHandleSubgroups(
    /* create array for permutation order */
    SCIP_CALL( SCIPallocBufferArray(scip, &genorder, propdata->nperms) );
 
-   /* create arrays for modified permutations in case we adapt the lexicographic order because of suborbitopes */
-   SCIP_CALL( SCIPallocBufferArray(scip, &modifiedperms, propdata->nperms) );
-   for (i = 0; i < propdata->nperms; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &modifiedperms[i], propdata->npermvars) );
-   }
-   SCIP_CALL( SCIPallocBufferArray(scip, &modifiedpermvars, propdata->npermvars) );
-
    SCIP_CALL( SCIPallocClearBufferArray(scip, &nvarsincomponent, propdata->npermvars) );
    for (i = 0; i < propdata->npermvars; ++i)
    {
@@ -5194,6 +6405,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
    /* iterate over components */
    for (i = 0; i < propdata->ncomponents; ++i)
    {
+      SYM_TWOCYCLEINDEX twocycleindex;
       int* graphcomponents;
       int* graphcompbegins;
       int* compcolorbegins;
@@ -5229,7 +6441,11 @@ SCIP_RETCODE detectAndHandleSubgroups(
       for (j = 0; j < npermsincomp; ++j)
          genorder[j] = j;
 
-      SCIP_CALL( chooseOrderOfGenerators(scip, propdata, i, &genorder, &ntwocycleperms) );
+      /* list the 2-cycles of the generators once, they are used for ordering them and for building the graph */
+      SCIP_CALL( createTwoCycleIndex(scip, propdata->perms, propdata->permvars, propdata->npermvars,
+            &(propdata->components[propdata->componentbegins[i]]), npermsincomp, FALSE, &twocycleindex) );
+
+      SCIP_CALL( chooseOrderOfGenerators(scip, propdata, i, &twocycleindex, &genorder, &ntwocycleperms) );
 
       assert( ntwocycleperms >= 0 );
       assert( ntwocycleperms <= npermsincomp );
@@ -5282,6 +6498,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
       if ( ntwocycleperms < 2 )
       {
          SCIPdebugMsg(scip, "  --> skip\n");
+         freeTwoCycleIndex(scip, &twocycleindex);
          continue;
       }
 
@@ -5289,7 +6506,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
       SCIP_CALL( SCIPallocBufferArray(scip, &usedperms, usedpermssize) );
       SCIP_CALL( SCIPallocClearBufferArray(scip, &permused, npermsincomp) );
 
-      SCIP_CALL( buildSubgroupGraph(scip, propdata, genorder, ntwocycleperms, i,
+      SCIP_CALL( buildSubgroupGraph(scip, propdata, genorder, ntwocycleperms, i, &twocycleindex,
             &graphcomponents, &graphcompbegins, &compcolorbegins, &ngraphcomponents,
             &ncompcolors, &usedperms, &nusedperms, usedpermssize, permused) );
 
@@ -5312,6 +6529,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
 
          SCIPfreeBufferArray(scip, &permused);
          SCIPfreeBufferArray(scip, &usedperms);
+         freeTwoCycleIndex(scip, &twocycleindex);
 
          continue;
       }
@@ -5330,6 +6548,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
       /* if there is just one orbitope satisfying the requirements, handle the full component by symresacks */
       if ( norbitopesincomp == 1 )
       {
+         SYM_GROUPELEMENTS* gelems;
          int** permsincomp;
          int* topoorder;
          int k;
@@ -5347,8 +6566,11 @@ SCIP_RETCODE detectAndHandleSubgroups(
 
          /* Relabel (This is only nontrivial for symretopes if relabeling is permitted) */
          SCIP_CALL( SCIPallocBufferArray(scip, &topoorder, propdata->npermvars) );
-         SCIP_CALL( adaptSymmetryDataSymretope(scip, propdata->relabelsymretopes, permsincomp, npermsincomp,
-               propdata->npermvars, topoorder) );
+         SCIP_CALL( createGroupElements(scip, permsincomp, npermsincomp, propdata->npermvars, npermsincomp, &gelems) );
+         SCIP_CALL( adaptSymmetryDataSymretope(scip, propdata->relabelsymretopes, gelems, propdata->npermvars,
+               topoorder) );
+         freeGroupElements(scip, &gelems);
+         SCIP_CALL( ensureModifiedPermsMemory(scip, propdata, &modifiedperms, &modifiedpermvars) );
          SCIP_CALL( adaptSymmetryDataSST(scip, propdata->perms, modifiedperms, propdata->nperms,
                propdata->permvars, modifiedpermvars, propdata->npermvars, topoorder, propdata->npermvars) );
          #ifndef NDEBUG
@@ -5585,6 +6807,8 @@ SCIP_RETCODE detectAndHandleSubgroups(
       {
          int k;
 
+         /* create arrays for modified permutations, since we adapt the lexicographic order because of suborbitopes */
+         SCIP_CALL( ensureModifiedPermsMemory(scip, propdata, &modifiedperms, &modifiedpermvars) );
          SCIP_CALL( adaptSymmetryDataSST(scip, propdata->perms, modifiedperms, propdata->nperms,
                propdata->permvars, modifiedpermvars, propdata->npermvars, lexorder, nvarslexorder) );
 
@@ -5618,6 +6842,7 @@ SCIP_RETCODE detectAndHandleSubgroups(
       SCIPfreeBlockMemoryArrayNull(scip, &graphcomponents, propdata->npermvars);
       SCIPfreeBufferArrayNull(scip, &permused);
       SCIPfreeBufferArrayNull(scip, &usedperms);
+      freeTwoCycleIndex(scip, &twocycleindex);
    }
 
 #ifdef SCIP_DEBUG
@@ -5628,12 +6853,15 @@ SCIP_RETCODE detectAndHandleSubgroups(
 
    SCIPfreeBufferArray(scip, &nvarsincomponent);
 
-   SCIPfreeBufferArray(scip, &modifiedpermvars);
-   for (i = propdata->nperms - 1; i >= 0; --i)
+   if ( modifiedperms != NULL )
    {
-      SCIPfreeBufferArray(scip, &modifiedperms[i]);
+      SCIPfreeBlockMemoryArray(scip, &modifiedpermvars, propdata->npermvars);
+      for (i = propdata->nperms - 1; i >= 0; --i)
+      {
+         SCIPfreeBlockMemoryArray(scip, &modifiedperms[i], propdata->npermvars);
+      }
+      SCIPfreeBlockMemoryArray(scip, &modifiedperms, propdata->nperms);
    }
-   SCIPfreeBufferArray(scip, &modifiedperms);
    SCIPfreeBufferArray(scip, &genorder);
 
    return SCIP_OKAY;
@@ -5645,90 +6873,6 @@ SCIP_RETCODE detectAndHandleSubgroups(
  */
 
 
-/** sorts orbitope vars matrix such that rows are sorted increasingly w.r.t. minimum variable index in row;
- *  columns are sorted such that first row is sorted increasingly w.r.t. variable indices
- */
-static
-SCIP_RETCODE SCIPsortOrbitope(
-   SCIP*                 scip,               /**< SCIP instance */
-   int**                 orbitopevaridx,     /**< variable index matrix of orbitope */
-   SCIP_VAR***           vars,               /**< variable matrix of orbitope */
-   int                   nrows,              /**< number of binary rows of orbitope */
-   int                   ncols               /**< number of columns of orbitope */
-   )
-{
-   SCIP_VAR** sortedrow;
-   int* colorder;
-   int* idcs;
-   int arrlen;
-   int minrowidx = INT_MAX;
-   int minrow = INT_MAX;
-   int i;
-   int j;
-
-   assert( scip != NULL );
-   assert( orbitopevaridx != NULL );
-   assert( vars != NULL );
-   assert( nrows > 0 );
-   assert( ncols > 0 );
-
-   arrlen = MAX(nrows, ncols);
-   SCIP_CALL( SCIPallocBufferArray(scip, &idcs, arrlen) );
-
-   /* detect minimum index per row */
-   for (i = 0; i < nrows; ++i)
-   {
-      int idx;
-
-      idcs[i] = INT_MAX;
-
-      for (j = 0; j < ncols; ++j)
-      {
-         idx = orbitopevaridx[i][j];
-
-         if ( idx < idcs[i] )
-            idcs[i] = idx;
-
-         if ( idx < minrowidx )
-         {
-            minrowidx = idx;
-            minrow = i;
-         }
-      }
-   }
-
-   /* sort rows increasingly w.r.t. minimum variable indices */
-   SCIPsortIntPtr(idcs, (void**) vars, nrows);
-
-   /* sort columns increasingly w.r.t. variable indices of first row */
-   SCIP_CALL( SCIPallocBufferArray(scip, &colorder, ncols) );
-   for (j = 0; j < ncols; ++j)
-   {
-      idcs[j] = orbitopevaridx[minrow][j];
-      colorder[j] = j;
-   }
-
-   /* sort columns of first row and store new column order */
-   SCIPsortIntIntPtr(idcs, colorder, (void**) vars[0], ncols);
-
-   /* adapt rows 1, ..., nrows - 1 to new column order*/
-   SCIP_CALL( SCIPallocBufferArray(scip, &sortedrow, ncols) );
-   for (i = 1; i < nrows; ++i)
-   {
-      for (j = 0; j < ncols; ++j)
-         sortedrow[j] = vars[i][colorder[j]];
-      for (j = 0; j < ncols; ++j)
-         vars[i][j] = sortedrow[j];
-   }
-
-   SCIPfreeBufferArray(scip, &sortedrow);
-   SCIPfreeBufferArray(scip, &colorder);
-   SCIPfreeBufferArray(scip, &idcs);
-
-   return SCIP_OKAY;
-}
-
-
 /** checks whether components of the symmetry group can be completely handled by orbitopes */
 static
 SCIP_RETCODE detectOrbitopes(
@@ -5775,20 +6919,15 @@ SCIP_RETCODE detectOrbitopes(
    /* iterate over components */
    for (i = 0; i < ncomponents; ++i)
    {
+      SYM_TWOCYCLEINDEX twocycleindex;
       SCIP_VAR*** vars;
-      SCIP_VAR*** varsallocorder;
+      SCIP_VAR** varsblock;
       SCIP_CONS* cons;
-      SCIP_Shortbool* rowisbinary;
-      SCIP_Bool isorbitope = TRUE;
-      SCIP_Bool infeasibleorbitope;
-      int** orbitopevaridx;
-      int* columnorder;
+      SCIP_Bool isorbitope;
       int npermsincomponent;
-      int ntwocyclescomp = INT_MAX;
-      int nbincyclescomp = INT_MAX;
-      int* nusedelems;
+      int ntwocyclescomp;
+      int nbincyclescomp;
       int j;
-      int cnt;
 
       /* orbitopes are detected first, so no component should be blocked */
       assert( ! propdata->componentblocked[i] );
@@ -5796,98 +6935,37 @@ SCIP_RETCODE detectOrbitopes(
       /* get properties of permutations */
       npermsincomponent = componentbegins[i + 1] - componentbegins[i];
       assert( npermsincomponent > 0 );
-      for (j = componentbegins[i]; j < componentbegins[i + 1]; ++j)
-      {
-         int ntwocyclesperm = 0;
-         int nbincyclesperm = 0;
-
-         SCIP_CALL( SCIPisInvolutionPerm(perms[components[j]], permvars, npermvars,
-               &ntwocyclesperm, &nbincyclesperm, FALSE) );
-
-         if ( ntwocyclescomp == 0 )
-         {
-            isorbitope = FALSE;
-            break;
-         }
-
-         /* if we are checking the first permutation */
-         if ( ntwocyclescomp == INT_MAX )
-         {
-            ntwocyclescomp = ntwocyclesperm;
-            nbincyclescomp = nbincyclesperm;
 
-            /* if there are no binary rows */
-            if ( nbincyclescomp == 0 )
-            {
-               isorbitope = FALSE;
-               break;
-            }
-         }
+      SCIP_CALL( createTwoCycleIndex(scip, perms, permvars, npermvars, &(components[componentbegins[i]]),
+            npermsincomponent, TRUE, &twocycleindex) );
 
-         /* no or different number of 2-cycles or not all vars binary: permutations cannot generate orbitope */
-         if ( ntwocyclescomp != ntwocyclesperm || nbincyclesperm != nbincyclescomp )
-         {
+      /* all permutations need the same positive number of 2-cycles and of binary 2-cycles to generate an orbitope */
+      ntwocyclescomp = twocycleindex.ntwocycles[0];
+      nbincyclescomp = twocycleindex.nbincycles[0];
+      isorbitope = ntwocyclescomp > 0 && nbincyclescomp > 0;
+      for (j = 1; j < npermsincomponent && isorbitope; ++j)
+      {
+         if ( twocycleindex.ntwocycles[j] != ntwocyclescomp || twocycleindex.nbincycles[j] != nbincyclescomp )
             isorbitope = FALSE;
-            break;
-         }
       }
 
-      /* if no orbitope was detected */
       if ( ! isorbitope )
-         continue;
-      assert( ntwocyclescomp > 0 );
-      assert( ntwocyclescomp < INT_MAX );
-
-      /* iterate over permutations and check whether for each permutation there exists
-       * another permutation whose 2-cycles intersect pairwise in exactly one element */
-
-      /* orbitope matrix for indices of variables in permvars array */
-      SCIP_CALL( SCIPallocBufferArray(scip, &orbitopevaridx, ntwocyclescomp) );
-      for (j = 0; j < ntwocyclescomp; ++j)
       {
-         SCIP_CALL( SCIPallocBufferArray(scip, &orbitopevaridx[j], npermsincomponent + 1) ); /*lint !e866*/
+         freeTwoCycleIndex(scip, &twocycleindex);
+         continue;
       }
 
-      /* order of columns of orbitopevaridx */
-      SCIP_CALL( SCIPallocBufferArray(scip, &columnorder, npermsincomponent + 1) );
-      for (j = 0; j < npermsincomponent + 1; ++j)
-         columnorder[j] = npermsincomponent + 2;
-
-      /* count how often an element was used in the potential orbitope */
-      SCIP_CALL( SCIPallocClearBufferArray(scip, &nusedelems, npermvars) );
-
-      /* store whether a row of the potential orbitope contains only binary variables */
-      SCIP_CALL( SCIPallocClearBufferArray(scip, &rowisbinary, ntwocyclescomp) );
-
-      /* check if the permutations fulfill properties of an orbitope */
-      SCIP_CALL( checkTwoCyclePermsAreOrbitope(scip, permvars, npermvars, perms,
-            &(components[componentbegins[i]]), ntwocyclescomp, npermsincomponent,
-            orbitopevaridx, columnorder, nusedelems, NULL, rowisbinary, &isorbitope, NULL) );
-
-      if ( ! isorbitope )
-         goto FREEDATASTRUCTURES;
-
-      /* we have found a potential orbitope, prepare data for orbitope conshdlr */
+      /* orbitope matrix of the binary rows, whose rows point into one block */
       SCIP_CALL( SCIPallocBufferArray(scip, &vars, nbincyclescomp) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &varsallocorder, nbincyclescomp) );
-      cnt = 0;
-      for (j = 0; j < ntwocyclescomp; ++j)
-      {
-         if ( ! rowisbinary[j] )
-            continue;
+      SCIP_CALL( SCIPallocBufferArray(scip, &varsblock, nbincyclescomp * (npermsincomponent + 1)) );
+      for (j = 0; j < nbincyclescomp; ++j)
+         vars[j] = &varsblock[j * (npermsincomponent + 1)];
 
-         SCIP_CALL( SCIPallocBufferArray(scip, &vars[cnt], npermsincomponent + 1) ); /*lint !e866*/
-         varsallocorder[cnt] = vars[cnt]; /* to ensure that we can free the buffer in reverse order */
-         ++cnt;
-      }
-      assert( cnt == nbincyclescomp );
-
-      /* prepare variable matrix (reorder columns of orbitopevaridx) */
-      infeasibleorbitope = FALSE;
-      SCIP_CALL( SCIPgenerateOrbitopeVarsMatrix(scip, &vars, ntwocyclescomp, npermsincomponent + 1, permvars,
-            npermvars, orbitopevaridx, columnorder, nusedelems, rowisbinary, &infeasibleorbitope, FALSE, NULL, NULL, NULL) );
+      /* check if the permutations fulfill properties of an orbitope and build the sorted variable matrix */
+      SCIP_CALL( buildComponentOrbitope(scip, permvars, npermvars, perms, &(components[componentbegins[i]]),
+            &twocycleindex, ntwocyclescomp, nbincyclescomp, vars, &isorbitope) );
 
-      if ( ! infeasibleorbitope )
+      if ( isorbitope )
       {
          char name[SCIP_MAXSTRLEN];
 
@@ -5895,9 +6973,6 @@ SCIP_RETCODE detectOrbitopes(
 
          (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "orbitope_component%d", i);
 
-         /* to ensure same orbitope is added if different sets of generators are found */
-         SCIP_CALL( SCIPsortOrbitope(scip, orbitopevaridx, vars, nbincyclescomp, npermsincomponent + 1) );
-
          SCIP_CALL( SCIPcreateConsOrbitope(scip, &cons, name, vars, SCIP_ORBITOPETYPE_FULL,
                nbincyclescomp, npermsincomponent + 1, propdata->usedynamicprop, FALSE, FALSE, FALSE,
                propdata->conssaddlp, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
@@ -5921,42 +6996,35 @@ SCIP_RETCODE detectOrbitopes(
       }
 
       /* free data structures */
-      for (j = nbincyclescomp - 1; j >= 0; --j)
-      {
-         SCIPfreeBufferArray(scip, &varsallocorder[j]);
-      }
-      SCIPfreeBufferArray(scip, &varsallocorder);
+      SCIPfreeBufferArray(scip, &varsblock);
       SCIPfreeBufferArray(scip, &vars);
-
-   FREEDATASTRUCTURES:
-      SCIPfreeBufferArray(scip, &rowisbinary);
-      SCIPfreeBufferArray(scip, &nusedelems);
-      SCIPfreeBufferArray(scip, &columnorder);
-      for (j = ntwocyclescomp - 1; j >= 0; --j)
-      {
-         SCIPfreeBufferArray(scip, &orbitopevaridx[j]);
-      }
-      SCIPfreeBufferArray(scip, &orbitopevaridx);
+      freeTwoCycleIndex(scip, &twocycleindex);
    }
 
    return SCIP_OKAY;
 }
 
 
-/** update symmetry information of conflict graph */
+/** update symmetry information of conflict graph
+ *
+ *  The number of conflicts of a variable within its orbit is counted along the conflict adjacency computed by
+ *  createConflictAdjacencySST(); conflicts with variables that have been fixed or left the orbit are skipped.
+ */
 static
 SCIP_RETCODE updateSymInfoConflictGraphSST(
    SCIP*                 scip,               /**< SCIP instance */
    SCIP_CONFLICTDATA*    varconflicts,       /**< conflict structure */
    SCIP_VAR**            conflictvars,       /**< variables encoded in conflict structure */
    int                   nconflictvars,      /**< number of nodes/vars in conflict structure */
+   int*                  conflictbegins,     /**< begin positions of the conflicts of each node in conflictadj */
+   int*                  conflictadj,        /**< array of conflicting nodes, sorted by node */
    int*                  orbits,             /**< array of non-trivial orbits */
    int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
    int                   norbits             /**< number of non-trivial orbits */
    )
 {
    int i;
-   int j;
+   int k;
    int ii;
    int jj;
    int r; /* r from orbit, the orbit index. */
@@ -5965,6 +7033,8 @@ SCIP_RETCODE updateSymInfoConflictGraphSST(
    assert( varconflicts != NULL );
    assert( conflictvars != NULL );
    assert( nconflictvars > 0 );
+   assert( conflictbegins != NULL );
+   assert( conflictadj != NULL || conflictbegins[nconflictvars] == 0 );
    assert( orbits != NULL );
    assert( orbitbegins != NULL );
    assert( norbits >= 0 );
@@ -6002,14 +7072,11 @@ SCIP_RETCODE updateSymInfoConflictGraphSST(
          varconflicts[pos].orbitsize = orbitsize;
          varconflicts[pos].posinorbit = posinorbit++;
       }
+   }
 
-      /* determine nconflictsinorbit
-       *
-       * For each pair of active variables in this orbit, check if it is part of a conflict clique.
-       * Use that we store the cliques of this type in varconflicts[pos].cliques.
-       * These lists are sorted (by the address of the constraint), so we only need to check for each i, j in the orbit
-       * whether they are contained in the same clique.
-       */
+   /* determine nconflictsinorbit: count the active neighbors of each active variable that lie in the same orbit */
+   for (r = 0; r < norbits; ++r)
+   {
       for (i = orbitbegins[r]; i < orbitbegins[r + 1]; ++i)
       {
          ii = orbits[i];
@@ -6019,29 +7086,13 @@ SCIP_RETCODE updateSymInfoConflictGraphSST(
          if ( ! varconflicts[ii].active )
             continue;
 
-         for (j = i + 1; j < orbitbegins[r + 1]; ++j)
+         for (k = conflictbegins[ii]; k < conflictbegins[ii + 1]; ++k)
          {
-            jj = orbits[j];
-            assert( varconflicts[jj].orbitidx == r );
-
-            /* skip inactive variables */
-            if ( ! varconflicts[jj].active )
-               continue;
+            jj = conflictadj[k];
+            assert( 0 <= jj && jj < nconflictvars );
 
-            /* Check if i and j are overlapping in some clique, where only one of the two could have value 1.
-             * Use that cliques are sorted by the constraint address.
-             *
-             * @todo A better sorted order would be: First constraints with large variables (higher hitting probability)
-             *  and then by a unique constraint identifier (address, or conspos).
-             */
-            if ( checkSortedArraysHaveOverlappingEntry((void**)varconflicts[ii].cliques,
-               varconflicts[ii].ncliques, (void**)varconflicts[jj].cliques, varconflicts[jj].ncliques,
-               sortByPointerValue) )
-            {
-               /* there is overlap! */
+            if ( varconflicts[jj].orbitidx == r && varconflicts[jj].active )
                ++varconflicts[ii].nconflictinorbit;
-               ++varconflicts[jj].nconflictinorbit;
-            }
          }
       }
    }
@@ -6224,6 +7275,121 @@ SCIP_RETCODE createConflictGraphSST(
    return SCIP_OKAY;
 }
 
+/** computes the conflict adjacency of the conflict graph in CSR format
+ *
+ *  Two active variables are adjacent if they are contained in a common clique and in a common orbit w.r.t. the
+ *  full symmetry group. Since the orbits of the stabilizer subgroups refine these orbits, the adjacency only needs to be
+ *  computed once and contains all conflicts that are relevant for selecting orbit leaders.
+ */
+static
+SCIP_RETCODE createConflictAdjacencySST(
+   SCIP*                 scip,               /**< SCIP instance */
+   SCIP_CONFLICTDATA*    varconflicts,       /**< conflict graph */
+   int                   nconflictvars,      /**< number of nodes/vars in conflict graph */
+   int*                  orbits,             /**< array of non-trivial orbits w.r.t. the full symmetry group */
+   int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
+   int                   norbits,            /**< number of non-trivial orbits */
+   int**                 conflictbegins,     /**< pointer to store begin positions of the conflicts of each node */
+   int**                 conflictadj,        /**< pointer to store array of conflicting nodes (or NULL if empty) */
+   int*                  nconflictadj        /**< pointer to store the size of conflictadj */
+   )
+{
+   int* edgetails;
+   int* edgeheads;
+   int* fillpos;
+   int maxnedges;
+   int nedges = 0;
+   int r;
+   int i;
+   int j;
+   int e;
+
+   assert( scip != NULL );
+   assert( varconflicts != NULL );
+   assert( nconflictvars > 0 );
+   assert( orbits != NULL );
+   assert( orbitbegins != NULL );
+   assert( norbits >= 0 );
+   assert( conflictbegins != NULL );
+   assert( conflictadj != NULL );
+   assert( nconflictadj != NULL );
+
+   maxnedges = MAX(nconflictvars, 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgetails, maxnedges) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeheads, maxnedges) );
+
+   /* collect the conflicting pairs of active variables in each orbit; cliques are sorted by the constraint address */
+   for (r = 0; r < norbits; ++r)
+   {
+      for (i = orbitbegins[r]; i < orbitbegins[r + 1]; ++i)
+      {
+         int ii;
+
+         ii = orbits[i];
+         if ( ! varconflicts[ii].active || varconflicts[ii].ncliques == 0 )
+            continue;
+
+         for (j = i + 1; j < orbitbegins[r + 1]; ++j)
+         {
+            int jj;
+
+            jj = orbits[j];
+            if ( ! varconflicts[jj].active || varconflicts[jj].ncliques == 0 )
+               continue;
+
+            if ( ! checkSortedArraysHaveOverlappingEntry((void**)varconflicts[ii].cliques,
+                  varconflicts[ii].ncliques, (void**)varconflicts[jj].cliques, varconflicts[jj].ncliques,
+                  sortByPointerValue) )
+               continue;
+
+            if ( nedges >= maxnedges )
+            {
+               maxnedges = SCIPcalcMemGrowSize(scip, nedges + 1);
+               SCIP_CALL( SCIPreallocBufferArray(scip, &edgetails, maxnedges) );
+               SCIP_CALL( SCIPreallocBufferArray(scip, &edgeheads, maxnedges) );
+            }
+            edgetails[nedges] = ii;
+            edgeheads[nedges++] = jj;
+         }
+      }
+   }
+
+   /* store each edge in both directions */
+   *nconflictadj = 2 * nedges;
+   *conflictadj = NULL;
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, conflictbegins, nconflictvars + 1) );
+   for (e = 0; e < nedges; ++e)
+   {
+      ++(*conflictbegins)[edgetails[e] + 1];
+      ++(*conflictbegins)[edgeheads[e] + 1];
+   }
+   for (i = 0; i < nconflictvars; ++i)
+      (*conflictbegins)[i + 1] += (*conflictbegins)[i];
+   assert( (*conflictbegins)[nconflictvars] == *nconflictadj );
+
+   if ( nedges > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, conflictadj, *nconflictadj) );
+      SCIP_CALL( SCIPduplicateBufferArray(scip, &fillpos, *conflictbegins, nconflictvars) );
+
+      for (e = 0; e < nedges; ++e)
+      {
+         (*conflictadj)[fillpos[edgetails[e]]++] = edgeheads[e];
+         (*conflictadj)[fillpos[edgeheads[e]]++] = edgetails[e];
+      }
+
+      SCIPfreeBufferArray(scip, &fillpos);
+   }
+
+   SCIPfreeBufferArray(scip, &edgeheads);
+   SCIPfreeBufferArray(scip, &edgetails);
+
+   SCIPdebugMsg(scip, "Conflict adjacency contains %d edges.\n", nedges);
+
+   return SCIP_OKAY;
+}
+
+
 /** frees conflict graph */
 static
 SCIP_RETCODE freeConflictGraphSST(
@@ -6421,8 +7587,11 @@ SCIP_RETCODE addSymresackConss(
              * quite complicated, because the permutation-array sorted the permutations from componentbegins[i] to
              * componentbegins[i+1]-1. I shouldn't touch that array.
              */
-            int** modifiedpermscomp;
+            SYM_GROUPELEMENTS* gelems;
             SCIP_VAR** modifiedpermvarscomp;
+            int* modifiedpermcomp;
+            int* elementbuffer;
+            int* element;
 
             /* List the permutations in this component. */
             npermsincomp = componentbegins[i + 1] - componentbegins[i];
@@ -6430,42 +7599,41 @@ SCIP_RETCODE addSymresackConss(
             for (p = 0; p < npermsincomp; ++p)
                permsincomp[p] = propdata->perms[propdata->components[propdata->componentbegins[i] + p]];
 
-            /* Possibly extend the permutations in this component */
-            if ( propdata->extendgenerators )
-            {
-               SCIP_CALL( adaptSymmetryExtendGenerators(scip, &permsincomp, &npermsincomp, propdata->npermvars,
-                  propdata->maxextendgenerators / propdata->npermvars) );
-            }
+            /* Possibly extend the permutations in this component. The products are only materialized one at a time,
+             * when their constraint is added. */
+            SCIP_CALL( createGroupElements(scip, permsincomp, npermsincomp, propdata->npermvars,
+                  propdata->extendgenerators ? propdata->maxextendgenerators / propdata->npermvars : npermsincomp,
+                  &gelems) );
 
-            SCIP_CALL( SCIPallocBufferArray(scip, &modifiedpermscomp, npermsincomp) );
+            SCIP_CALL( SCIPallocBufferArray(scip, &elementbuffer, propdata->npermvars) );
+            SCIP_CALL( SCIPallocBufferArray(scip, &modifiedpermcomp, propdata->npermvars) );
             SCIP_CALL( SCIPallocBufferArray(scip, &modifiedpermvarscomp, propdata->npermvars) );
-            for (k = 0; k < npermsincomp; ++k)
-            {
-               SCIP_CALL( SCIPallocBufferArray(scip, &modifiedpermscomp[k], propdata->npermvars) );
-            }
 
             /* Relabel (This is only nontrivial for symretopes if relabeling is permitted) */
             SCIP_CALL( SCIPallocBufferArray(scip, &topoorder, propdata->npermvars) );
-            SCIP_CALL( adaptSymmetryDataSymretope(scip, propdata->relabelsymretopes, permsincomp, npermsincomp,
-                  propdata->npermvars, topoorder) );
-            SCIP_CALL( adaptSymmetryDataSST(scip, permsincomp, modifiedpermscomp, npermsincomp,
-                  propdata->permvars, modifiedpermvarscomp, propdata->npermvars, topoorder, propdata->npermvars) );
-            #ifndef NDEBUG
+            SCIP_CALL( adaptSymmetryDataSymretope(scip, propdata->relabelsymretopes, gelems, propdata->npermvars,
+                  topoorder) );
+
+            /* loop through the group elements of component i and add symresack constraints */
+            for (k = 0; k < gelems->nelements; ++k)
             {
-               /* Test: modifiedpermscomp now follows the variable ordering of topoorder. */
-               for (k = 0; k < propdata->npermvars; ++k)
+               element = getGroupElement(gelems, k, elementbuffer);
+               SCIP_CALL( adaptSymmetryDataSST(scip, &element, &modifiedpermcomp, 1,
+                     propdata->permvars, modifiedpermvarscomp, propdata->npermvars, topoorder, propdata->npermvars) );
+               #ifndef NDEBUG
                {
-                  assert( propdata->permvars[topoorder[k]] == modifiedpermvarscomp[k] );
+                  int v;
+
+                  /* Test: modifiedpermcomp now follows the variable ordering of topoorder. */
+                  for (v = 0; v < propdata->npermvars; ++v)
+                  {
+                     assert( propdata->permvars[topoorder[v]] == modifiedpermvarscomp[v] );
+                  }
                }
-            }
-            #endif
-            SCIPfreeBufferArray(scip, &topoorder);
+               #endif
 
-            /* loop through perms in component i and add symresack constraints */
-            for (k = 0; k < npermsincomp; ++k)
-            {
                SCIP_CALL( addSymmetryBreakingConstraintSymretopeOrSymresack(scip, propdata,
-                  modifiedpermscomp[k], modifiedpermvarscomp, propdata->npermvars, i, k) );
+                  modifiedpermcomp, modifiedpermvarscomp, propdata->npermvars, i, k) );
 
                ++nsymresackcons;
 
@@ -6478,25 +7646,11 @@ SCIP_RETCODE addSymresackConss(
                SCIPdebugMsg(scip, "  add symresack/symretope for permutation %d of component %d\n", k, i);
             }
 
-            /* deallocate any newly generated permutations after extension */
-            if ( propdata->extendgenerators )
-            {
-               /* in adaptSymmetryExtendGenerators, we allocated new perms. Here, free these newly generated ones */
-               k = npermsincomp;
-               while (k > componentbegins[i + 1] - componentbegins[i])
-               {
-                  SCIPfreeBlockMemoryArray(scip, &(permsincomp[--k]), propdata->npermvars);
-               }
-               /* we must be back to the initial npermsincomp-value */
-               assert( k == componentbegins[i + 1] - componentbegins[i] );
-            }
-
-            for (k = npermsincomp - 1; k >= 0; --k)
-            {
-               SCIPfreeBufferArray(scip, &modifiedpermscomp[k]);
-            }
+            SCIPfreeBufferArray(scip, &topoorder);
             SCIPfreeBufferArray(scip, &modifiedpermvarscomp);
-            SCIPfreeBufferArray(scip, &modifiedpermscomp);
+            SCIPfreeBufferArray(scip, &modifiedpermcomp);
+            SCIPfreeBufferArray(scip, &elementbuffer);
+            freeGroupElements(scip, &gelems);
 
             SCIPfreeBlockMemoryArray(scip, &permsincomp, npermsincomp);
          }
@@ -6678,6 +7832,8 @@ SCIP_RETCODE selectOrbitLeaderSSTConss(
    SCIP_CONFLICTDATA*    varconflicts,       /**< variable conflicts structure, or NULL if we do not use it */
    SCIP_VAR**            conflictvars,       /**< variables encoded in conflict graph */
    int                   nconflictvars,      /**< number of variables encoded in conflict graph */
+   int*                  conflictbegins,     /**< begin positions of the conflicts of each node, or NULL if varconflicts is NULL */
+   int*                  conflictadj,        /**< array of conflicting nodes, sorted by node */
    int*                  orbits,             /**< orbits of stabilizer subgroup, expressed in terms of conflictvars */
    int*                  orbitbegins,        /**< array storing the begin position of each orbit in orbits */
    int                   norbits,            /**< number of orbits */
@@ -6694,7 +7850,6 @@ SCIP_RETCODE selectOrbitLeaderSSTConss(
    int varidx;
    int orbitcriterion;
    int curcriterion = INT_MIN;
-   int orbitsize;
    int i;
    int leader = -1;
 
@@ -6707,6 +7862,7 @@ SCIP_RETCODE selectOrbitLeaderSSTConss(
    assert( orbitidx != NULL );
    assert( leaderidx != NULL );
    assert( orbitvarinconflict != NULL || varconflicts == NULL );
+   assert( conflictbegins != NULL || varconflicts == NULL );
    assert( norbitvarinconflict != NULL );
    assert( success != NULL );
 
@@ -6803,34 +7959,23 @@ SCIP_RETCODE selectOrbitLeaderSSTConss(
              */
             int varmapid;
 
-            orbitsize = orbitbegins[*orbitidx + 1] - orbitbegins[*orbitidx];
             assert( varconflicts != NULL );
             assert( leader >= 0 && leader < nconflictvars );
 
             assert( orbitvarinconflict != NULL );
 
-            for (i = 0; i < orbitsize; ++i)
+            for (i = conflictbegins[leader]; i < conflictbegins[leader + 1]; ++i)
             {
-               /* skip the leader */
-               if ( i == *leaderidx )
-                  continue;
-
                /* get variable index in conflict graph */
-               varmapid = orbits[orbitbegins[*orbitidx] + i];
+               varmapid = conflictadj[i];
 
-               /* only active variables */
-               if ( ! varconflicts[varmapid].active )
+               /* only active variables of the leader's orbit */
+               if ( varconflicts[varmapid].orbitidx != *orbitidx || ! varconflicts[varmapid].active )
                   continue;
 
-               /* check if leader and var have overlap */
-               if ( checkSortedArraysHaveOverlappingEntry((void**)varconflicts[leader].cliques,
-                  varconflicts[leader].ncliques, (void**)varconflicts[varmapid].cliques,
-                  varconflicts[varmapid].ncliques, sortByPointerValue) )
-               {
-                  /* there is overlap! */
-                  orbitvarinconflict[i] = TRUE;
-                  ++(*norbitvarinconflict);
-               }
+               assert( varconflicts[varmapid].posinorbit != *leaderidx );
+               orbitvarinconflict[varconflicts[varmapid].posinorbit] = TRUE;
+               ++(*norbitvarinconflict);
             }
          }
       }
@@ -6877,33 +8022,23 @@ SCIP_RETCODE selectOrbitLeaderSSTConss(
          /* count how many active variables in the orbit conflict with leader */
          int varmapid;
 
-         orbitsize = orbitbegins[*orbitidx + 1] - orbitbegins[*orbitidx];
          assert( varconflicts != NULL );
          assert( leader >= 0 && leader < nconflictvars );
 
          assert( orbitvarinconflict != NULL );
 
-         for (i = 0; i < orbitsize; ++i)
+         for (i = conflictbegins[leader]; i < conflictbegins[leader + 1]; ++i)
          {
-            /* skip the leader */
-            if ( i == *leaderidx )
-               continue;
-
             /* get variable index in conflict graph */
-            varmapid = orbits[orbitbegins[*orbitidx] + i];
-            /* only active variables */
-            if ( ! varconflicts[varmapid].active )
+            varmapid = conflictadj[i];
+
+            /* only active variables of the leader's orbit */
+            if ( varconflicts[varmapid].orbitidx != *orbitidx || ! varconflicts[varmapid].active )
                continue;
 
-            /* check if leader and var have overlap */
-            if ( checkSortedArraysHaveOverlappingEntry((void**)varconflicts[leader].cliques,
-               varconflicts[leader].ncliques, (void**)varconflicts[varmapid].cliques,
-               varconflicts[varmapid].ncliques, sortByPointerValue) )
-            {
-               /* there is overlap! */
-               orbitvarinconflict[i] = TRUE;
-               ++(*norbitvarinconflict);
-            }
+            assert( varconflicts[varmapid].posinorbit != *leaderidx );
+            orbitvarinconflict[varconflicts[varmapid].posinorbit] = TRUE;
+            ++(*norbitvarinconflict);
          }
       }
    }
@@ -6921,6 +8056,9 @@ SCIP_RETCODE addSSTConss(
    )
 { /*lint --e{641}*/
    SCIP_CONFLICTDATA* varconflicts = NULL;
+   int* conflictbegins = NULL;
+   int* conflictadj = NULL;
+   int nconflictadj = 0;
    SCIP_HASHMAP* permvarmap;
    SCIP_VAR** permvars;
    int** permstrans;
@@ -7080,6 +8218,17 @@ SCIP_RETCODE addSSTConss(
    if ( conflictgraphcreated )
    {
       SCIP_CALL( SCIPallocClearBufferArray(scip, &orbitvarinconflict, npermvars) );
+
+      /* compute the conflicts within the orbits of the full group once, the stabilizers only refine these orbits */
+      for (p = 0; p < nperms; ++p)
+         inactiveperms[p] = FALSE;
+
+      SCIP_CALL( SCIPcomputeOrbitsFilterSym(scip, npermvars, permstrans, nperms, inactiveperms,
+            orbits, orbitbegins, &norbits, components, componentbegins, vartocomponent,
+            componentblocked, ncomponents, nmovedpermvars) );
+
+      SCIP_CALL( createConflictAdjacencySST(scip, varconflicts, npermvars, orbits, orbitbegins, norbits,
+            &conflictbegins, &conflictadj, &nconflictadj) );
    }
 
    SCIPdebugMsg(scip, "Start selection of orbits and leaders for Schreier Sims constraints.\n");
@@ -7138,8 +8287,8 @@ SCIP_RETCODE addSSTConss(
          /* update symmetry information of conflict graph */
          if ( conflictgraphcreated )
          {
-            SCIP_CALL( updateSymInfoConflictGraphSST(scip, varconflicts, permvars, npermvars, orbits, orbitbegins,
-               norbits) );
+            SCIP_CALL( updateSymInfoConflictGraphSST(scip, varconflicts, permvars, npermvars, conflictbegins,
+                  conflictadj, orbits, orbitbegins, norbits) );
          }
 
          /* possibly adapt the leader and tie-break rule */
@@ -7153,7 +8302,8 @@ SCIP_RETCODE addSSTConss(
             tiebreakrule = SCIP_LEADERTIEBREAKRULE_MAXORBIT;
 
          /* select orbit and leader */
-         SCIP_CALL( selectOrbitLeaderSSTConss(scip, varconflicts, permvars, npermvars, orbits, orbitbegins,
+         SCIP_CALL( selectOrbitLeaderSSTConss(scip, varconflicts, permvars, npermvars, conflictbegins, conflictadj,
+            orbits, orbitbegins,
             norbits, propdata->sstleaderrule, propdata->ssttiebreakrule, selectedtype, &orbitidx, &orbitleaderidx,
             orbitvarinconflict, &norbitvarinconflict, &success) );
 
@@ -7202,6 +8352,8 @@ SCIP_RETCODE addSSTConss(
 
    if ( conflictgraphcreated )
    {
+      SCIPfreeBlockMemoryArrayNull(scip, &conflictadj, nconflictadj);
+      SCIPfreeBlockMemoryArray(scip, &conflictbegins, npermvars + 1);
       SCIPfreeBufferArray(scip, &orbitvarinconflict);
    }
    SCIPfreeBufferArray(scip, &orbitbegins);
@@ -7371,6 +8523,9 @@ SCIP_RETCODE tryAddSymmetryHandlingConss(
  *  stabilizer is with respect to the variables that have been branched to 1. Thus, if an orbit contains a variable that
  *  has been branched to 1, the whole orbit only contains variables that have been branched to 1 - and nothing can be
  *  fixed.
+ *
+ *  Orbits marked in @p orbitsettled are skipped. If @p marksettled is TRUE, orbits that are completely fixed after the
+ *  call or that contain non-binary variables are marked as settled.
  */
 static
 SCIP_RETCODE performOrbitalFixing(
@@ -7380,6 +8535,8 @@ SCIP_RETCODE performOrbitalFixing(
    int*                  orbits,             /**< array of non-trivial orbits */
    int*                  orbitbegins,        /**< array containing begin positions of new orbits in orbits array */
    int                   norbits,            /**< number of orbits */
+   SCIP_Shortbool*       orbitsettled,       /**< array marking orbits that cannot yield fixings anymore (or NULL) */
+   SCIP_Bool             marksettled,        /**< whether settled orbits shall be marked in orbitsettled */
    SCIP_Bool*            infeasible,         /**< pointer to store whether problem is infeasible */
    int*                  nfixedzero,         /**< pointer to store number of variables fixed to 0 */
    int*                  nfixedone           /**< pointer to store number of variables fixed to 1 */
@@ -7397,6 +8554,7 @@ SCIP_RETCODE performOrbitalFixing(
    assert( nfixedone != NULL );
    assert( norbits > 0 );
    assert( orbitbegins[0] == 0 );
+   assert( orbitsettled != NULL || ! marksettled );
 
    *infeasible = FALSE;
    *nfixedzero = 0;
@@ -7407,9 +8565,14 @@ SCIP_RETCODE performOrbitalFixing(
    {
       SCIP_Bool havefixedone = FALSE;
       SCIP_Bool havefixedzero = FALSE;
+      SCIP_Bool havenonbinary = FALSE;
       SCIP_VAR* var;
       int j;
 
+      /* skip orbits whose variables have been fixed at an ancestor */
+      if ( orbitsettled != NULL && orbitsettled[i] )
+         continue;
+
       /* we only have nontrivial orbits */
       assert( orbitbegins[i+1] - orbitbegins[i] >= 2 );
 
@@ -7426,6 +8589,7 @@ SCIP_RETCODE performOrbitalFixing(
             /* skip orbit if there are non-binary variables */
             havefixedone = FALSE;
             havefixedzero = FALSE;
+            havenonbinary = TRUE;
             break;
          }
 
@@ -7500,6 +8664,10 @@ SCIP_RETCODE performOrbitalFixing(
             }
          }
       }
+
+      /* the orbit is fixed completely or can never be fixed */
+      if ( marksettled && (havefixedzero || havefixedone || havenonbinary) )
+         orbitsettled[i] = TRUE;
    }
 
    return SCIP_OKAY;
@@ -7610,9 +8778,11 @@ SCIP_RETCODE propagateOrbitalFixing(
    int*                  nprop               /**< pointer to store the number of propagations */
    )
 {
+   SYM_ORBITCACHEENTRY* cacheentry = NULL;
    SCIP_Shortbool* inactiveperms;
    SCIP_Shortbool* bg0;
    SCIP_Shortbool* bg1;
+   SCIP_NODE* node = NULL;
    SCIP_VAR** permvars;
    int* orbitbegins;
    int* orbits;
@@ -7836,19 +9006,61 @@ SCIP_RETCODE propagateOrbitalFixing(
    if ( nactiveperms == 0 )
       return SCIP_OKAY;
 
+   /* During the tree search, the active permutations can only decrease along a path, i.e., the orbits at a node can
+    * only be refined in its subtree. Since refinements cannot be expressed by updating a union-find structure, we store
+    * the orbits of the nodes on the current path and reuse them whenever the active permutations did not change, e.g.,
+    * after branching a variable to 0. Orbits that are settled at an ancestor are skipped in its subtree. */
+   if ( SCIPgetStage(scip) == SCIP_STAGE_SOLVING )
+   {
+      node = SCIPgetCurrentNode(scip);
+      popOrbitCache(scip, propdata, node);
+
+      if ( propdata->norbitcache > 0
+         && orbitCacheEntryMatches(&propdata->orbitcache[propdata->norbitcache - 1], inactiveperms, nperms - nactiveperms) )
+      {
+         int nfixedzero = 0;
+         int nfixedone = 0;
+
+         cacheentry = &propdata->orbitcache[propdata->norbitcache - 1];
+
+         if ( cacheentry->norbits > 0 )
+         {
+            SCIPdebugMsg(scip, "Perform orbital fixing on %d cached orbits (%d active perms).\n", cacheentry->norbits, nactiveperms);
+            SCIP_CALL( performOrbitalFixing(scip, permvars, nbinpermvars, cacheentry->orbits, cacheentry->orbitbegins,
+                  cacheentry->norbits, cacheentry->orbitsettled, cacheentry->nodenumber == SCIPnodeGetNumber(node),
+                  infeasible, &nfixedzero, &nfixedone) );
+
+            propdata->nfixedzero += nfixedzero;
+            propdata->nfixedone += nfixedone;
+            *nprop = nfixedzero + nfixedone;
+
+            SCIPdebugMsg(scip, "Orbital fixings: %d 0s, %d 1s.\n", nfixedzero, nfixedone);
+         }
+
+         return SCIP_OKAY;
+      }
+   }
+
    /* compute orbits of binary variables */
    SCIP_CALL( SCIPallocBufferArray(scip, &orbits, nbinpermvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &orbitbegins, nbinpermvars) );
    SCIP_CALL( SCIPcomputeOrbitsFilterSym(scip, nbinpermvars, permstrans, nperms, inactiveperms,
          orbits, orbitbegins, &norbits, components, componentbegins, vartocomponent, propdata->componentblocked, ncomponents, propdata->nmovedpermvars) );
 
+   if ( node != NULL )
+   {
+      SCIP_CALL( pushOrbitCache(scip, propdata, node, inactiveperms, nperms - nactiveperms, orbits, orbitbegins, norbits,
+            &cacheentry) );
+   }
+
    if ( norbits > 0 )
    {
       int nfixedzero = 0;
       int nfixedone = 0;
 
       SCIPdebugMsg(scip, "Perform orbital fixing on %d orbits (%d active perms).\n", norbits, nactiveperms);
-      SCIP_CALL( performOrbitalFixing(scip, permvars, nbinpermvars, orbits, orbitbegins, norbits, infeasible, &nfixedzero, &nfixedone) );
+      SCIP_CALL( performOrbitalFixing(scip, permvars, nbinpermvars, orbits, orbitbegins, norbits,
+            cacheentry != NULL ? cacheentry->orbitsettled : NULL, cacheentry != NULL, infeasible, &nfixedzero, &nfixedone) );
 
       propdata->nfixedzero += nfixedzero;
       propdata->nfixedone += nfixedone;
@@ -8354,6 +9566,9 @@ SCIP_RETCODE SCIPincludePropSymmetry(
    propdata->nbg1 = 0;
    propdata->permvarsevents = NULL;
    propdata->inactiveperms = NULL;
+   propdata->orbitcache = NULL;
+   propdata->norbitcache = 0;
+   propdata->orbitcacherun = 0;
    propdata->nmovedpermvars = -1;
    propdata->nmovedbinpermvars = 0;
    propdata->nmovedintpermvars = 0;
@@ -8409,6 +9624,11 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "Should all symmetries be checked after computation?",
          &propdata->checksymmetries, TRUE, DEFAULT_CHECKSYMMETRIES, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "propagating/" PROP_NAME "/cachefile",
+         "file in which generators are cached across runs of the same model (\"-\" = no cache)",
+         &propdata->cachefile, FALSE, DEFAULT_CACHEFILE, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/displaynorbitvars",
          "Should the number of variables affected by some symmetry be displayed?",
@@ -8498,8 +9718,8 @@ SCIP_RETCODE SCIPincludePropSymmetry(
 
    SCIP_CALL( SCIPaddIntParam(scip,
          "propagating/" PROP_NAME "/recomputerestart",
-         "recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction)",
-         &propdata->recomputerestart, TRUE, DEFAULT_RECOMPUTERESTART, 0, 2, NULL, NULL) );
+         "recompute symmetries after a restart has occured? (0 = never, 1 = always, 2 = if OF found reduction, 3 = incrementally by verifying the previous generators)",
+         &propdata->recomputerestart, TRUE, DEFAULT_RECOMPUTERESTART, 0, 3, NULL, NULL) );
 
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/compresssymmetries",
@@ -89,6 +89,7 @@ SCIP_RETCODE readArguments(
    const char**          solutionfile,       /**< solution file */
    const char**          writesolfilename,   /**< write solution file name */
    const char**          settingsname,       /**< name of settings file */
+   const char**          symcachefile,       /**< name of symmetry cache file */
    SCIP_Real*            timeLimit,          /**< time limit read from arguments */
    SCIP_Real*            memLimit,           /**< memory limit read from arguments */
    SCIP_Longint*         nodeLimit,          /**< node limit read from arguments */
@@ -96,7 +97,9 @@ SCIP_RETCODE readArguments(
    SCIP_Bool*            onlypre,            /**< Only run preprocessing? */
    int*                  permseed,           /**< seed for permutations */
    int*                  randseed,           /**< seed for randomization */
-   SCIP_Real*            cutoffvalue         /**< value of cutoff if setcutoff is true */
+   SCIP_Real*            cutoffvalue,        /**< value of cutoff if setcutoff is true */
+   const char**          jobfile,            /**< name of job file for batch mode, or NULL to not allow batch mode */
+   int*                  nthreads            /**< number of worker threads in batch mode, or NULL */
    )
 {  /*lint --e{818}*/
    int i;
@@ -109,6 +112,7 @@ SCIP_RETCODE readArguments(
    assert( solutionfile != NULL );
    assert( writesolfilename != NULL );
    assert( settingsname != NULL );
+   assert( symcachefile != NULL );
    assert( timeLimit != NULL );
    assert( memLimit != NULL );
    assert( nodeLimit != NULL );
@@ -116,9 +120,10 @@ SCIP_RETCODE readArguments(
    assert( onlypre != NULL );
    assert( permseed != NULL );
    assert( cutoffvalue != NULL );
+   assert( (jobfile == NULL) == (nthreads == NULL) );
 
    /* init usage text */
-   status = snprintf(usage, SCIP_MAXSTRLEN, "usage: %s <file> [-l <solution file>] [-w <write solution file>] [-s <setting file>] [-t <time limit>] [-m <mem limit>] [-n <node limit>] [-d <display frequency>] [-p <seed>] [-setcutoff <value>] [-O]", argv[0]);
+   status = snprintf(usage, SCIP_MAXSTRLEN, "usage: %s <file> [-l <solution file>] [-w <write solution file>] [-s <setting file>] [-sbcs <symmetry cache file>] [-t <time limit>] [-m <mem limit>] [-n <node limit>] [-d <display frequency>] [-p <seed>] [-setcutoff <value>] [-O] [-b <job file> [-j <threads>]]", argv[0]);
    if ( status < 0 || status > SCIP_MAXSTRLEN )
    {
       SCIPerrorMessage("string not long enough to hold usage message.\n");
@@ -133,11 +138,17 @@ SCIP_RETCODE readArguments(
    *solutionfile = NULL;
    *writesolfilename = NULL;
    *settingsname = NULL;
+   *symcachefile = NULL;
    *dispFreq = -1;
    *onlypre = FALSE;
    *permseed = -1;
    *randseed = -1;
    *cutoffvalue = SCIP_INVALID;
+   if ( jobfile != NULL )
+   {
+      *jobfile = NULL;
+      *nthreads = 1;
+   }
 
    /* check all arguments */
    for (i = 1; i < argc; ++i) /*lint -e850*/
@@ -196,6 +207,24 @@ SCIP_RETCODE readArguments(
          *settingsname = argv[i];
          assert( i < argc );
       }
+      /* check for symmetry cache name */
+      else if ( ! strcmp(argv[i], "-sbcs") )
+      {
+         if ( *symcachefile != NULL )
+         {
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
+         if ( i == argc-1 )
+         {
+            fprintf(stderr, "No symmetry cache file name supplied.\n");
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
+         ++i;
+         *symcachefile = argv[i];
+         assert( i < argc );
+      }
       /* check for time limit */
       else if ( ! strcmp(argv[i], "-t") )
       {
@@ -286,9 +315,44 @@ SCIP_RETCODE readArguments(
          *cutoffvalue = atof(argv[i]);
          assert( i < argc );
       }
-      else if ( ! strcmp(argv[i], "-O") )
+      /* check for job file */
+      else if ( ! strcmp(argv[i], "-b") && jobfile != NULL )
       {
+         if ( *jobfile != NULL )
+         {
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
+         if ( i == argc-1 )
+         {
+            fprintf(stderr, "No job file name supplied.\n");
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
+         ++i;
+         *jobfile = argv[i];
+         assert( i < argc );
+      }
+      /* check for number of threads */
+      else if ( ! strcmp(argv[i], "-j") && nthreads != NULL )
+      {
+         if ( i == argc-1 )
+         {
+            fprintf(stderr, "No number of threads supplied.\n");
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
          ++i;
+         *nthreads = atoi(argv[i]);
+         if ( *nthreads < 1 )
+         {
+            fprintf(stderr, "Number of threads must be positive.\n");
+            return SCIP_ERROR;
+         }
+         assert( i < argc );
+      }
+      else if ( ! strcmp(argv[i], "-O") )
+      {
          *onlypre = TRUE;
       }
       else
@@ -304,7 +368,16 @@ SCIP_RETCODE readArguments(
       }
    }
 
-   if ( *filename == NULL )
+   if ( jobfile != NULL && *jobfile != NULL )
+   {
+      if ( *filename != NULL )
+      {
+         fprintf(stderr, "Problem files are given in the job file in batch mode.\n");
+         fprintf(stderr, "%s\n", usage);
+         return SCIP_ERROR;
+      }
+   }
+   else if ( *filename == NULL )
    {
       fprintf(stderr, "No filename supplied.\n");
       fprintf(stderr, "%s\n", usage);
@@ -39,7 +39,12 @@ int getProblemName(
    int                   maxSize             /**< maximal size of probName string */
    );
 
-/** read comand line arguments */
+/** read comand line arguments
+ *
+ *  If jobfile is not NULL, the batch mode options "-b <job file>" and "-j <threads>" are accepted, in which case no
+ *  problem file needs to be given. Otherwise, these options are rejected, e.g., when reading the lines of a job file.
+ *  See runBatch() in main.cpp for the restrictions of running jobs on several threads.
+ */
 extern
 SCIP_RETCODE readArguments(
    int                   argc,               /**< number of shell parameters */
@@ -48,6 +53,7 @@ SCIP_RETCODE readArguments(
    const char**          solutionfile,       /**< solution file */
    const char**          writesolfilename,   /**< write solution file name */
    const char**          settingsname,       /**< name of settings file */
+   const char**          symcachefile,       /**< name of symmetry cache file */
    SCIP_Real*            timeLimit,          /**< time limit read from arguments */
    SCIP_Real*            memLimit,           /**< memory limit read from arguments */
    SCIP_Longint*         nodeLimit,          /**< node limit read from arguments */
@@ -55,7 +61,9 @@ SCIP_RETCODE readArguments(
    SCIP_Bool*            onlypre,            /**< Only run preprocessing? */
    int*                  permseed,           /**< seed for permutations */
    int*                  randseed,           /**< seed for randomization */
-   SCIP_Real*            cutoffvalue         /**< value of cutoff (SCIP_INVALID otherwise) */
+   SCIP_Real*            cutoffvalue,        /**< value of cutoff (SCIP_INVALID otherwise) */
+   const char**          jobfile,            /**< name of job file for batch mode, or NULL to not allow batch mode */
+   int*                  nthreads            /**< number of worker threads in batch mode, or NULL */
    );
 
 #ifdef __cplusplus
@@ -0,0 +1,729 @@
+/**@file   symbench.cpp
+ * @brief  benchmark driver for the propagation, check and separation routines of symmetry handling constraints
+ * @author Jasper van Doornmalen, Christopher Hojny
+ *
+ * The driver builds a synthetic problem consisting of binary variables and symretope, symresack, orbisack or orbitope
+ * constraints for a permutation with a given cycle structure. It then solves the root node with all other solving
+ * components disabled, and a benchmark heuristic runs the constraint callbacks in isolation:
+ *
+ * - propagation, via SCIPpropCons in probing nodes with random partial fixings; symretope peeking is enabled in
+ *   probing for the benchmark, such that the probing nodes propagate like the nodes of the tree;
+ * - feasibility checks, via SCIPcheckCons on random binary solutions;
+ * - separation, via SCIPsepasolCons on random fractional solutions.
+ *
+ * For each callback, the time per call, the net change of the used memory and the number of fixings or cuts are
+ * reported. The net change does not count memory that is allocated and freed again within a call.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+
+#include <scip/scip.h>
+
+#include <scip/scipdefplugins.h>
+#include "cons_symretope.h"
+#include "cons_symresack.h"
+#include "cons_orbisack.h"
+#include "cons_orbitope.h"
+
+#include <string.h>
+
+#define HEUR_NAME             "symbench"
+#define HEUR_DESC             "benchmark of the symmetry handling constraint callbacks"
+#define HEUR_DISPCHAR         'B'
+#define HEUR_PRIORITY         1000000
+#define HEUR_FREQ             1
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         0
+#define HEUR_TIMING           SCIP_HEURTIMING_BEFORENODE
+#define HEUR_USESSUBSCIP      FALSE
+
+#define MAXNCYCLELENGTHS      64
+
+/** type of the benchmarked constraints */
+enum SymbenchConsType
+{
+   SYMBENCH_SYMRETOPE = 0,                   /**< symretope constraints */
+   SYMBENCH_SYMRESACK = 1,                   /**< symresack constraints */
+   SYMBENCH_ORBISACK  = 2,                   /**< orbisack constraints */
+   SYMBENCH_ORBITOPE  = 3                    /**< full orbitope constraints */
+};
+typedef enum SymbenchConsType SYMBENCH_CONSTYPE;
+
+/** benchmark settings */
+struct SymbenchSettings
+{
+   SYMBENCH_CONSTYPE     constype;           /**< type of the benchmarked constraints */
+   int                   nvars;              /**< size of the support of each constraint */
+   int                   nconss;             /**< number of constraints, each one on its own variables */
+   int                   cyclelengths[MAXNCYCLELENGTHS]; /**< cycle lengths, repeated until the support is covered */
+   int                   ncyclelengths;      /**< number of cycle lengths */
+   SCIP_Bool             general;            /**< whether the support is relabeled randomly (not monotone/ordered) */
+   int                   ntrials;            /**< number of random fixings, solutions or points per callback */
+   SCIP_Real             fixingdensity;      /**< probability that a variable is fixed in a random partial fixing */
+   int                   seed;               /**< seed of the random number generator */
+   const char*           settingsname;       /**< name of a SCIP settings file, or NULL */
+};
+typedef struct SymbenchSettings SYMBENCH_SETTINGS;
+
+/** measurements of a single callback */
+struct SymbenchMeasure
+{
+   SCIP_CLOCK*           clock;              /**< clock measuring the time spent in the callback */
+   SCIP_Longint          ncalls;             /**< number of calls */
+   SCIP_Longint          memdelta;           /**< total net change of the used memory in the calls */
+   SCIP_Longint          nfound;             /**< total number of fixings or cuts found */
+   SCIP_Longint          nspecial;           /**< total number of cutoffs or violated solutions */
+};
+typedef struct SymbenchMeasure SYMBENCH_MEASURE;
+
+/** heuristic data of the benchmark heuristic */
+struct SCIP_HeurData
+{
+   SYMBENCH_SETTINGS*    settings;           /**< benchmark settings */
+   SCIP_Bool             done;               /**< whether the benchmark has been run */
+};
+
+
+/*
+ * Benchmark
+ */
+
+/** count the number of variables that are fixed in the current node */
+static
+int countFixedVars(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_VAR** vars;
+   int nvars;
+   int nfixed = 0;
+   int i;
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   for (i = 0; i < nvars; ++i)
+   {
+      if ( SCIPvarGetLbLocal(vars[i]) > 0.5 || SCIPvarGetUbLocal(vars[i]) < 0.5 )
+         ++nfixed;
+   }
+
+   return nfixed;
+}
+
+/** print the measurements of a single callback */
+static
+void printMeasure(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           callback,           /**< name of the callback */
+   const char*           foundname,          /**< name of the found objects */
+   const char*           specialname,        /**< name of the special outcomes */
+   SYMBENCH_MEASURE*     measure             /**< measurements */
+   )
+{
+   SCIP_Real ncalls;
+
+   ncalls = (SCIP_Real) MAX(measure->ncalls, 1);
+   SCIPinfoMessage(scip, NULL, "  %-10s: %10" SCIP_LONGINT_FORMAT " calls %14.1f ns/call %12.1f net bytes/call %10.2f %s/call %10" SCIP_LONGINT_FORMAT " %s\n",
+      callback, measure->ncalls, 1e9 * SCIPgetClockTime(scip, measure->clock) / ncalls,
+      (SCIP_Real) measure->memdelta / ncalls, (SCIP_Real) measure->nfound / ncalls, foundname,
+      measure->nspecial, specialname);
+}
+
+/** time the propagation of all constraints in probing nodes with random partial fixings */
+static
+SCIP_RETCODE benchmarkPropagation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYMBENCH_SETTINGS*    settings,           /**< benchmark settings */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SYMBENCH_MEASURE*     measure             /**< measurements to update */
+   )
+{
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   SCIP_RESULT result;
+   SCIP_Longint memused;
+   int nconss;
+   int nvars;
+   int nfixed;
+   int t;
+   int c;
+   int i;
+
+   conss = SCIPgetConss(scip);
+   nconss = SCIPgetNConss(scip);
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   for (t = 0; t < settings->ntrials; ++t)
+   {
+      SCIP_CALL( SCIPnewProbingNode(scip) );
+
+      for (i = 0; i < nvars; ++i)
+      {
+         if ( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < settings->fixingdensity )
+         {
+            SCIP_CALL( SCIPfixVarProbing(scip, vars[i], (SCIP_Real) SCIPrandomGetInt(randnumgen, 0, 1)) );
+         }
+      }
+
+      for (c = 0; c < nconss; ++c)
+      {
+         nfixed = countFixedVars(scip);
+         memused = SCIPgetMemUsed(scip);
+
+         SCIPstartClock(scip, measure->clock);
+         SCIP_CALL( SCIPpropCons(scip, conss[c], SCIP_PROPTIMING_BEFORELP, &result) );
+         SCIPstopClock(scip, measure->clock);
+
+         measure->memdelta += SCIPgetMemUsed(scip) - memused;
+         measure->nfound += countFixedVars(scip) - nfixed;
+         ++measure->ncalls;
+
+         /* the remaining constraints are not propagated in an infeasible node */
+         if ( result == SCIP_CUTOFF )
+         {
+            ++measure->nspecial;
+            break;
+         }
+      }
+
+      SCIP_CALL( SCIPbacktrackProbing(scip, 0) );
+   }
+
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** time the feasibility check of all constraints on random binary solutions */
+static
+SCIP_RETCODE benchmarkCheck(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYMBENCH_SETTINGS*    settings,           /**< benchmark settings */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SYMBENCH_MEASURE*     measure             /**< measurements to update */
+   )
+{
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   SCIP_SOL* sol;
+   SCIP_RESULT result;
+   SCIP_Longint memused;
+   int nconss;
+   int nvars;
+   int t;
+   int c;
+   int i;
+
+   conss = SCIPgetConss(scip);
+   nconss = SCIPgetNConss(scip);
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   for (t = 0; t < settings->ntrials; ++t)
+   {
+      for (i = 0; i < nvars; ++i)
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], (SCIP_Real) SCIPrandomGetInt(randnumgen, 0, 1)) );
+      }
+
+      for (c = 0; c < nconss; ++c)
+      {
+         memused = SCIPgetMemUsed(scip);
+
+         SCIPstartClock(scip, measure->clock);
+         SCIP_CALL( SCIPcheckCons(scip, conss[c], sol, FALSE, FALSE, FALSE, &result) );
+         SCIPstopClock(scip, measure->clock);
+
+         measure->memdelta += SCIPgetMemUsed(scip) - memused;
+         ++measure->ncalls;
+         if ( result == SCIP_INFEASIBLE )
+            ++measure->nspecial;
+      }
+   }
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   return SCIP_OKAY;
+}
+
+/** time the separation of all constraints on random fractional points */
+static
+SCIP_RETCODE benchmarkSeparation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYMBENCH_SETTINGS*    settings,           /**< benchmark settings */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SYMBENCH_MEASURE*     measure             /**< measurements to update */
+   )
+{
+   SCIP_CONS** conss;
+   SCIP_VAR** vars;
+   SCIP_SOL* sol;
+   SCIP_RESULT result;
+   SCIP_Longint memused;
+   SCIP_Longint ncuts;
+   int nconss;
+   int nvars;
+   int t;
+   int c;
+   int i;
+
+   conss = SCIPgetConss(scip);
+   nconss = SCIPgetNConss(scip);
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   for (t = 0; t < settings->ntrials; ++t)
+   {
+      for (i = 0; i < nvars; ++i)
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], SCIPrandomGetReal(randnumgen, 0.0, 1.0)) );
+      }
+
+      for (c = 0; c < nconss; ++c)
+      {
+         memused = SCIPgetMemUsed(scip);
+         ncuts = SCIPgetNCutsFound(scip);
+
+         SCIPstartClock(scip, measure->clock);
+         SCIP_CALL( SCIPsepasolCons(scip, conss[c], sol, &result) );
+         SCIPstopClock(scip, measure->clock);
+
+         measure->memdelta += SCIPgetMemUsed(scip) - memused;
+         measure->nfound += SCIPgetNCutsFound(scip) - ncuts;
+         ++measure->ncalls;
+         if ( result == SCIP_CUTOFF )
+            ++measure->nspecial;
+      }
+
+      /* do not let the cuts pile up in the separation storage */
+      SCIP_CALL( SCIPclearCuts(scip) );
+   }
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   return SCIP_OKAY;
+}
+
+/** execution method of the benchmark heuristic: run all benchmarks once in the root node, then stop */
+static
+SCIP_DECL_HEUREXEC(heurExecSymbench)
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_RANDNUMGEN* randnumgen;
+   SYMBENCH_MEASURE prop;
+   SYMBENCH_MEASURE check;
+   SYMBENCH_MEASURE sepa;
+
+   assert( scip != NULL );
+   assert( heur != NULL );
+   assert( result != NULL );
+
+   *result = SCIP_DIDNOTRUN;
+
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+   assert( heurdata->settings != NULL );
+
+   if ( heurdata->done )
+      return SCIP_OKAY;
+   heurdata->done = TRUE;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, (unsigned int) heurdata->settings->seed, TRUE) );
+
+   BMSclearMemory(&prop);
+   BMSclearMemory(&check);
+   BMSclearMemory(&sepa);
+   SCIP_CALL( SCIPcreateClock(scip, &prop.clock) );
+   SCIP_CALL( SCIPcreateClock(scip, &check.clock) );
+   SCIP_CALL( SCIPcreateClock(scip, &sepa.clock) );
+
+   SCIP_CALL( benchmarkPropagation(scip, heurdata->settings, randnumgen, &prop) );
+   SCIP_CALL( benchmarkCheck(scip, heurdata->settings, randnumgen, &check) );
+   SCIP_CALL( benchmarkSeparation(scip, heurdata->settings, randnumgen, &sepa) );
+
+   SCIPinfoMessage(scip, NULL, "\nBenchmark results (%d constraints, %d trials):\n",
+      SCIPgetNConss(scip), heurdata->settings->ntrials);
+   printMeasure(scip, "propagate", "fixings", "cutoffs", &prop);
+   printMeasure(scip, "check", "-", "violated", &check);
+   printMeasure(scip, "separate", "cuts", "cutoffs", &sepa);
+   SCIPinfoMessage(scip, NULL, "\n");
+
+   SCIP_CALL( SCIPfreeClock(scip, &sepa.clock) );
+   SCIP_CALL( SCIPfreeClock(scip, &check.clock) );
+   SCIP_CALL( SCIPfreeClock(scip, &prop.clock) );
+   SCIPfreeRandom(scip, &randnumgen);
+
+   SCIP_CALL( SCIPinterruptSolve(scip) );
+   *result = SCIP_DIDNOTFIND;
+
+   return SCIP_OKAY;
+}
+
+/** destructor of the benchmark heuristic */
+static
+SCIP_DECL_HEURFREE(heurFreeSymbench)
+{
+   SCIP_HEURDATA* heurdata;
+
+   heurdata = SCIPheurGetData(heur);
+   assert( heurdata != NULL );
+
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Problem construction
+ */
+
+/** fill a permutation of the support 0, ..., nvars - 1 with the cycle structure of the settings
+ *
+ *  The cycles are placed on consecutive entries, such that the permutation is monotone and ordered, unless a random
+ *  relabeling of the support is requested. A last cycle that does not fit into the support is shortened.
+ */
+static
+SCIP_RETCODE fillPermutation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYMBENCH_SETTINGS*    settings,           /**< benchmark settings */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   int*                  perm                /**< array of length settings->nvars to store the permutation */
+   )
+{
+   int* labels;
+   int cyclestart = 0;
+   int cyclelen;
+   int c = 0;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &labels, settings->nvars) );
+   for (i = 0; i < settings->nvars; ++i)
+      labels[i] = i;
+   if ( settings->general )
+      SCIPrandomPermuteIntArray(randnumgen, labels, 0, settings->nvars);
+
+   while ( cyclestart < settings->nvars )
+   {
+      cyclelen = MIN(settings->cyclelengths[c], settings->nvars - cyclestart);
+      c = (c + 1) % settings->ncyclelengths;
+
+      for (i = cyclestart; i < cyclestart + cyclelen - 1; ++i)
+         perm[labels[i]] = labels[i + 1];
+      perm[labels[cyclestart + cyclelen - 1]] = labels[cyclestart];
+
+      cyclestart += cyclelen;
+   }
+
+   SCIPfreeBufferArray(scip, &labels);
+
+   return SCIP_OKAY;
+}
+
+/** create the variables and constraints of the synthetic benchmark problem */
+static
+SCIP_RETCODE createProblem(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYMBENCH_SETTINGS*    settings            /**< benchmark settings */
+   )
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR** vars;
+   SCIP_VAR*** matrix;
+   SCIP_CONS* cons;
+   char name[SCIP_MAXSTRLEN];
+   int* perm;
+   int nrows;
+   int ncols;
+   int k;
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "symbench") );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, (unsigned int) settings->seed, TRUE) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, settings->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &perm, settings->nvars) );
+
+   /* the orbitopes have as many columns as the first cycle length */
+   ncols = MAX(settings->cyclelengths[0], 2);
+   nrows = MAX(settings->nvars / ncols, 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix, nrows) );
+
+   for (k = 0; k < settings->nconss; ++k)
+   {
+      for (i = 0; i < settings->nvars; ++i)
+      {
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x_%d_%d", k, i);
+         SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, SCIPrandomGetReal(randnumgen, -1.0, 1.0),
+               SCIP_VARTYPE_BINARY) );
+         SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+      }
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "symbench_%d", k);
+      switch ( settings->constype )
+      {
+      case SYMBENCH_SYMRETOPE:
+         SCIP_CALL( fillPermutation(scip, settings, randnumgen, perm) );
+         SCIP_CALL( SCIPcreateConsBasicSymretope(scip, &cons, name, perm, vars, settings->nvars, TRUE) );
+         break;
+      case SYMBENCH_SYMRESACK:
+         SCIP_CALL( fillPermutation(scip, settings, randnumgen, perm) );
+         SCIP_CALL( SCIPcreateConsBasicSymresack(scip, &cons, name, perm, vars, settings->nvars, TRUE) );
+         break;
+      case SYMBENCH_ORBISACK:
+         SCIP_CALL( SCIPcreateConsBasicOrbisack(scip, &cons, name, vars, &vars[settings->nvars / 2],
+               settings->nvars / 2, FALSE, FALSE, TRUE) );
+         break;
+      case SYMBENCH_ORBITOPE:
+         for (i = 0; i < nrows; ++i)
+            matrix[i] = &vars[i * ncols];
+         SCIP_CALL( SCIPcreateConsBasicOrbitope(scip, &cons, name, matrix, SCIP_ORBITOPETYPE_FULL, nrows, ncols,
+               FALSE, TRUE, TRUE, FALSE) );
+         break;
+      default:
+         SCIPerrorMessage("unknown constraint type %d.\n", settings->constype);
+         return SCIP_INVALIDDATA;
+      }
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+      for (j = 0; j < settings->nvars; ++j)
+      {
+         SCIP_CALL( SCIPreleaseVar(scip, &vars[j]) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &matrix);
+   SCIPfreeBufferArray(scip, &perm);
+   SCIPfreeBufferArray(scip, &vars);
+   SCIPfreeRandom(scip, &randnumgen);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Driver
+ */
+
+/** read the command line arguments of the benchmark driver */
+static
+SCIP_RETCODE readBenchmarkArguments(
+   int                   argc,               /**< number of shell parameters */
+   char**                argv,               /**< array with shell parameters */
+   SYMBENCH_SETTINGS*    settings            /**< benchmark settings to fill */
+   )
+{
+   char usage[SCIP_MAXSTRLEN];
+   char* token;
+   int i;
+
+   (void) SCIPsnprintf(usage, SCIP_MAXSTRLEN, "usage: %s [-type symretope|symresack|orbisack|orbitope] "
+      "[-n <support size>] [-k <number of constraints>] [-c <cycle length>[,<cycle length>...]] [-g] "
+      "[-r <trials>] [-f <fixing density>] [-seed <seed>] [-s <setting file>]", argv[0]);
+
+   settings->constype = SYMBENCH_SYMRETOPE;
+   settings->nvars = 1000;
+   settings->nconss = 1;
+   settings->cyclelengths[0] = 10;
+   settings->ncyclelengths = 1;
+   settings->general = FALSE;
+   settings->ntrials = 1000;
+   settings->fixingdensity = 0.1;
+   settings->seed = 0;
+   settings->settingsname = NULL;
+
+   for (i = 1; i < argc; ++i)
+   {
+      /* the flag without value */
+      if ( ! strcmp(argv[i], "-g") )
+      {
+         settings->general = TRUE;
+         continue;
+      }
+
+      if ( i == argc - 1 )
+      {
+         fprintf(stderr, "No value supplied for argument <%s>.\n", argv[i]);
+         fprintf(stderr, "%s\n", usage);
+         return SCIP_ERROR;
+      }
+
+      if ( ! strcmp(argv[i], "-type") )
+      {
+         ++i;
+         if ( ! strcmp(argv[i], "symretope") )
+            settings->constype = SYMBENCH_SYMRETOPE;
+         else if ( ! strcmp(argv[i], "symresack") )
+            settings->constype = SYMBENCH_SYMRESACK;
+         else if ( ! strcmp(argv[i], "orbisack") )
+            settings->constype = SYMBENCH_ORBISACK;
+         else if ( ! strcmp(argv[i], "orbitope") )
+            settings->constype = SYMBENCH_ORBITOPE;
+         else
+         {
+            fprintf(stderr, "Unknown constraint type <%s>.\n", argv[i]);
+            fprintf(stderr, "%s\n", usage);
+            return SCIP_ERROR;
+         }
+      }
+      else if ( ! strcmp(argv[i], "-n") )
+         settings->nvars = atoi(argv[++i]);
+      else if ( ! strcmp(argv[i], "-k") )
+         settings->nconss = atoi(argv[++i]);
+      else if ( ! strcmp(argv[i], "-c") )
+      {
+         settings->ncyclelengths = 0;
+         for (token = strtok(argv[++i], ","); token != NULL; token = strtok(NULL, ","))
+         {
+            if ( settings->ncyclelengths >= MAXNCYCLELENGTHS )
+            {
+               fprintf(stderr, "At most %d cycle lengths are supported.\n", MAXNCYCLELENGTHS);
+               return SCIP_ERROR;
+            }
+            settings->cyclelengths[settings->ncyclelengths++] = atoi(token);
+         }
+      }
+      else if ( ! strcmp(argv[i], "-r") )
+         settings->ntrials = atoi(argv[++i]);
+      else if ( ! strcmp(argv[i], "-f") )
+         settings->fixingdensity = atof(argv[++i]);
+      else if ( ! strcmp(argv[i], "-seed") )
+         settings->seed = atoi(argv[++i]);
+      else if ( ! strcmp(argv[i], "-s") )
+         settings->settingsname = argv[++i];
+      else
+      {
+         fprintf(stderr, "Unknown argument <%s>.\n", argv[i]);
+         fprintf(stderr, "%s\n", usage);
+         return SCIP_ERROR;
+      }
+   }
+
+   if ( settings->nvars < 2 || settings->nconss < 1 || settings->ntrials < 0 || settings->ncyclelengths == 0 )
+   {
+      fprintf(stderr, "The support size must be at least 2, and at least one constraint and cycle length are needed.\n");
+      fprintf(stderr, "%s\n", usage);
+      return SCIP_ERROR;
+   }
+
+   for (i = 0; i < settings->ncyclelengths; ++i)
+   {
+      if ( settings->cyclelengths[i] < 1 )
+      {
+         fprintf(stderr, "Cycle lengths must be positive.\n");
+         return SCIP_ERROR;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** run the benchmark with commandline arguments */
+static
+SCIP_RETCODE runBenchmark(
+   int                   argc,
+   char**                argv
+   )
+{
+   SCIP* scip = 0;
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+   SYMBENCH_SETTINGS settings;
+   SCIP_RETCODE retcode;
+
+   /* parse command line arguments */
+   retcode = readBenchmarkArguments(argc, argv, &settings);
+   if ( retcode != SCIP_OKAY )
+      exit(1);
+
+   /* initialize SCIP */
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   SCIPprintVersion(scip, 0);
+
+   SCIPinfoMessage(scip, 0, "\n");
+   SCIPinfoMessage(scip, 0, "Symmetry constraint benchmark - (c) Jasper van Doornmalen, Christopher Hojny.\n");
+   SCIPinfoMessage(scip, 0, "[GitHash: %s]\n", SYMGITHASH);
+   SCIPinfoMessage(scip, 0, "\n");
+
+   /* include default SCIP plugins */
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeConshdlrSymretope(scip) );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->settings = &settings;
+   heurdata->done = FALSE;
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur, HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ,
+         HEUR_FREQOFS, HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecSymbench, heurdata) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeSymbench) );
+
+   /* Only the callbacks of the synthetic constraints should run: no presolving, no symmetry detection, no other
+    * heuristics and no separation rounds that would change the problem before the benchmark heuristic runs.
+    */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/" HEUR_NAME "/freq", HEUR_FREQ) );
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "timing/clocktype", 2) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+
+   /* The propagation is timed in probing nodes, which should not skip the peeking that is done in the tree. */
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/symretope/probingpeek", TRUE) );
+
+   if ( settings.settingsname != NULL )
+   {
+      if ( SCIPfileExists(settings.settingsname) )
+      {
+         SCIPinfoMessage(scip, 0, "reading parameter file <%s> ...\n\n", settings.settingsname);
+         SCIP_CALL( SCIPreadParams(scip, settings.settingsname) );
+      }
+      else
+      {
+         SCIPerrorMessage("parameter file <%s> not found - using default parameters.\n", settings.settingsname);
+      }
+   }
+
+   SCIP_CALL( createProblem(scip, &settings) );
+
+   SCIPinfoMessage(scip, 0, "running benchmark ...\n");
+   SCIP_CALL( SCIPsolve(scip) );
+
+   SCIP_CALL( SCIPfreeProb(scip) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   BMScheckEmptyMemory();
+
+   return SCIP_OKAY;
+}
+
+
+/** main function */
+int
+main(
+   int                   argc,
+   char**                argv
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = runBenchmark(argc, argv);
+   if ( retcode != SCIP_OKAY )
+   {
+      SCIPprintError(retcode);
+      return -1;
+   }
+
+   return 0;
+}